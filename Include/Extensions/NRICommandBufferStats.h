@@ -0,0 +1,31 @@
+// © 2025 NVIDIA Corporation
+
+// Goal: CPU-side statistics of recorded command buffers, to find heavy passes without a capture tool
+
+#pragma once
+
+#define NRI_COMMAND_BUFFER_STATS_H 1
+
+NriNamespaceBegin
+
+// Requirements:
+// - VK only, "enableVKCommandBufferStats" must be set during device creation
+// - secondary command buffers are not accounted in the primary command buffer executing them
+
+NriStruct(CommandBufferStats) {
+    uint64_t recordingTime;     // CPU time between "BeginCommandBuffer" and "EndCommandBuffer" (ns)
+    uint64_t copyBytes;         // bytes written by "CmdCopy*", "CmdUpload*", "CmdReadback*", "CmdZeroBuffer" and "CmdUpdateBuffer"
+    uint32_t drawNum;           // "CmdDraw*" ("Multi" draws are counted individually, indirect draws once)
+    uint32_t dispatchNum;       // "CmdDispatch*", including rays
+    uint32_t barrierNum;        // global, buffer and texture barriers
+    uint32_t descriptorSetNum;  // "CmdSetDescriptorSet" and "CmdSetRootDescriptor"
+    uint32_t pipelineNum;       // "CmdSetPipeline"
+};
+
+// Threadsafe: no
+NriStruct(CommandBufferStatsInterface) {
+    // Valid after "EndCommandBuffer", reset by "BeginCommandBuffer"
+    void    (NRI_CALL *GetCommandBufferStats)   (const NriRef(CommandBuffer) commandBuffer, NriOut NriRef(CommandBufferStats) commandBufferStats);
+};
+
+NriNamespaceEnd
@@ -0,0 +1,29 @@
+// © 2025 NVIDIA Corporation
+
+// Goal: skipping draws and dispatches on the GPU based on a predicate in a buffer (i.e. occlusion query results) without a CPU readback
+// https://docs.vulkan.org/spec/latest/chapters/drawing.html#drawing-conditional-rendering
+
+#pragma once
+
+#define NRI_CONDITIONAL_RENDERING_H 1
+
+NriNamespaceBegin
+
+// Usage:
+// - "CmdBeginConditionalRendering" => draws, dispatches, clears => "CmdEndConditionalRendering"
+// - predicate is a "uint32_t" at "offset" (4 bytes aligned) in a buffer with "ARGUMENT_BUFFER" usage, commands are skipped if it's 0 (non-0 if "inverted")
+// - the buffer must be synchronized like an argument buffer in "Indirect" commands
+// - both must be recorded either inside or outside of the same "CmdBeginRendering/CmdEndRendering"
+// - secondary command buffers don't inherit the predicate
+
+// Threadsafe: no
+NriStruct(ConditionalRenderingInterface) {
+    // Command buffer
+    // {
+        // Conditional rendering
+        void        (NRI_CALL *CmdBeginConditionalRendering)    (NriRef(CommandBuffer) commandBuffer, const NriRef(Buffer) buffer, uint64_t offset, bool inverted);
+        void        (NRI_CALL *CmdEndConditionalRendering)      (NriRef(CommandBuffer) commandBuffer);
+    // }
+};
+
+NriNamespaceEnd
@@ -75,6 +75,9 @@ NriStruct(DeviceCreationDesc) {
     bool enableGraphicsAPIValidation;           // GAPI-provided validation layer
     bool enableD3D11CommandBufferEmulation;     // enable? but why? (auto-enabled if deferred contexts are not supported)
     bool enableD3D12RayTracingValidation;       // slow but useful, can only be enabled if envvar "NV_ALLOW_RAYTRACING_VALIDATION" is set to "1"
+    bool enableVKBarrierBatching;               // "CmdBarrier" calls get merged and deferred up to the next draw, dispatch, copy or rendering begin
+    bool enableVKCommandBufferStats;            // see "CommandBufferStatsInterface"
+    bool enableVKAsyncSubmission;               // "QueueSubmit" only enqueues, a worker thread per queue calls "vkQueueSubmit2" (in order)
 
     // Switches (enabled by default)
     bool disableVKRayTracing;                   // to save CPU memory in some implementations
@@ -0,0 +1,103 @@
+// © 2025 NVIDIA Corporation
+
+// Goal: GPU-generated command streams, which can change pipelines, vertex and index buffers and root constants between draws or dispatches
+// https://docs.vulkan.org/spec/latest/chapters/device_generated_commands/generatedcommands.html
+
+#pragma once
+
+#define NRI_DEVICE_GENERATED_COMMANDS_H 1
+
+NriNamespaceBegin
+
+NriForwardStruct(IndirectCommandLayout); // a layout of a sequence of commands in a buffer
+NriForwardStruct(IndirectExecutionSet);  // a set of pipelines, which can be bound by index from a sequence
+
+// Requirements:
+// - VK: "VK_EXT_device_generated_commands" must be requested in "VKExtensions::deviceExtensions"
+// - VK: if enabled, all graphics and compute pipelines are created as "indirect bindable"
+// - a pipeline from the indirect execution set (or compatible with the indirect command layout) must be bound before "CmdExecuteGeneratedCommands"
+
+//============================================================================================================================================================================================
+#pragma region [ Commands ]
+//============================================================================================================================================================================================
+
+NriEnum(IndirectCommandType, uint8_t,   // Data in a sequence:
+    PIPELINE,                           // uint32_t (index in "IndirectExecutionSet"), must be the first command
+    ROOT_CONSTANTS,                     // root constants "rootConstantIndex" (full size)
+    INDEX_BUFFER,                       // "IndirectIndexBufferDesc"
+    VERTEX_BUFFER,                      // "IndirectVertexBufferDesc"
+    DRAW,                               // "DrawDesc"
+    DRAW_INDEXED,                       // "DrawIndexedDesc"
+    DISPATCH,                           // "DispatchDesc"
+    DRAW_MESH_TASKS                     // "DrawMeshTasksDesc"
+);
+
+NriStruct(IndirectIndexBufferDesc) {
+    uint64_t deviceAddress;
+    uint32_t size;
+    uint32_t indexType;                         // "IndexType"
+};
+
+NriStruct(IndirectVertexBufferDesc) {
+    uint64_t deviceAddress;
+    uint32_t size;
+    uint32_t stride;
+};
+
+NriStruct(IndirectCommandDesc) {
+    Nri(IndirectCommandType) type;
+    uint32_t offset;                            // offset in a sequence
+    uint32_t rootConstantIndex;                 // ROOT_CONSTANTS
+    uint32_t vertexBufferSlot;                  // VERTEX_BUFFER
+};
+
+NriStruct(IndirectCommandLayoutDesc) {
+    NriOptional const NriPtr(PipelineLayout) pipelineLayout; // needed for ROOT_CONSTANTS
+    const NriPtr(IndirectCommandDesc) commands;             // the last command must be an action command (draw, dispatch)
+    uint32_t commandNum;
+    uint32_t stride;                                        // sequence stride
+    Nri(StageBits) shaderStages;                            // shader stages used by all pipelines
+};
+
+NriStruct(IndirectExecutionSetDesc) {
+    const NriPtr(Pipeline) initialPipeline;     // all pipelines in the set must be compatible with it
+    uint32_t pipelineMaxNum;
+};
+
+NriStruct(GeneratedCommandsDesc) {
+    const NriPtr(IndirectCommandLayout) indirectCommandLayout;
+    NriOptional const NriPtr(IndirectExecutionSet) indirectExecutionSet; // needed for PIPELINE
+    const NriPtr(Buffer) buffer;                                        // "ARGUMENT_BUFFER" usage, contains sequences
+    uint64_t offset;
+    uint32_t sequenceMaxNum;
+    NriOptional const NriPtr(Buffer) countBuffer;                       // sequenceNum = min(sequenceMaxNum, countBuffer[countBufferOffset])
+    uint64_t countBufferOffset;
+    NriOptional const NriPtr(Buffer) preprocessBuffer;                  // "PREPROCESS_BUFFER" usage, size >= "GetGeneratedCommandsPreprocessBufferSize" (not needed if 0)
+};
+
+#pragma endregion
+
+// Threadsafe: no
+NriStruct(DeviceGeneratedCommandsInterface) {
+    // Create
+    Nri(Result)     (NRI_CALL *CreateIndirectCommandLayout)                 (NriRef(Device) device, const NriRef(IndirectCommandLayoutDesc) indirectCommandLayoutDesc, NriOut NriRef(IndirectCommandLayout*) indirectCommandLayout);
+    Nri(Result)     (NRI_CALL *CreateIndirectExecutionSet)                  (NriRef(Device) device, const NriRef(IndirectExecutionSetDesc) indirectExecutionSetDesc, NriOut NriRef(IndirectExecutionSet*) indirectExecutionSet);
+
+    // Get
+    uint64_t        (NRI_CALL *GetGeneratedCommandsPreprocessBufferSize)    (const NriRef(IndirectCommandLayout) indirectCommandLayout, NriOptional const NriPtr(IndirectExecutionSet) indirectExecutionSet, uint32_t sequenceMaxNum);
+
+    // Destroy
+    void            (NRI_CALL *DestroyIndirectCommandLayout)                (NriRef(IndirectCommandLayout) indirectCommandLayout);
+    void            (NRI_CALL *DestroyIndirectExecutionSet)                 (NriRef(IndirectExecutionSet) indirectExecutionSet);
+
+    // Update (the set must not be in use by the GPU)
+    void            (NRI_CALL *UpdateIndirectExecutionSet)                  (NriRef(IndirectExecutionSet) indirectExecutionSet, uint32_t basePipelineIndex, const NriPtr(Pipeline) const* pipelines, uint32_t pipelineNum);
+
+    // Command buffer
+    // {
+            // Execute (synchronized like "Indirect" commands, executions not separated by a barrier must use different preprocess buffers)
+            void    (NRI_CALL *CmdExecuteGeneratedCommands)                 (NriRef(CommandBuffer) commandBuffer, const NriRef(GeneratedCommandsDesc) generatedCommandsDesc);
+    // }
+};
+
+NriNamespaceEnd
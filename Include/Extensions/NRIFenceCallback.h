@@ -0,0 +1,26 @@
+// © 2025 NVIDIA Corporation
+
+// Goal: getting notified when the GPU reaches a fence value, instead of polling "GetFenceValue" or blocking in "Wait"
+
+#pragma once
+
+#define NRI_FENCE_CALLBACK_H 1
+
+NriNamespaceBegin
+
+// Requirements:
+// - VK only
+// - callbacks are called from a device-owned worker thread, which waits for all pending values at once
+// - a fence must not be destroyed while it has pending callbacks, callbacks pending on device destruction are dropped
+
+NriStruct(FenceCallbackDesc) {
+    void (*Callback)(void* userArg);
+    void* userArg;
+};
+
+// Threadsafe: yes
+NriStruct(FenceCallbackInterface) {
+    Nri(Result) (NRI_CALL *RegisterFenceCallback)   (NriRef(Fence) fence, uint64_t value, const NriRef(FenceCallbackDesc) fenceCallbackDesc); // "Callback" is called once "fence" reaches "value"
+};
+
+NriNamespaceEnd
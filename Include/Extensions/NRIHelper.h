@@ -8,6 +8,8 @@
 
 NriNamespaceBegin
 
+NriForwardStruct(FrameContext); // a ring of per-frame command allocators, command buffers and descriptor pools
+
 NriStruct(VideoMemoryInfo) {
     uint64_t budgetSize;    // the OS-provided video memory budget. If "usageSize" > "budgetSize", the application may incur stuttering or performance penalties
     uint64_t usageSize;     // specifies the application’s current video memory usage
@@ -66,7 +68,40 @@ NriStruct(FormatProps) {
     uint32_t unused         : 7;
 };
 
-// Threadsafe: yes
+NriEnum(DeferredDestroyType, uint8_t,
+    COMMAND_ALLOCATOR,
+    COMMAND_BUFFER,
+    DESCRIPTOR_POOL,
+    BUFFER,
+    TEXTURE,
+    DESCRIPTOR,
+    PIPELINE_LAYOUT,
+    PIPELINE,
+    QUERY_POOL,
+    FENCE,
+    MEMORY
+);
+
+NriStruct(DeferredDestroyDesc) {
+    void* object;                       // "CommandAllocator*", "Buffer*", "Texture*" and so on, matching "type"
+    Nri(DeferredDestroyType) type;
+    NriPtr(Fence) fence;                // the object is destroyed once "fence" reaches "value"
+    uint64_t value;
+};
+
+// Usage:
+// - "BeginFrameContext" => record using objects of the returned frame (a thread uses its own "threadIndex") => submit => "EndFrameContext"
+// - "BeginFrameContext" waits for the GPU to finish the frame, which previously used the same slot, and resets its allocators and pools
+// - command buffers are allocated once and must be re-recorded every frame (they are reset with their allocator)
+NriStruct(FrameContextDesc) {
+    NriPtr(Queue) queue;                                                // command allocators are created for it, the frame fence is signaled on it
+    NriOptional const NriPtr(DescriptorPoolDesc) descriptorPoolDesc;    // if provided, a descriptor pool per frame and thread
+    uint32_t frameNum;                                                  // frames in flight
+    uint32_t threadNum;                                                 // recording threads (1 if 0)
+    uint32_t commandBufferNum;                                          // command buffers per frame and thread
+};
+
+// Threadsafe: yes (except "BeginFrameContext" and "EndFrameContext")
 NriStruct(HelperInterface) {
     // Optimized memory allocation for a group of resources
     uint32_t    (NRI_CALL *CalculateAllocationNumber)   (const NriRef(Device) device, const NriRef(ResourceGroupDesc) resourceGroupDesc);
@@ -78,6 +113,19 @@ NriStruct(HelperInterface) {
 
     // Information about video memory
     Nri(Result) (NRI_CALL *QueryVideoMemoryInfo)        (const NriRef(Device) device, Nri(MemoryLocation) memoryLocation, NriOut NriRef(VideoMemoryInfo) videoMemoryInfo);
+
+    // Deferred destruction (objects left in the queue are destroyed by "nriDestroyDevice")
+    void        (NRI_CALL *DestroyDeferred)             (NriRef(Device) device, const NriPtr(DeferredDestroyDesc) deferredDestroyDescs, uint32_t deferredDestroyDescNum);
+    void        (NRI_CALL *ProcessDeferredDestroys)     (NriRef(Device) device, bool all); // destroys objects with reached fence values at once, or all objects if "all" (no GPU work in flight)
+
+    // Frame context
+    Nri(Result)                 (NRI_CALL *CreateFrameContext)          (NriRef(Device) device, const NriRef(FrameContextDesc) frameContextDesc, NriOut NriRef(FrameContext*) frameContext);
+    void                        (NRI_CALL *DestroyFrameContext)         (NriRef(FrameContext) frameContext); // waits for all frames
+    uint32_t                    (NRI_CALL *BeginFrameContext)           (NriRef(FrameContext) frameContext); // returns the frame index in the ring
+    Nri(Result)                 (NRI_CALL *EndFrameContext)             (NriRef(FrameContext) frameContext); // signals the frame fence, must follow all submissions of the frame
+    NriPtr(CommandAllocator)    (NRI_CALL *GetFrameCommandAllocator)    (const NriRef(FrameContext) frameContext, uint32_t threadIndex);
+    NriPtr(CommandBuffer)       (NRI_CALL *GetFrameCommandBuffer)       (const NriRef(FrameContext) frameContext, uint32_t threadIndex, uint32_t commandBufferIndex);
+    NriPtr(DescriptorPool)      (NRI_CALL *GetFrameDescriptorPool)      (const NriRef(FrameContext) frameContext, uint32_t threadIndex); // NULL if "descriptorPoolDesc" is not provided
 };
 
 // Format utilities
@@ -0,0 +1,55 @@
+// © 2025 NVIDIA Corporation
+
+// Goal: overlapping work on graphics, compute and copy queues without manual cross-queue synchronization
+
+#pragma once
+
+#define NRI_QUEUE_SCHEDULER_H 1
+
+NriNamespaceBegin
+
+NriForwardStruct(QueueScheduler);
+
+// Usage:
+// - command buffers must be allocated for "GetQueueSchedulerQueue(queueType)", since a missing queue type falls back to GRAPHICS
+//   (D3D11 and devices with one queue family get everything on the graphics queue, producing the same results)
+// - nodes go in a valid serial order, a node depends on all previous nodes sharing a resource with it (unless both only read it)
+// - barriers inside command buffers are still needed, the scheduler only orders and synchronizes queues
+// - the scheduler submits one "QueueSubmitMulti" per used queue, cross-queue waits use its internal fences
+// - resource hazards are tracked across "SubmitSchedule" calls (until the accesses complete), dependencies on previous schedules become waits on their internal fence values
+
+NriStruct(ScheduleResourceDesc) {
+    const void* resource;   // "Buffer*", "Texture*" or any other object, used only as a key
+    bool isWrite;
+};
+
+NriStruct(ScheduleNodeDesc) {
+    const NriPtr(CommandBuffer) const* commandBuffers;
+    uint32_t commandBufferNum;
+    const NriPtr(ScheduleResourceDesc) resources;
+    uint32_t resourceNum;
+    Nri(QueueType) queueType;
+};
+
+NriStruct(ScheduleDesc) {
+    const NriPtr(ScheduleNodeDesc) nodes;
+    uint32_t nodeNum;
+    NriOptional const NriPtr(FenceSubmitDesc) waitFences;    // waited before the first node on every used queue
+    uint32_t waitFenceNum;
+    NriOptional const NriPtr(FenceSubmitDesc) signalFences;  // signaled on the graphics queue after all nodes
+    uint32_t signalFenceNum;
+};
+
+// Threadsafe: no
+NriStruct(QueueSchedulerInterface) {
+    Nri(Result)     (NRI_CALL *CreateQueueScheduler)    (NriRef(Device) device, NriOut NriRef(QueueScheduler*) queueScheduler);
+    void            (NRI_CALL *DestroyQueueScheduler)   (NriRef(QueueScheduler) queueScheduler); // GPU work submitted through it must be completed
+
+    // The queue used for nodes of "queueType"
+    NriPtr(Queue)   (NRI_CALL *GetQueueSchedulerQueue)  (const NriRef(QueueScheduler) queueScheduler, Nri(QueueType) queueType);
+
+    // Plans queue batches and cross-queue waits, then submits
+    Nri(Result)     (NRI_CALL *SubmitSchedule)          (NriRef(QueueScheduler) queueScheduler, const NriRef(ScheduleDesc) scheduleDesc);
+};
+
+NriNamespaceEnd
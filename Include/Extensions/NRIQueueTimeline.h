@@ -0,0 +1,21 @@
+// © 2025 NVIDIA Corporation
+
+// Goal: tracking submission completion without user fences
+
+#pragma once
+
+#define NRI_QUEUE_TIMELINE_H 1
+
+NriNamespaceBegin
+
+// Requirements:
+// - VK only
+// - every "QueueSubmit" and "QueueSubmitMulti" call gets a new submission ID, signaled by its last batch on an internal timeline semaphore of the queue
+
+// Threadsafe: yes
+NriStruct(QueueTimelineInterface) {
+    uint64_t    (NRI_CALL *GetQueueSubmissionId)            (const NriRef(Queue) queue); // ID of the last submission (0 if none)
+    uint64_t    (NRI_CALL *GetQueueCompletedSubmissionId)   (const NriRef(Queue) queue); // all submissions with IDs <= returned are completed on the GPU
+};
+
+NriNamespaceEnd
@@ -0,0 +1,94 @@
+// © 2025 NVIDIA Corporation
+
+// Goal: automatic barriers, culling of unused passes and memory aliasing of transient resources
+
+#pragma once
+
+#define NRI_RENDER_GRAPH_H 1
+
+NriNamespaceBegin
+
+NriForwardStruct(RenderGraph);
+
+// Usage:
+// - "CompileRenderGraph" => "CmdExecuteRenderGraph" (can be repeated until the next compilation)
+// - resources are referenced by index in "RenderGraphDesc::resources", passes go in execution order
+// - imported resources (non-NULL "texture" or "buffer") are transitioned from "initialState" to "finalState" and keep passes writing them alive
+// - a pass is culled, if it has no side effects and nothing alive reads what it writes
+// - transient resources are created in DEVICE memory, resources with non-overlapping lifetimes alias the same memory (content is not preserved)
+// - transient resources are recreated only if their descriptions or lifetimes change, in this case the previous ones must not be in use by the GPU
+// - all accesses of a texture in a pass must use the same layout, barriers cover all subresources
+// - barriers between "Record" callbacks are recorded by the graph, barriers inside a pass are still needed
+
+NriEnum(RenderGraphResourceType, uint8_t,
+    TEXTURE,
+    BUFFER
+);
+
+NriStruct(RenderGraphResourceDesc) {
+    Nri(RenderGraphResourceType) type;
+    NriOptional const char* name;               // transient: debug name
+
+    // Imported
+    NriOptional NriPtr(Texture) texture;
+    NriOptional NriPtr(Buffer) buffer;
+    Nri(AccessLayoutStage) initialState;        // "layout" is ignored for buffers
+    Nri(AccessLayoutStage) finalState;
+
+    // Transient (if "texture" and "buffer" are NULL)
+    Nri(TextureDesc) textureDesc;
+    Nri(BufferDesc) bufferDesc;
+};
+
+NriStruct(RenderGraphAccessDesc) {
+    uint32_t resourceIndex;
+    Nri(AccessLayoutStage) state;               // "layout" is ignored for buffers
+};
+
+NriStruct(RenderGraphPassDesc) {
+    NriOptional const char* name;               // annotation
+    NriOptional const NriPtr(RenderGraphAccessDesc) reads;
+    uint32_t readNum;
+    NriOptional const NriPtr(RenderGraphAccessDesc) writes;
+    uint32_t writeNum;
+    void (*Record)(NriRef(CommandBuffer) commandBuffer, void* userArg);
+    void* userArg;
+    bool hasSideEffects;                        // never culled
+};
+
+NriStruct(RenderGraphDesc) {
+    const NriPtr(RenderGraphResourceDesc) resources;
+    uint32_t resourceNum;
+    const NriPtr(RenderGraphPassDesc) passes;
+    uint32_t passNum;
+};
+
+NriStruct(RenderGraphStats) {
+    uint64_t transientMemorySize;               // allocated
+    uint64_t transientResourceSize;             // sum of transient resource sizes (i.e. without aliasing)
+    uint32_t passNum;                           // not culled
+    uint32_t barrierNum;                        // buffer and texture barriers
+    uint32_t barrierGroupNum;                   // "CmdBarrier" calls
+};
+
+// Threadsafe: no
+NriStruct(RenderGraphInterface) {
+    Nri(Result)         (NRI_CALL *CreateRenderGraph)       (NriRef(Device) device, NriOut NriRef(RenderGraph*) renderGraph);
+    void                (NRI_CALL *DestroyRenderGraph)      (NriRef(RenderGraph) renderGraph); // GPU work recorded with it must be completed
+
+    // Culls passes, plans barriers and (re)creates transient resources
+    Nri(Result)         (NRI_CALL *CompileRenderGraph)      (NriRef(RenderGraph) renderGraph, const NriRef(RenderGraphDesc) renderGraphDesc);
+
+    // Valid after "CompileRenderGraph" (NULL if a transient resource is not used by alive passes)
+    NriPtr(Texture)     (NRI_CALL *GetRenderGraphTexture)   (const NriRef(RenderGraph) renderGraph, uint32_t resourceIndex);
+    NriPtr(Buffer)      (NRI_CALL *GetRenderGraphBuffer)    (const NriRef(RenderGraph) renderGraph, uint32_t resourceIndex);
+    void                (NRI_CALL *GetRenderGraphStats)     (const NriRef(RenderGraph) renderGraph, NriOut NriRef(RenderGraphStats) renderGraphStats);
+
+    // Command buffer
+    // {
+            // Records barriers and alive passes (calls "Record")
+            void        (NRI_CALL *CmdExecuteRenderGraph)   (NriRef(CommandBuffer) commandBuffer, const NriRef(RenderGraph) renderGraph);
+    // }
+};
+
+NriNamespaceEnd
@@ -0,0 +1,33 @@
+// © 2025 NVIDIA Corporation
+
+// Goal: parallel recording of a single rendering pass using secondary command buffers
+// https://docs.vulkan.org/spec/latest/chapters/cmdbuffers.html#commandbuffers-secondary
+
+#pragma once
+
+#define NRI_SECONDARY_COMMAND_BUFFER_H 1
+
+NriNamespaceBegin
+
+// Usage:
+// - primary: "CmdBeginRenderingSecondary" => "CmdExecuteCommands" (only) => "CmdEndRendering"
+// - secondary: "BeginSecondaryCommandBuffer" (with the same "AttachmentsDesc") => Cmd* => "EndCommandBuffer"
+// - a secondary command buffer, begun without "attachmentsDesc", can be executed only outside of rendering
+
+// Threadsafe: no
+NriStruct(SecondaryCommandBufferInterface) {
+    Nri(Result)     (NRI_CALL *CreateSecondaryCommandBuffer)    (NriRef(CommandAllocator) commandAllocator, NriOut NriRef(CommandBuffer*) commandBuffer); // destroy with "DestroyCommandBuffer"
+
+    // Command buffer
+    // {
+    Nri(Result)     (NRI_CALL *BeginSecondaryCommandBuffer)     (NriRef(CommandBuffer) commandBuffer, NriOptional const NriPtr(AttachmentsDesc) attachmentsDesc, NriOptional const NriPtr(DescriptorPool) descriptorPool); // end with "EndCommandBuffer"
+
+        // Rendering (the contents are provided by secondary command buffers only)
+        void        (NRI_CALL *CmdBeginRenderingSecondary)      (NriRef(CommandBuffer) commandBuffer, const NriRef(AttachmentsDesc) attachmentsDesc); // end with "CmdEndRendering"
+
+        // Execute
+        void        (NRI_CALL *CmdExecuteCommands)              (NriRef(CommandBuffer) commandBuffer, const NriPtr(CommandBuffer) const* secondaryCommandBuffers, uint32_t secondaryCommandBufferNum);
+    // }
+};
+
+NriNamespaceEnd
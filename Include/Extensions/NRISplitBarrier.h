@@ -0,0 +1,28 @@
+// © 2025 NVIDIA Corporation
+
+// Goal: starting a transition early and waiting for it later, overlapping independent work with layout transitions and cache flushes
+// https://docs.vulkan.org/spec/latest/chapters/synchronization.html#synchronization-events
+
+#pragma once
+
+#define NRI_SPLIT_BARRIER_H 1
+
+NriNamespaceBegin
+
+// Usage:
+// - "CmdBeginBarrier" => independent work => "CmdEndBarrier"
+// - both must be recorded in the same command buffer, outside of rendering, with the same "barrierGroupDesc"
+// - "CmdEndBarrier" acts as a regular barrier if the command buffer is not allocated from a command allocator (i.e. wrapped)
+// - "CmdBeginBarrier" returns "uint32_t(-1)" if validation fails
+
+// Threadsafe: no
+NriStruct(SplitBarrierInterface) {
+    // Command buffer
+    // {
+        // Barrier
+        uint32_t    (NRI_CALL *CmdBeginBarrier)                 (NriRef(CommandBuffer) commandBuffer, const NriRef(BarrierGroupDesc) barrierGroupDesc); // returns "splitBarrierIndex"
+        void        (NRI_CALL *CmdEndBarrier)                   (NriRef(CommandBuffer) commandBuffer, const NriRef(BarrierGroupDesc) barrierGroupDesc, uint32_t splitBarrierIndex);
+    // }
+};
+
+NriNamespaceEnd
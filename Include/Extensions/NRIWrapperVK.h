@@ -39,6 +39,9 @@ NriStruct(DeviceCreationVKDesc) {
 
     // Switches (disabled by default)
     bool enableNRIValidation;
+    bool enableVKBarrierBatching;
+    bool enableVKCommandBufferStats;
+    bool enableVKAsyncSubmission;
 };
 
 NriStruct(CommandAllocatorVKDesc) {
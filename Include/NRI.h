@@ -37,8 +37,8 @@ Implicit:
 
 #pragma once
 
-#define NRI_VERSION 173
-#define NRI_VERSION_DATE "14 July 2025"
+#define NRI_VERSION 174
+#define NRI_VERSION_DATE "19 October 2026"
 
 // C/C++ compatible interface (auto-selection or via "NRI_FORCE_C" macro)
 #include "NRIDescs.h"
@@ -60,6 +60,16 @@ NRI_API void NRI_CALL nriEndAnnotation();                                   // e
 NRI_API void NRI_CALL nriAnnotation(const char* name, uint32_t bgra);       // emit a named simultaneous event
 NRI_API void NRI_CALL nriSetThreadName(const char* name);                   // assign a name to the current thread
 
+// Contention of internal locks, accumulated over all devices (zeros if "NRI_ENABLE_LOCK_STATS" is off)
+NriStruct(LockStats) {
+    uint64_t acquisitionNum;
+    uint64_t contendedAcquisitionNum;   // not acquired at the first attempt
+    uint64_t parkNum;                   // not acquired by spinning
+    uint64_t spinTime;                  // spent spinning (ns)
+};
+
+NRI_API void NRI_CALL nriGetLockStats(NriOut NriRef(LockStats) lockStats);
+
 // Threadsafe: yes
 NriStruct(CoreInterface) {
     // Get
@@ -135,8 +145,9 @@ NriStruct(CoreInterface) {
     void                (NRI_CALL *UpdateDynamicConstantBuffers)    (NriRef(DescriptorSet) descriptorSet, uint32_t baseDynamicConstantBuffer, uint32_t dynamicConstantBufferNum, const NriPtr(Descriptor) const* descriptors);
     void                (NRI_CALL *CopyDescriptorSet)               (NriRef(DescriptorSet) descriptorSet, const NriRef(DescriptorSetCopyDesc) descriptorSetCopyDesc);
 
-    // Command buffer (one time submit)
+    // Command buffer ("BeginCommandBuffer" - one time submit)
     Nri(Result)         (NRI_CALL *BeginCommandBuffer)              (NriRef(CommandBuffer) commandBuffer, const NriPtr(DescriptorPool) descriptorPool);
+    Nri(Result)         (NRI_CALL *BeginReusableCommandBuffer)      (NriRef(CommandBuffer) commandBuffer, const NriPtr(DescriptorPool) descriptorPool); // can be submitted many times (not while in flight) until re-recorded or "ResetCommandAllocator"
     // {                {
         // Change descriptor pool (initially can be set via "BeginCommandBuffer")
         void                (NRI_CALL *CmdSetDescriptorPool)        (NriRef(CommandBuffer) commandBuffer, const NriRef(DescriptorPool) descriptorPool);
@@ -184,6 +195,10 @@ NriStruct(CoreInterface) {
             void                (NRI_CALL *CmdDraw)                 (NriRef(CommandBuffer) commandBuffer, const NriRef(DrawDesc) drawDesc);
             void                (NRI_CALL *CmdDrawIndexed)          (NriRef(CommandBuffer) commandBuffer, const NriRef(DrawIndexedDesc) drawIndexedDesc);
 
+            // Draw multi (VK: consecutive draws with the same "instanceNum" and "baseInstance" are merged, if "VK_EXT_multi_draw" is supported)
+            void                (NRI_CALL *CmdDrawMulti)            (NriRef(CommandBuffer) commandBuffer, const NriPtr(DrawDesc) drawDescs, uint32_t drawNum);
+            void                (NRI_CALL *CmdDrawIndexedMulti)     (NriRef(CommandBuffer) commandBuffer, const NriPtr(DrawIndexedDesc) drawIndexedDescs, uint32_t drawNum);
+
             // Draw indirect:
             //  - drawNum = min(drawNum, countBuffer ? countBuffer[countBufferOffset] : INF)
             //  - see "Modified draw command signatures"
@@ -202,6 +217,13 @@ NriStruct(CoreInterface) {
         void                (NRI_CALL *CmdUploadBufferToTexture)    (NriRef(CommandBuffer) commandBuffer, NriRef(Texture) dstTexture, const NriRef(TextureRegionDesc) dstRegion, const NriRef(Buffer) srcBuffer, const NriRef(TextureDataLayoutDesc) srcDataLayout);
         void                (NRI_CALL *CmdReadbackTextureToBuffer)  (NriRef(CommandBuffer) commandBuffer, NriRef(Buffer) dstBuffer, const NriRef(TextureDataLayoutDesc) dstDataLayout, const NriRef(Texture) srcTexture, const NriRef(TextureRegionDesc) srcRegion);
         void                (NRI_CALL *CmdZeroBuffer)               (NriRef(CommandBuffer) commandBuffer, NriRef(Buffer) buffer, uint64_t offset, uint64_t size);
+        void                (NRI_CALL *CmdUpdateBuffer)             (NriRef(CommandBuffer) commandBuffer, NriRef(Buffer) buffer, uint64_t offset, const void* data, uint32_t size); // inline data, no staging: "size <= 65536", "offset" and "size" must be multiples of 4
+
+        // Copy multi (VK: a single API call for all regions, "regionNum = 0" is a no-op)
+        void                (NRI_CALL *CmdCopyBufferMulti)              (NriRef(CommandBuffer) commandBuffer, NriRef(Buffer) dstBuffer, const NriRef(Buffer) srcBuffer, const NriPtr(BufferCopyRegionDesc) regions, uint32_t regionNum);
+        void                (NRI_CALL *CmdCopyTextureMulti)             (NriRef(CommandBuffer) commandBuffer, NriRef(Texture) dstTexture, const NriRef(Texture) srcTexture, const NriPtr(TextureCopyRegionDesc) regions, uint32_t regionNum);
+        void                (NRI_CALL *CmdUploadBufferToTextureMulti)   (NriRef(CommandBuffer) commandBuffer, NriRef(Texture) dstTexture, const NriRef(Buffer) srcBuffer, const NriPtr(TextureBufferCopyRegionDesc) regions, uint32_t regionNum);
+        void                (NRI_CALL *CmdReadbackTextureToBufferMulti) (NriRef(CommandBuffer) commandBuffer, NriRef(Buffer) dstBuffer, const NriRef(Texture) srcTexture, const NriPtr(TextureBufferCopyRegionDesc) regions, uint32_t regionNum);
 
         // Resolve
         void                (NRI_CALL *CmdResolveTexture)           (NriRef(CommandBuffer) commandBuffer, NriRef(Texture) dstTexture, NriOptional const NriPtr(TextureRegionDesc) dstRegion, const NriRef(Texture) srcTexture, NriOptional const NriPtr(TextureRegionDesc) srcRegion); // "features.regionResolve" is needed for region specification
@@ -232,9 +254,12 @@ NriStruct(CoreInterface) {
 
     // Work submission and synchronization
     Nri(Result)         (NRI_CALL *QueueSubmit)                     (NriRef(Queue) queue, const NriRef(QueueSubmitDesc) queueSubmitDesc); // to device
+    Nri(Result)         (NRI_CALL *QueueSubmitMulti)                (NriRef(Queue) queue, const NriPtr(QueueSubmitDesc) queueSubmitDescs, uint32_t queueSubmitDescNum); // to device, in order, in one call
     Nri(Result)         (NRI_CALL *DeviceWaitIdle)                  (NriRef(Device) device);
     Nri(Result)         (NRI_CALL *QueueWaitIdle)                   (NriRef(Queue) queue);
     void                (NRI_CALL *Wait)                            (NriRef(Fence) fence, uint64_t value); // on host
+    void                (NRI_CALL *Signal)                          (NriRef(Fence) fence, uint64_t value); // on host, "value" must be greater than the current value, requires "features.hostFenceSignal"
+    Nri(Result)         (NRI_CALL *WaitMulti)                       (NriRef(Device) device, const NriPtr(FenceWaitDesc) fenceWaitDescs, uint32_t fenceWaitDescNum, bool waitAny, uint32_t timeout); // on host, "timeout" in ms ("UINT32_MAX" - infinite), returns "SUCCESS", "TIMEOUT" or "DEVICE_LOST" ("UNSUPPORTED" for "waitAny" or a finite "timeout" on D3D11 without "ID3D11Fence")
 
     // Command allocator
     void                (NRI_CALL *ResetCommandAllocator)           (NriRef(CommandAllocator) commandAllocator);
@@ -88,6 +88,7 @@ NriEnum(GraphicsAPI, uint8_t,
 
 NriEnum(Result, int8_t,
     // All bad, but optionally require an action ("callbackInterface.AbortExecution" is not triggered)
+    TIMEOUT                 = -4, // "WaitMulti" is not satisfied in time
     DEVICE_LOST             = -3, // may be returned by "QueueSubmit*", "*WaitIdle", "AcquireNextTexture", "QueuePresent", "WaitForPresent"
     OUT_OF_DATE             = -2, // VK: swap chain is out of date
     INVALID_SDK             = -1, // D3D: some interfaces are missing (potential reasons: unable to load "D3D12Core.dll", version or SDK mismatch)
@@ -568,7 +569,8 @@ NriBits(BufferUsageBits, uint16_t,                 // Min compatible access:
     ACCELERATION_STRUCTURE_BUILD_INPUT  = NriBit(8),  // SHADER_RESOURCE                         Read-only input in "CmdBuildAccelerationStructures" command
     ACCELERATION_STRUCTURE_STORAGE      = NriBit(9),  // ACCELERATION_STRUCTURE_READ/WRITE       (INTERNAL) acceleration structure storage
     MICROMAP_BUILD_INPUT                = NriBit(10), // SHADER_RESOURCE                         Read-only input in "CmdBuildMicromaps" command
-    MICROMAP_STORAGE                    = NriBit(11)  // MICROMAP_READ/WRITE                     (INTERNAL) micromap storage
+    MICROMAP_STORAGE                    = NriBit(11), // MICROMAP_READ/WRITE                     (INTERNAL) micromap storage
+    PREPROCESS_BUFFER                   = NriBit(12)  // ARGUMENT_BUFFER                         Preprocess buffer in "CmdExecuteGeneratedCommands" command
 );
 
 NriStruct(TextureDesc) {
@@ -1299,12 +1301,40 @@ NriStruct(OutputMergerDesc) {
     NriOptional Nri(Multiview) multiview;   // if "viewMask != 0", requires "features.(xxx)Multiview"
 };
 
+// https://registry.khronos.org/vulkan/specs/latest/man/html/VkRenderingAttachmentInfo.html
+NriEnum(LoadOp, uint8_t,
+    LOAD,           // previous contents are preserved
+    CLEAR,          // cleared to "clearValue"
+    DONT_CARE       // previous contents are not needed
+);
+
+NriEnum(StoreOp, uint8_t,
+    STORE,          // results are preserved
+    DONT_CARE       // results are not needed after "CmdEndRendering" (i.e. a resolved MSAA or a transient depth-stencil attachment)
+);
+
+NriEnum(ResolveOp, uint8_t,
+    AVERAGE,        // "SAMPLE_ZERO" for depth-stencil and integer formats
+    SAMPLE_ZERO     // not allowed for float and normalized color formats
+);
+
+// D3D11/D3D12: "DONT_CARE" is treated as "LOAD/STORE"
+NriStruct(AttachmentOpsDesc) {
+    Nri(ClearValue) clearValue;
+    NriOptional const NriPtr(Descriptor) resolveDst; // resolved in "CmdEndRendering", must be a single-sample view with the same format, extent and layout as the attachment, requires "features.renderingResolve"
+    Nri(LoadOp) loadOp;
+    Nri(StoreOp) storeOp;
+    Nri(ResolveOp) resolveOp;
+};
+
 NriStruct(AttachmentsDesc) {
     NriOptional const NriPtr(Descriptor) depthStencil;
     NriOptional const NriPtr(Descriptor) shadingRate; // requires "tiers.shadingRate >= 2"
     const NriPtr(Descriptor) const* colors;
     uint32_t colorNum;
     NriOptional uint32_t viewMask;          // if non-0, requires "viewMaxNum > 1"
+    NriOptional const NriPtr(AttachmentOpsDesc) colorOps;          // "colorNum" entries, "LOAD" and "STORE" if not provided
+    NriOptional const NriPtr(AttachmentOpsDesc) depthStencilOps;   // "LOAD" and "STORE" if not provided
 };
 
 #pragma endregion
@@ -1472,6 +1502,22 @@ NriStruct(TextureDataLayoutDesc) {
     uint32_t slicePitch;    // must be a multiple of "uploadBufferTextureSliceAlignment"
 };
 
+NriStruct(BufferCopyRegionDesc) {
+    uint64_t dstOffset;
+    uint64_t srcOffset;
+    uint64_t size;          // can be "WHOLE_SIZE" only if both buffers have the same size and offsets are 0
+};
+
+NriStruct(TextureCopyRegionDesc) {
+    Nri(TextureRegionDesc) dstRegion;
+    Nri(TextureRegionDesc) srcRegion;
+};
+
+NriStruct(TextureBufferCopyRegionDesc) {
+    Nri(TextureRegionDesc) textureRegion;
+    Nri(TextureDataLayoutDesc) dataLayout;
+};
+
 // Work submission
 NriStruct(FenceSubmitDesc) {
     NriPtr(Fence) fence;
@@ -1488,6 +1534,12 @@ NriStruct(QueueSubmitDesc) {
     uint32_t signalFenceNum;
 };
 
+// Host wait
+NriStruct(FenceWaitDesc) {
+    NriPtr(Fence) fence;
+    uint64_t value;
+};
+
 // Clear
 NriStruct(ClearDesc) {
     Nri(ClearValue) value;
@@ -1824,12 +1876,14 @@ NriStruct(DeviceDesc) {
         uint32_t additionalShadingRates                          : 1; // see "ShadingRate"
         uint32_t viewportOriginBottomLeft                        : 1; // see "Viewport"
         uint32_t regionResolve                                   : 1; // see "CmdResolveTexture"
+        uint32_t renderingResolve                                : 1; // see "AttachmentOpsDesc::resolveDst"
         uint32_t flexibleMultiview                               : 1; // see "Multiview::FLEXIBLE"
         uint32_t layerBasedMultiview                             : 1; // see "Multiview::LAYRED_BASED"
         uint32_t viewportBasedMultiview                          : 1; // see "Multiview::VIEWPORT_BASED"
         uint32_t presentFromCompute                              : 1; // see "SwapChainDesc::queue"
         uint32_t waitableSwapChain                               : 1; // see "SwapChainDesc::waitable"
         uint32_t pipelineStatistics                              : 1; // see "QueryType::PIPELINE_STATISTICS"
+        uint32_t hostFenceSignal                                 : 1; // see "Signal"
     } features;
 
     // Shader features
@@ -0,0 +1,89 @@
+// © 2025 NVIDIA Corporation
+
+// Goal: direct calls into the VK backend, bypassing "CoreInterface" function pointers on hot paths
+// Requirements:
+// - "NRI_STATIC_LIBRARY" and "NRI_ENABLE_DIRECT_CALLS" (CMake), VK must be the backend in use
+// - the device must be created with "GraphicsAPI::VK" and without "enableNRIValidation" (objects are not checked)
+// - the functions mirror "CoreInterface" and can be freely mixed with it
+// - inlining into the caller requires LTO (i.e. "INTERPROCEDURAL_OPTIMIZATION")
+
+#pragma once
+
+#define NRI_DIRECT_H 1
+
+#ifndef __cplusplus
+#    error "NRIDirect.h" is C++ only
+#endif
+
+#include "NRI.h"
+
+namespace nri::direct {
+
+// Fence
+uint64_t GetFenceValue(Fence& fence);
+void Signal(Fence& fence, uint64_t value);
+
+// Descriptor set
+void UpdateDescriptorRanges(DescriptorSet& descriptorSet, uint32_t baseRange, uint32_t rangeNum, const DescriptorRangeUpdateDesc* rangeUpdateDescs);
+void UpdateDynamicConstantBuffers(DescriptorSet& descriptorSet, uint32_t baseDynamicConstantBuffer, uint32_t dynamicConstantBufferNum, const Descriptor* const* descriptors);
+
+// Command buffer
+Result BeginCommandBuffer(CommandBuffer& commandBuffer, const DescriptorPool* descriptorPool);
+void CmdSetDescriptorPool(CommandBuffer& commandBuffer, const DescriptorPool& descriptorPool);
+void CmdSetPipelineLayout(CommandBuffer& commandBuffer, const PipelineLayout& pipelineLayout);
+void CmdSetPipeline(CommandBuffer& commandBuffer, const Pipeline& pipeline);
+void CmdSetDescriptorSet(CommandBuffer& commandBuffer, uint32_t setIndex, const DescriptorSet& descriptorSet, const uint32_t* dynamicConstantBufferOffsets);
+void CmdSetRootConstants(CommandBuffer& commandBuffer, uint32_t rootConstantIndex, const void* data, uint32_t size);
+void CmdSetRootDescriptor(CommandBuffer& commandBuffer, uint32_t rootDescriptorIndex, Descriptor& descriptor);
+void CmdBarrier(CommandBuffer& commandBuffer, const BarrierGroupDesc& barrierGroupDesc);
+void CmdSetIndexBuffer(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset, IndexType indexType);
+void CmdSetVertexBuffers(CommandBuffer& commandBuffer, uint32_t baseSlot, const VertexBufferDesc* vertexBufferDescs, uint32_t vertexBufferNum);
+void CmdSetViewports(CommandBuffer& commandBuffer, const Viewport* viewports, uint32_t viewportNum);
+void CmdSetScissors(CommandBuffer& commandBuffer, const Rect* rects, uint32_t rectNum);
+void CmdSetStencilReference(CommandBuffer& commandBuffer, uint8_t frontRef, uint8_t backRef);
+void CmdSetDepthBounds(CommandBuffer& commandBuffer, float boundsMin, float boundsMax);
+void CmdSetBlendConstants(CommandBuffer& commandBuffer, const Color32f& color);
+void CmdSetSampleLocations(CommandBuffer& commandBuffer, const SampleLocation* locations, Sample_t locationNum, Sample_t sampleNum);
+void CmdSetShadingRate(CommandBuffer& commandBuffer, const ShadingRateDesc& shadingRateDesc);
+void CmdSetDepthBias(CommandBuffer& commandBuffer, const DepthBiasDesc& depthBiasDesc);
+void CmdBeginRendering(CommandBuffer& commandBuffer, const AttachmentsDesc& attachmentsDesc);
+void CmdClearAttachments(CommandBuffer& commandBuffer, const ClearDesc* clearDescs, uint32_t clearDescNum, const Rect* rects, uint32_t rectNum);
+void CmdDraw(CommandBuffer& commandBuffer, const DrawDesc& drawDesc);
+void CmdDrawIndexed(CommandBuffer& commandBuffer, const DrawIndexedDesc& drawIndexedDesc);
+void CmdDrawMulti(CommandBuffer& commandBuffer, const DrawDesc* drawDescs, uint32_t drawNum);
+void CmdDrawIndexedMulti(CommandBuffer& commandBuffer, const DrawIndexedDesc* drawIndexedDescs, uint32_t drawNum);
+void CmdDrawIndirect(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset);
+void CmdDrawIndexedIndirect(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset);
+void CmdEndRendering(CommandBuffer& commandBuffer);
+void CmdDispatch(CommandBuffer& commandBuffer, const DispatchDesc& dispatchDesc);
+void CmdDispatchIndirect(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset);
+void CmdCopyBuffer(CommandBuffer& commandBuffer, Buffer& dstBuffer, uint64_t dstOffset, const Buffer& srcBuffer, uint64_t srcOffset, uint64_t size);
+void CmdCopyTexture(CommandBuffer& commandBuffer, Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion);
+void CmdUploadBufferToTexture(CommandBuffer& commandBuffer, Texture& dstTexture, const TextureRegionDesc& dstRegion, const Buffer& srcBuffer, const TextureDataLayoutDesc& srcDataLayout);
+void CmdReadbackTextureToBuffer(CommandBuffer& commandBuffer, Buffer& dstBuffer, const TextureDataLayoutDesc& dstDataLayout, const Texture& srcTexture, const TextureRegionDesc& srcRegion);
+void CmdZeroBuffer(CommandBuffer& commandBuffer, Buffer& buffer, uint64_t offset, uint64_t size);
+void CmdUpdateBuffer(CommandBuffer& commandBuffer, Buffer& buffer, uint64_t offset, const void* data, uint32_t size);
+void CmdCopyBufferMulti(CommandBuffer& commandBuffer, Buffer& dstBuffer, const Buffer& srcBuffer, const BufferCopyRegionDesc* regions, uint32_t regionNum);
+void CmdCopyTextureMulti(CommandBuffer& commandBuffer, Texture& dstTexture, const Texture& srcTexture, const TextureCopyRegionDesc* regions, uint32_t regionNum);
+void CmdUploadBufferToTextureMulti(CommandBuffer& commandBuffer, Texture& dstTexture, const Buffer& srcBuffer, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum);
+void CmdReadbackTextureToBufferMulti(CommandBuffer& commandBuffer, Buffer& dstBuffer, const Texture& srcTexture, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum);
+void CmdResolveTexture(CommandBuffer& commandBuffer, Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion);
+void CmdClearStorage(CommandBuffer& commandBuffer, const ClearStorageDesc& clearDesc);
+void CmdResetQueries(CommandBuffer& commandBuffer, QueryPool& queryPool, uint32_t offset, uint32_t num);
+void CmdBeginQuery(CommandBuffer& commandBuffer, QueryPool& queryPool, uint32_t offset);
+void CmdEndQuery(CommandBuffer& commandBuffer, QueryPool& queryPool, uint32_t offset);
+void CmdCopyQueries(CommandBuffer& commandBuffer, const QueryPool& queryPool, uint32_t offset, uint32_t num, Buffer& dstBuffer, uint64_t dstOffset);
+void CmdBeginAnnotation(CommandBuffer& commandBuffer, const char* name, uint32_t bgra);
+void CmdEndAnnotation(CommandBuffer& commandBuffer);
+void CmdAnnotation(CommandBuffer& commandBuffer, const char* name, uint32_t bgra);
+Result EndCommandBuffer(CommandBuffer& commandBuffer);
+
+// Queue
+Result QueueSubmit(Queue& queue, const QueueSubmitDesc& queueSubmitDesc);
+Result QueueSubmitMulti(Queue& queue, const QueueSubmitDesc* queueSubmitDescs, uint32_t queueSubmitDescNum);
+
+// Memory
+void* MapBuffer(Buffer& buffer, uint64_t offset, uint64_t size);
+void UnmapBuffer(Buffer& buffer);
+
+} // namespace nri::direct
@@ -444,6 +444,22 @@ NRI_API Result NRI_CALL nriGetInterface(const Device& device, const char* interf
         realInterfaceSize = sizeof(CoreInterface);
         if (realInterfaceSize == interfaceSize)
             result = deviceBase.FillFunctionTable(*(CoreInterface*)interfacePtr);
+    } else if (hash == Hash(NRI_STRINGIFY(CommandBufferStatsInterface))) {
+        realInterfaceSize = sizeof(CommandBufferStatsInterface);
+        if (realInterfaceSize == interfaceSize)
+            result = deviceBase.FillFunctionTable(*(CommandBufferStatsInterface*)interfacePtr);
+    } else if (hash == Hash(NRI_STRINGIFY(ConditionalRenderingInterface))) {
+        realInterfaceSize = sizeof(ConditionalRenderingInterface);
+        if (realInterfaceSize == interfaceSize)
+            result = deviceBase.FillFunctionTable(*(ConditionalRenderingInterface*)interfacePtr);
+    } else if (hash == Hash(NRI_STRINGIFY(DeviceGeneratedCommandsInterface))) {
+        realInterfaceSize = sizeof(DeviceGeneratedCommandsInterface);
+        if (realInterfaceSize == interfaceSize)
+            result = deviceBase.FillFunctionTable(*(DeviceGeneratedCommandsInterface*)interfacePtr);
+    } else if (hash == Hash(NRI_STRINGIFY(FenceCallbackInterface))) {
+        realInterfaceSize = sizeof(FenceCallbackInterface);
+        if (realInterfaceSize == interfaceSize)
+            result = deviceBase.FillFunctionTable(*(FenceCallbackInterface*)interfacePtr);
     } else if (hash == Hash(NRI_STRINGIFY(ImguiInterface))) {
         realInterfaceSize = sizeof(ImguiInterface);
         if (realInterfaceSize == interfaceSize)
@@ -460,14 +476,34 @@ NRI_API Result NRI_CALL nriGetInterface(const Device& device, const char* interf
         realInterfaceSize = sizeof(MeshShaderInterface);
         if (realInterfaceSize == interfaceSize)
             result = deviceBase.FillFunctionTable(*(MeshShaderInterface*)interfacePtr);
+    } else if (hash == Hash(NRI_STRINGIFY(QueueSchedulerInterface))) {
+        realInterfaceSize = sizeof(QueueSchedulerInterface);
+        if (realInterfaceSize == interfaceSize)
+            result = deviceBase.FillFunctionTable(*(QueueSchedulerInterface*)interfacePtr);
+    } else if (hash == Hash(NRI_STRINGIFY(QueueTimelineInterface))) {
+        realInterfaceSize = sizeof(QueueTimelineInterface);
+        if (realInterfaceSize == interfaceSize)
+            result = deviceBase.FillFunctionTable(*(QueueTimelineInterface*)interfacePtr);
     } else if (hash == Hash(NRI_STRINGIFY(RayTracingInterface))) {
         realInterfaceSize = sizeof(RayTracingInterface);
         if (realInterfaceSize == interfaceSize)
             result = deviceBase.FillFunctionTable(*(RayTracingInterface*)interfacePtr);
+    } else if (hash == Hash(NRI_STRINGIFY(RenderGraphInterface))) {
+        realInterfaceSize = sizeof(RenderGraphInterface);
+        if (realInterfaceSize == interfaceSize)
+            result = deviceBase.FillFunctionTable(*(RenderGraphInterface*)interfacePtr);
     } else if (hash == Hash(NRI_STRINGIFY(ResourceAllocatorInterface))) {
         realInterfaceSize = sizeof(ResourceAllocatorInterface);
         if (realInterfaceSize == interfaceSize)
             result = deviceBase.FillFunctionTable(*(ResourceAllocatorInterface*)interfacePtr);
+    } else if (hash == Hash(NRI_STRINGIFY(SecondaryCommandBufferInterface))) {
+        realInterfaceSize = sizeof(SecondaryCommandBufferInterface);
+        if (realInterfaceSize == interfaceSize)
+            result = deviceBase.FillFunctionTable(*(SecondaryCommandBufferInterface*)interfacePtr);
+    } else if (hash == Hash(NRI_STRINGIFY(SplitBarrierInterface))) {
+        realInterfaceSize = sizeof(SplitBarrierInterface);
+        if (realInterfaceSize == interfaceSize)
+            result = deviceBase.FillFunctionTable(*(SplitBarrierInterface*)interfacePtr);
     } else if (hash == Hash(NRI_STRINGIFY(StreamerInterface))) {
         realInterfaceSize = sizeof(StreamerInterface);
         if (realInterfaceSize == interfaceSize)
@@ -607,6 +643,17 @@ NRI_API void NRI_CALL nriSetThreadName(const char*) {
 
 #endif
 
+NRI_API void NRI_CALL nriGetLockStats(LockStats& lockStats) {
+    lockStats = {};
+
+#if NRI_ENABLE_LOCK_STATS
+    lockStats.acquisitionNum = g_LockCounters.acquisitionNum.load(std::memory_order_relaxed);
+    lockStats.contendedAcquisitionNum = g_LockCounters.contendedAcquisitionNum.load(std::memory_order_relaxed);
+    lockStats.parkNum = g_LockCounters.parkNum.load(std::memory_order_relaxed);
+    lockStats.spinTime = g_LockCounters.spinTime.load(std::memory_order_relaxed);
+#endif
+}
+
 NRI_API Result NRI_CALL nriCreateDevice(const DeviceCreationDesc& deviceCreationDesc, Device*& device) {
     Result result = Result::UNSUPPORTED;
     DeviceBase* deviceImpl = nullptr;
@@ -786,6 +833,9 @@ NRI_API Result NRI_CALL nriCreateDeviceFromVKDevice(const DeviceCreationVKDesc&
     deviceCreationDesc.callbackInterface = deviceCreationVKDesc.callbackInterface;
     deviceCreationDesc.allocationCallbacks = deviceCreationVKDesc.allocationCallbacks;
     deviceCreationDesc.enableNRIValidation = deviceCreationVKDesc.enableNRIValidation;
+    deviceCreationDesc.enableVKBarrierBatching = deviceCreationVKDesc.enableVKBarrierBatching;
+    deviceCreationDesc.enableVKCommandBufferStats = deviceCreationVKDesc.enableVKCommandBufferStats;
+    deviceCreationDesc.enableVKAsyncSubmission = deviceCreationVKDesc.enableVKAsyncSubmission;
     deviceCreationDesc.vkBindingOffsets = deviceCreationVKDesc.vkBindingOffsets;
     deviceCreationDesc.vkExtensions = deviceCreationVKDesc.vkExtensions;
 
@@ -828,7 +878,13 @@ NRI_API void NRI_CALL nriDestroyDevice(Device& device) {
     if (!(&device))
         return;
 
-    ((DeviceBase&)device).Destruct();
+    DeviceBase& deviceBase = (DeviceBase&)device;
+
+    HelperInterface iHelper = {};
+    if (deviceBase.FillFunctionTable(iHelper) == Result::SUCCESS)
+        iHelper.ProcessDeferredDestroys(device, true);
+
+    deviceBase.Destruct();
 }
 
 NRI_API Format NRI_CALL nriConvertVKFormatToNRI(uint32_t vkFormat) {
@@ -81,11 +81,14 @@ Result CommandBufferD3D11::Create(ID3D11DeviceContext* precreatedContext) {
 
 void CommandBufferD3D11::Submit() {
     m_Device.GetImmediateContext()->ExecuteCommandList(m_CommandList, FALSE);
-    m_CommandList = nullptr;
+
+    if (!m_IsReusable)
+        m_CommandList = nullptr;
 }
 
-NRI_INLINE Result CommandBufferD3D11::Begin(const DescriptorPool* descriptorPool) {
+NRI_INLINE Result CommandBufferD3D11::Begin(const DescriptorPool* descriptorPool, bool isReusable) {
     m_CommandList = nullptr;
+    m_IsReusable = isReusable;
     m_Pipeline = nullptr;
     m_PipelineLayout = nullptr;
     m_IndexBuffer = nullptr;
@@ -258,6 +261,26 @@ NRI_INLINE void CommandBufferD3D11::BeginRendering(const AttachmentsDesc& attach
 
     m_DeferredContext->OMSetRenderTargets(m_RenderTargetNum, m_RenderTargets.data(), m_DepthStencil);
 
+    // Load ops ("DONT_CARE" is treated as "LOAD")
+    if (attachmentsDesc.colorOps) {
+        for (i = 0; i < m_RenderTargetNum; i++) {
+            const AttachmentOpsDesc& colorOps = attachmentsDesc.colorOps[i];
+            if (colorOps.loadOp == LoadOp::CLEAR)
+                m_DeferredContext->ClearRenderTargetView(m_RenderTargets[i], &colorOps.clearValue.color.f.x);
+        }
+    }
+
+    if (m_DepthStencil && attachmentsDesc.depthStencilOps && attachmentsDesc.depthStencilOps->loadOp == LoadOp::CLEAR) {
+        const DescriptorD3D11& descriptor = *(DescriptorD3D11*)attachmentsDesc.depthStencil;
+
+        uint32_t clearFlags = D3D11_CLEAR_DEPTH;
+        if (descriptor.IsStencilFormat())
+            clearFlags |= D3D11_CLEAR_STENCIL;
+
+        const DepthStencil& clearValue = attachmentsDesc.depthStencilOps->clearValue.depthStencil;
+        m_DeferredContext->ClearDepthStencilView(m_DepthStencil, clearFlags, clearValue.depth, clearValue.stencil);
+    }
+
 #if NRI_ENABLE_D3D_EXTENSIONS
     // Shading rate
     if (m_Device.HasNvExt() && m_Device.GetDesc().tiers.shadingRate >= 2) {
@@ -390,6 +413,16 @@ NRI_INLINE void CommandBufferD3D11::DrawIndexed(const DrawIndexedDesc& drawIndex
     m_DeferredContext->DrawIndexedInstanced(drawIndexedDesc.indexNum, drawIndexedDesc.instanceNum, drawIndexedDesc.baseIndex, drawIndexedDesc.baseVertex, drawIndexedDesc.baseInstance);
 }
 
+NRI_INLINE void CommandBufferD3D11::DrawMulti(const DrawDesc* drawDescs, uint32_t drawNum) {
+    for (uint32_t i = 0; i < drawNum; i++)
+        Draw(drawDescs[i]);
+}
+
+NRI_INLINE void CommandBufferD3D11::DrawIndexedMulti(const DrawIndexedDesc* drawIndexedDescs, uint32_t drawNum) {
+    for (uint32_t i = 0; i < drawNum; i++)
+        DrawIndexed(drawIndexedDescs[i]);
+}
+
 NRI_INLINE void CommandBufferD3D11::DrawIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
     MaybeUnused(countBuffer, countBufferOffset);
 
@@ -544,6 +577,26 @@ NRI_INLINE void CommandBufferD3D11::ReadbackTextureToBuffer(Buffer& dstBuffer, c
     CopyTexture((Texture&)dstTemp, &dstRegion, srcTexture, &srcRegion);
 }
 
+NRI_INLINE void CommandBufferD3D11::CopyBufferMulti(Buffer& dstBuffer, const Buffer& srcBuffer, const BufferCopyRegionDesc* regions, uint32_t regionNum) {
+    for (uint32_t i = 0; i < regionNum; i++)
+        CopyBuffer(dstBuffer, regions[i].dstOffset, srcBuffer, regions[i].srcOffset, regions[i].size);
+}
+
+NRI_INLINE void CommandBufferD3D11::CopyTextureMulti(Texture& dstTexture, const Texture& srcTexture, const TextureCopyRegionDesc* regions, uint32_t regionNum) {
+    for (uint32_t i = 0; i < regionNum; i++)
+        CopyTexture(dstTexture, &regions[i].dstRegion, srcTexture, &regions[i].srcRegion);
+}
+
+NRI_INLINE void CommandBufferD3D11::UploadBufferToTextureMulti(Texture& dstTexture, const Buffer& srcBuffer, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum) {
+    for (uint32_t i = 0; i < regionNum; i++)
+        UploadBufferToTexture(dstTexture, regions[i].textureRegion, srcBuffer, regions[i].dataLayout);
+}
+
+NRI_INLINE void CommandBufferD3D11::ReadbackTextureToBufferMulti(Buffer& dstBuffer, const Texture& srcTexture, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum) {
+    for (uint32_t i = 0; i < regionNum; i++)
+        ReadbackTextureToBuffer(dstBuffer, regions[i].dataLayout, srcTexture, regions[i].textureRegion);
+}
+
 NRI_INLINE void CommandBufferD3D11::ZeroBuffer(Buffer& buffer, uint64_t offset, uint64_t size) {
     const BufferD3D11& dst = (BufferD3D11&)buffer;
     ID3D11Buffer* zeroBuffer = m_Device.GetZeroBuffer();
@@ -570,6 +623,18 @@ NRI_INLINE void CommandBufferD3D11::ZeroBuffer(Buffer& buffer, uint64_t offset,
     }
 }
 
+NRI_INLINE void CommandBufferD3D11::UpdateBuffer(Buffer& buffer, uint64_t offset, const void* data, uint32_t size) {
+    const BufferD3D11& dst = (BufferD3D11&)buffer;
+
+    D3D11_BOX box = {};
+    box.left = (uint32_t)offset;
+    box.right = (uint32_t)offset + size;
+    box.bottom = 1;
+    box.back = 1;
+
+    m_DeferredContext->UpdateSubresource(dst, 0, &box, data, 0, 0);
+}
+
 NRI_INLINE void CommandBufferD3D11::ResolveTexture(Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion) {
     const TextureD3D11& dst = (TextureD3D11&)dstTexture;
     const TextureD3D11& src = (TextureD3D11&)srcTexture;
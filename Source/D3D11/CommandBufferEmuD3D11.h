@@ -60,13 +60,20 @@ struct CommandBufferEmuD3D11 final : public CommandBufferBase {
     void SetRootDescriptor(uint32_t rootDescriptorIndex, Descriptor& descriptor);
     void Draw(const DrawDesc& drawDesc);
     void DrawIndexed(const DrawIndexedDesc& drawIndexedDesc);
+    void DrawMulti(const DrawDesc* drawDescs, uint32_t drawNum);
+    void DrawIndexedMulti(const DrawIndexedDesc* drawIndexedDescs, uint32_t drawNum);
     void DrawIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset);
     void DrawIndexedIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset);
     void CopyBuffer(Buffer& dstBuffer, uint64_t dstOffset, const Buffer& srcBuffer, uint64_t srcOffset, uint64_t size);
     void CopyTexture(Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion);
     void UploadBufferToTexture(Texture& dstTexture, const TextureRegionDesc& dstRegion, const Buffer& srcBuffer, const TextureDataLayoutDesc& srcDataLayout);
     void ReadbackTextureToBuffer(Buffer& dstBuffer, const TextureDataLayoutDesc& dstDataLayout, const Texture& srcTexture, const TextureRegionDesc& srcRegion);
+    void CopyBufferMulti(Buffer& dstBuffer, const Buffer& srcBuffer, const BufferCopyRegionDesc* regions, uint32_t regionNum);
+    void CopyTextureMulti(Texture& dstTexture, const Texture& srcTexture, const TextureCopyRegionDesc* regions, uint32_t regionNum);
+    void UploadBufferToTextureMulti(Texture& dstTexture, const Buffer& srcBuffer, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum);
+    void ReadbackTextureToBufferMulti(Buffer& dstBuffer, const Texture& srcTexture, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum);
     void ZeroBuffer(Buffer& buffer, uint64_t offset, uint64_t size);
+    void UpdateBuffer(Buffer& buffer, uint64_t offset, const void* data, uint32_t size);
     void ResolveTexture(Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion);
     void Dispatch(const DispatchDesc& dispatchDesc);
     void DispatchIndirect(const Buffer& buffer, uint64_t offset);
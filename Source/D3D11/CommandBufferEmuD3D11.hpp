@@ -29,6 +29,7 @@ enum OpCode : uint32_t {
     UPLOAD_BUFFER_TO_TEXTURE,
     READBACK_TEXTURE_TO_BUFFER,
     ZERO_BUFFER,
+    UPDATE_BUFFER,
     RESOLVE_TEXTURE,
     DISPATCH,
     DISPATCH_INDIRECT,
@@ -183,6 +184,15 @@ void CommandBufferEmuD3D11::Submit() {
                 Read(m_PushBuffer, i, attachmentsDesc.colors, attachmentsDesc.colorNum);
                 Read(m_PushBuffer, i, attachmentsDesc.depthStencil);
 
+                uint32_t colorOpsNum, depthStencilOpsNum;
+                Read(m_PushBuffer, i, attachmentsDesc.colorOps, colorOpsNum);
+                Read(m_PushBuffer, i, attachmentsDesc.depthStencilOps, depthStencilOpsNum);
+
+                if (!colorOpsNum)
+                    attachmentsDesc.colorOps = nullptr;
+                if (!depthStencilOpsNum)
+                    attachmentsDesc.depthStencilOps = nullptr;
+
                 commandBuffer.BeginRendering(attachmentsDesc);
             } break;
             case END_RENDERING: {
@@ -383,6 +393,19 @@ void CommandBufferEmuD3D11::Submit() {
 
                 commandBuffer.ZeroBuffer(*buffer, offset, size);
             } break;
+            case UPDATE_BUFFER: {
+                Buffer* buffer;
+                Read(m_PushBuffer, i, buffer);
+
+                uint64_t offset;
+                Read(m_PushBuffer, i, offset);
+
+                uint8_t* data;
+                uint32_t size;
+                Read(m_PushBuffer, i, data, size);
+
+                commandBuffer.UpdateBuffer(*buffer, offset, data, size);
+            } break;
             case RESOLVE_TEXTURE: {
                 Texture* dstTexture;
                 Read(m_PushBuffer, i, dstTexture);
@@ -546,6 +569,8 @@ NRI_INLINE void CommandBufferEmuD3D11::BeginRendering(const AttachmentsDesc& att
     Push(m_PushBuffer, BEGIN_RENDERING);
     Push(m_PushBuffer, attachmentsDesc.colors, attachmentsDesc.colorNum);
     Push(m_PushBuffer, attachmentsDesc.depthStencil);
+    Push(m_PushBuffer, attachmentsDesc.colorOps, attachmentsDesc.colorOps ? attachmentsDesc.colorNum : 0);
+    Push(m_PushBuffer, attachmentsDesc.depthStencilOps, attachmentsDesc.depthStencilOps ? 1 : 0);
 }
 
 NRI_INLINE void CommandBufferEmuD3D11::EndRendering() {
@@ -606,6 +631,16 @@ NRI_INLINE void CommandBufferEmuD3D11::DrawIndexed(const DrawIndexedDesc& drawIn
     Push(m_PushBuffer, drawIndexedDesc);
 }
 
+NRI_INLINE void CommandBufferEmuD3D11::DrawMulti(const DrawDesc* drawDescs, uint32_t drawNum) {
+    for (uint32_t i = 0; i < drawNum; i++)
+        Draw(drawDescs[i]);
+}
+
+NRI_INLINE void CommandBufferEmuD3D11::DrawIndexedMulti(const DrawIndexedDesc* drawIndexedDescs, uint32_t drawNum) {
+    for (uint32_t i = 0; i < drawNum; i++)
+        DrawIndexed(drawIndexedDescs[i]);
+}
+
 NRI_INLINE void CommandBufferEmuD3D11::DrawIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
     Push(m_PushBuffer, DRAW_INDIRECT);
     Push(m_PushBuffer, &buffer);
@@ -667,6 +702,26 @@ NRI_INLINE void CommandBufferEmuD3D11::ReadbackTextureToBuffer(Buffer& dstBuffer
     Push(m_PushBuffer, srcRegion);
 }
 
+NRI_INLINE void CommandBufferEmuD3D11::CopyBufferMulti(Buffer& dstBuffer, const Buffer& srcBuffer, const BufferCopyRegionDesc* regions, uint32_t regionNum) {
+    for (uint32_t i = 0; i < regionNum; i++)
+        CopyBuffer(dstBuffer, regions[i].dstOffset, srcBuffer, regions[i].srcOffset, regions[i].size);
+}
+
+NRI_INLINE void CommandBufferEmuD3D11::CopyTextureMulti(Texture& dstTexture, const Texture& srcTexture, const TextureCopyRegionDesc* regions, uint32_t regionNum) {
+    for (uint32_t i = 0; i < regionNum; i++)
+        CopyTexture(dstTexture, &regions[i].dstRegion, srcTexture, &regions[i].srcRegion);
+}
+
+NRI_INLINE void CommandBufferEmuD3D11::UploadBufferToTextureMulti(Texture& dstTexture, const Buffer& srcBuffer, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum) {
+    for (uint32_t i = 0; i < regionNum; i++)
+        UploadBufferToTexture(dstTexture, regions[i].textureRegion, srcBuffer, regions[i].dataLayout);
+}
+
+NRI_INLINE void CommandBufferEmuD3D11::ReadbackTextureToBufferMulti(Buffer& dstBuffer, const Texture& srcTexture, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum) {
+    for (uint32_t i = 0; i < regionNum; i++)
+        ReadbackTextureToBuffer(dstBuffer, regions[i].dataLayout, srcTexture, regions[i].textureRegion);
+}
+
 NRI_INLINE void CommandBufferEmuD3D11::ZeroBuffer(Buffer& buffer, uint64_t offset, uint64_t size) {
     Push(m_PushBuffer, ZERO_BUFFER);
     Push(m_PushBuffer, &buffer);
@@ -674,6 +729,13 @@ NRI_INLINE void CommandBufferEmuD3D11::ZeroBuffer(Buffer& buffer, uint64_t offse
     Push(m_PushBuffer, size);
 }
 
+NRI_INLINE void CommandBufferEmuD3D11::UpdateBuffer(Buffer& buffer, uint64_t offset, const void* data, uint32_t size) {
+    Push(m_PushBuffer, UPDATE_BUFFER);
+    Push(m_PushBuffer, &buffer);
+    Push(m_PushBuffer, offset);
+    Push(m_PushBuffer, (uint8_t*)data, size);
+}
+
 NRI_INLINE void CommandBufferEmuD3D11::ResolveTexture(Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion) {
     TextureRegionDesc wholeResource = {};
     wholeResource.mipOffset = NULL_TEXTURE_REGION_DESC;
@@ -50,6 +50,10 @@ struct DescriptorD3D11 final : public DebugNameBase {
         return m_IsIntegerFormat;
     }
 
+    inline bool IsStencilFormat() const {
+        return m_IsStencilFormat;
+    }
+
     inline const SubresourceInfo& GetSubresourceInfo() const {
         return m_SubresourceInfo;
     }
@@ -87,6 +91,7 @@ private:
     uint32_t m_ElementNum = 0;
     DescriptorTypeDX11 m_Type = DescriptorTypeDX11::NO_SHADER_VISIBLE;
     bool m_IsIntegerFormat = false;
+    bool m_IsStencilFormat = false;
 };
 
 } // namespace nri
@@ -139,6 +139,7 @@ Result DescriptorD3D11::Create(const Texture1DViewDesc& textureViewDesc) {
 
     const FormatProps& formatProps = GetFormatProps(textureViewDesc.format);
     m_IsIntegerFormat = formatProps.isInteger;
+    m_IsStencilFormat = formatProps.isStencil;
     m_SubresourceInfo.Initialize(textureViewDesc.texture, textureViewDesc.mipOffset, remainingMips, textureViewDesc.layerOffset, remainingLayers);
 
     return Result::SUCCESS;
@@ -320,6 +321,7 @@ Result DescriptorD3D11::Create(const Texture2DViewDesc& textureViewDesc) {
 
     const FormatProps& formatProps = GetFormatProps(textureViewDesc.format);
     m_IsIntegerFormat = formatProps.isInteger;
+    m_IsStencilFormat = formatProps.isStencil;
     m_SubresourceInfo.Initialize(textureViewDesc.texture, textureViewDesc.mipOffset, remainingMips, textureViewDesc.layerOffset, remainingLayers);
 
     return Result::SUCCESS;
@@ -375,6 +377,7 @@ Result DescriptorD3D11::Create(const Texture3DViewDesc& textureViewDesc) {
 
     const FormatProps& formatProps = GetFormatProps(textureViewDesc.format);
     m_IsIntegerFormat = formatProps.isInteger;
+    m_IsStencilFormat = formatProps.isStencil;
     m_SubresourceInfo.Initialize(textureViewDesc.texture, textureViewDesc.mipOffset, remainingMips, textureViewDesc.sliceOffset, textureViewDesc.sliceNum);
 
     return Result::SUCCESS;
@@ -501,6 +504,11 @@ DescriptorD3D11::DescriptorD3D11(DeviceD3D11& device, ID3D11DepthStencilView* de
     : m_Descriptor(depthStencil)
     , m_Device(device) {
     m_Type = DescriptorTypeDX11::NO_SHADER_VISIBLE;
+
+    D3D11_DEPTH_STENCIL_VIEW_DESC desc = {};
+    depthStencil->GetDesc(&desc);
+
+    m_IsStencilFormat = GetFormatProps(DXGIFormatToNRIFormat(desc.Format)).isStencil;
 }
 
 DescriptorD3D11::DescriptorD3D11(DeviceD3D11& device, ID3D11Buffer* constantBuffer, uint32_t elementOffset, uint32_t elementNum)
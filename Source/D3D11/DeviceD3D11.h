@@ -124,6 +124,8 @@ struct DeviceD3D11 final : public DeviceBase {
     Result FillFunctionTable(CoreInterface& table) const override;
     Result FillFunctionTable(HelperInterface& table) const override;
     Result FillFunctionTable(LowLatencyInterface& table) const override;
+    Result FillFunctionTable(QueueSchedulerInterface& table) const override;
+    Result FillFunctionTable(RenderGraphInterface& table) const override;
     Result FillFunctionTable(ResourceAllocatorInterface& table) const override;
     Result FillFunctionTable(StreamerInterface& table) const override;
     Result FillFunctionTable(SwapChainInterface& table) const override;
@@ -140,6 +142,7 @@ struct DeviceD3D11 final : public DeviceBase {
 
     Result GetQueue(QueueType queueType, uint32_t queueIndex, Queue*& queue);
     Result WaitIdle();
+    Result WaitMulti(const FenceWaitDesc* fenceWaitDescs, uint32_t fenceWaitDescNum, bool waitAny, uint32_t timeout);
     Result BindBufferMemory(const BufferMemoryBindingDesc* memoryBindingDescs, uint32_t memoryBindingDescNum);
     Result BindTextureMemory(const TextureMemoryBindingDesc* memoryBindingDescs, uint32_t memoryBindingDescNum);
     FormatSupportBits GetFormatSupport(Format format) const;
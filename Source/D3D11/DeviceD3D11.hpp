@@ -666,6 +666,63 @@ NRI_INLINE Result DeviceD3D11::WaitIdle() {
     return Result::SUCCESS;
 }
 
+NRI_INLINE Result DeviceD3D11::WaitMulti(const FenceWaitDesc* fenceWaitDescs, uint32_t fenceWaitDescNum, bool waitAny, uint32_t timeout) {
+    // Fences emulated by queries can only be waited one by one, without a timeout
+    if (GetVersion() < 5) {
+        RETURN_ON_FAILURE(this, !waitAny && timeout == UINT32_MAX, Result::UNSUPPORTED, "'waitAny' and 'timeout' require 'ID3D11Fence'");
+
+        for (uint32_t i = 0; i < fenceWaitDescNum; i++)
+            ((FenceD3D11*)fenceWaitDescs[i].fence)->Wait(fenceWaitDescs[i].value);
+
+        return Result::SUCCESS;
+    }
+
+    RETURN_ON_FAILURE(this, fenceWaitDescNum <= MAXIMUM_WAIT_OBJECTS, Result::INVALID_ARGUMENT, "'fenceWaitDescNum' must be <= %u", MAXIMUM_WAIT_OBJECTS);
+
+    uint64_t deadline = GetTickCount64() + timeout;
+
+    // Fence events are reused, so a wake up can be caused by an older registration and completion is rechecked
+    while (true) {
+        HANDLE events[MAXIMUM_WAIT_OBJECTS] = {};
+        uint32_t eventNum = 0;
+        bool isAnyCompleted = false;
+
+        for (uint32_t i = 0; i < fenceWaitDescNum; i++) {
+            const FenceD3D11& fenceD3D11 = *(FenceD3D11*)fenceWaitDescs[i].fence;
+            ID3D11Fence* fence = fenceD3D11;
+            if (!fence || fence->GetCompletedValue() >= fenceWaitDescs[i].value) {
+                isAnyCompleted = true;
+                continue;
+            }
+
+            HANDLE event = fenceD3D11.GetEvent();
+            RETURN_ON_FAILURE(this, event != 0 && event != INVALID_HANDLE_VALUE, Result::FAILURE, "'fenceWaitDescs[%u].fence' has no event", i);
+
+            ResetEvent(event);
+
+            HRESULT hr = fence->SetEventOnCompletion(fenceWaitDescs[i].value, event);
+            RETURN_ON_BAD_HRESULT(this, hr, "ID3D11Fence::SetEventOnCompletion");
+
+            events[eventNum++] = event;
+        }
+
+        if (!eventNum || (waitAny && isAnyCompleted))
+            return Result::SUCCESS;
+
+        uint32_t milliseconds = INFINITE;
+        if (timeout != UINT32_MAX) {
+            uint64_t now = GetTickCount64();
+            milliseconds = now < deadline ? (uint32_t)(deadline - now) : 0;
+        }
+
+        uint32_t result = WaitForMultipleObjects(eventNum, events, waitAny ? FALSE : TRUE, milliseconds);
+        if (result == WAIT_TIMEOUT)
+            return Result::TIMEOUT;
+
+        RETURN_ON_FAILURE(this, result != WAIT_FAILED, Result::FAILURE, "WaitForMultipleObjects() failed!");
+    }
+}
+
 NRI_INLINE Result DeviceD3D11::BindBufferMemory(const BufferMemoryBindingDesc* memoryBindingDescs, uint32_t memoryBindingDescNum) {
     for (uint32_t i = 0; i < memoryBindingDescNum; i++) {
         const BufferMemoryBindingDesc& desc = memoryBindingDescs[i];
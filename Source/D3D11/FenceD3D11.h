@@ -15,10 +15,18 @@ struct FenceD3D11 final : public DebugNameBase {
         }
     }
 
+    inline operator ID3D11Fence*() const {
+        return m_Fence.GetInterface();
+    }
+
     inline DeviceD3D11& GetDevice() const {
         return m_Device;
     }
 
+    inline HANDLE GetEvent() const {
+        return m_Event;
+    }
+
     Result Create(uint64_t initialValue);
 
     //================================================================================================================
@@ -38,6 +46,7 @@ struct FenceD3D11 final : public DebugNameBase {
     void QueueSignal(uint64_t value);
     void QueueWait(uint64_t value);
     void Wait(uint64_t value);
+    void Signal(uint64_t value);
 
 private:
     DeviceD3D11& m_Device;
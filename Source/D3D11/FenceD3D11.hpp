@@ -65,3 +65,8 @@ NRI_INLINE void FenceD3D11::Wait(uint64_t value) {
         RETURN_VOID_ON_BAD_HRESULT(&m_Device, hr, "D3D11DeviceContext::GetData");
     }
 }
+
+NRI_INLINE void FenceD3D11::Signal(uint64_t) {
+    // "ID3D11Fence" can't be signaled on the host, and signaling on the immediate context deadlocks behind a pending "QueueWait" on the same fence
+    REPORT_ERROR(&m_Device, "host fence signal is not supported");
+}
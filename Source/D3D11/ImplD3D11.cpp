@@ -20,6 +20,8 @@
 
 #include "HelperInterface.h"
 #include "ImguiInterface.h"
+#include "QueueSchedulerInterface.h"
+#include "RenderGraphInterface.h"
 #include "StreamerInterface.h"
 #include "UpscalerInterface.h"
 
@@ -235,6 +237,10 @@ static Result NRI_CALL BeginCommandBuffer(CommandBuffer& commandBuffer, const De
     return ((CommandBufferD3D11&)commandBuffer).Begin(descriptorPool);
 }
 
+static Result NRI_CALL BeginReusableCommandBuffer(CommandBuffer& commandBuffer, const DescriptorPool* descriptorPool) {
+    return ((CommandBufferD3D11&)commandBuffer).Begin(descriptorPool, true);
+}
+
 static void NRI_CALL CmdSetDescriptorPool(CommandBuffer& commandBuffer, const DescriptorPool& descriptorPool) {
     ((CommandBufferD3D11&)commandBuffer).SetDescriptorPool(descriptorPool);
 }
@@ -317,6 +323,14 @@ static void NRI_CALL CmdDrawIndexed(CommandBuffer& commandBuffer, const DrawInde
     ((CommandBufferD3D11&)commandBuffer).DrawIndexed(drawIndexedDesc);
 }
 
+static void NRI_CALL CmdDrawMulti(CommandBuffer& commandBuffer, const DrawDesc* drawDescs, uint32_t drawNum) {
+    ((CommandBufferD3D11&)commandBuffer).DrawMulti(drawDescs, drawNum);
+}
+
+static void NRI_CALL CmdDrawIndexedMulti(CommandBuffer& commandBuffer, const DrawIndexedDesc* drawIndexedDescs, uint32_t drawNum) {
+    ((CommandBufferD3D11&)commandBuffer).DrawIndexedMulti(drawIndexedDescs, drawNum);
+}
+
 static void NRI_CALL CmdDrawIndirect(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
     ((CommandBufferD3D11&)commandBuffer).DrawIndirect(buffer, offset, drawNum, stride, countBuffer, countBufferOffset);
 }
@@ -353,10 +367,30 @@ static void NRI_CALL CmdReadbackTextureToBuffer(CommandBuffer& commandBuffer, Bu
     ((CommandBufferD3D11&)commandBuffer).ReadbackTextureToBuffer(dstBuffer, dstDataLayout, srcTexture, srcRegion);
 }
 
+static void NRI_CALL CmdCopyBufferMulti(CommandBuffer& commandBuffer, Buffer& dstBuffer, const Buffer& srcBuffer, const BufferCopyRegionDesc* regions, uint32_t regionNum) {
+    ((CommandBufferD3D11&)commandBuffer).CopyBufferMulti(dstBuffer, srcBuffer, regions, regionNum);
+}
+
+static void NRI_CALL CmdCopyTextureMulti(CommandBuffer& commandBuffer, Texture& dstTexture, const Texture& srcTexture, const TextureCopyRegionDesc* regions, uint32_t regionNum) {
+    ((CommandBufferD3D11&)commandBuffer).CopyTextureMulti(dstTexture, srcTexture, regions, regionNum);
+}
+
+static void NRI_CALL CmdUploadBufferToTextureMulti(CommandBuffer& commandBuffer, Texture& dstTexture, const Buffer& srcBuffer, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum) {
+    ((CommandBufferD3D11&)commandBuffer).UploadBufferToTextureMulti(dstTexture, srcBuffer, regions, regionNum);
+}
+
+static void NRI_CALL CmdReadbackTextureToBufferMulti(CommandBuffer& commandBuffer, Buffer& dstBuffer, const Texture& srcTexture, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum) {
+    ((CommandBufferD3D11&)commandBuffer).ReadbackTextureToBufferMulti(dstBuffer, srcTexture, regions, regionNum);
+}
+
 static void NRI_CALL CmdZeroBuffer(CommandBuffer& commandBuffer, Buffer& buffer, uint64_t offset, uint64_t size) {
     ((CommandBufferD3D11&)commandBuffer).ZeroBuffer(buffer, offset, size);
 }
 
+static void NRI_CALL CmdUpdateBuffer(CommandBuffer& commandBuffer, Buffer& buffer, uint64_t offset, const void* data, uint32_t size) {
+    ((CommandBufferD3D11&)commandBuffer).UpdateBuffer(buffer, offset, data, size);
+}
+
 static void NRI_CALL CmdResolveTexture(CommandBuffer& commandBuffer, Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion) {
     ((CommandBufferD3D11&)commandBuffer).ResolveTexture(dstTexture, dstRegion, srcTexture, srcRegion);
 }
@@ -421,6 +455,10 @@ static Result NRI_CALL QueueSubmit(Queue& queue, const QueueSubmitDesc& queueSub
     return ((QueueD3D11&)queue).Submit(queueSubmitDesc);
 }
 
+static Result NRI_CALL QueueSubmitMulti(Queue& queue, const QueueSubmitDesc* queueSubmitDescs, uint32_t queueSubmitDescNum) {
+    return ((QueueD3D11&)queue).SubmitMulti(queueSubmitDescs, queueSubmitDescNum);
+}
+
 static Result NRI_CALL DeviceWaitIdle(Device& device) {
     if (!(&device))
         return Result::SUCCESS;
@@ -439,6 +477,14 @@ static void NRI_CALL Wait(Fence& fence, uint64_t value) {
     ((FenceD3D11&)fence).Wait(value);
 }
 
+static void NRI_CALL Signal(Fence& fence, uint64_t value) {
+    ((FenceD3D11&)fence).Signal(value);
+}
+
+static Result NRI_CALL WaitMulti(Device& device, const FenceWaitDesc* fenceWaitDescs, uint32_t fenceWaitDescNum, bool waitAny, uint32_t timeout) {
+    return ((DeviceD3D11&)device).WaitMulti(fenceWaitDescs, fenceWaitDescNum, waitAny, timeout);
+}
+
 static void NRI_CALL UpdateDescriptorRanges(DescriptorSet& descriptorSet, uint32_t baseRange, uint32_t rangeNum, const DescriptorRangeUpdateDesc* rangeUpdateDescs) {
     ((DescriptorSetD3D11&)descriptorSet).UpdateDescriptorRanges(baseRange, rangeNum, rangeUpdateDescs);
 }
@@ -524,6 +570,10 @@ static Result NRI_CALL EmuBeginCommandBuffer(CommandBuffer& commandBuffer, const
     return ((CommandBufferEmuD3D11&)commandBuffer).Begin(descriptorPool);
 }
 
+static Result NRI_CALL EmuBeginReusableCommandBuffer(CommandBuffer& commandBuffer, const DescriptorPool* descriptorPool) {
+    return ((CommandBufferEmuD3D11&)commandBuffer).Begin(descriptorPool); // the push buffer is replayed on every submit
+}
+
 static void NRI_CALL EmuCmdSetDescriptorPool(CommandBuffer&, const DescriptorPool&) {
 }
 
@@ -605,6 +655,14 @@ static void NRI_CALL EmuCmdDrawIndexed(CommandBuffer& commandBuffer, const DrawI
     ((CommandBufferEmuD3D11&)commandBuffer).DrawIndexed(drawIndexedDesc);
 }
 
+static void NRI_CALL EmuCmdDrawMulti(CommandBuffer& commandBuffer, const DrawDesc* drawDescs, uint32_t drawNum) {
+    ((CommandBufferEmuD3D11&)commandBuffer).DrawMulti(drawDescs, drawNum);
+}
+
+static void NRI_CALL EmuCmdDrawIndexedMulti(CommandBuffer& commandBuffer, const DrawIndexedDesc* drawIndexedDescs, uint32_t drawNum) {
+    ((CommandBufferEmuD3D11&)commandBuffer).DrawIndexedMulti(drawIndexedDescs, drawNum);
+}
+
 static void NRI_CALL EmuCmdDrawIndirect(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
     ((CommandBufferEmuD3D11&)commandBuffer).DrawIndirect(buffer, offset, drawNum, stride, countBuffer, countBufferOffset);
 }
@@ -641,10 +699,30 @@ static void NRI_CALL EmuCmdReadbackTextureToBuffer(CommandBuffer& commandBuffer,
     ((CommandBufferEmuD3D11&)commandBuffer).ReadbackTextureToBuffer(dstBuffer, dstDataLayout, srcTexture, srcRegion);
 }
 
+static void NRI_CALL EmuCmdCopyBufferMulti(CommandBuffer& commandBuffer, Buffer& dstBuffer, const Buffer& srcBuffer, const BufferCopyRegionDesc* regions, uint32_t regionNum) {
+    ((CommandBufferEmuD3D11&)commandBuffer).CopyBufferMulti(dstBuffer, srcBuffer, regions, regionNum);
+}
+
+static void NRI_CALL EmuCmdCopyTextureMulti(CommandBuffer& commandBuffer, Texture& dstTexture, const Texture& srcTexture, const TextureCopyRegionDesc* regions, uint32_t regionNum) {
+    ((CommandBufferEmuD3D11&)commandBuffer).CopyTextureMulti(dstTexture, srcTexture, regions, regionNum);
+}
+
+static void NRI_CALL EmuCmdUploadBufferToTextureMulti(CommandBuffer& commandBuffer, Texture& dstTexture, const Buffer& srcBuffer, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum) {
+    ((CommandBufferEmuD3D11&)commandBuffer).UploadBufferToTextureMulti(dstTexture, srcBuffer, regions, regionNum);
+}
+
+static void NRI_CALL EmuCmdReadbackTextureToBufferMulti(CommandBuffer& commandBuffer, Buffer& dstBuffer, const Texture& srcTexture, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum) {
+    ((CommandBufferEmuD3D11&)commandBuffer).ReadbackTextureToBufferMulti(dstBuffer, srcTexture, regions, regionNum);
+}
+
 static void NRI_CALL EmuCmdFillBuffer(CommandBuffer& commandBuffer, Buffer& buffer, uint64_t offset, uint64_t size) {
     ((CommandBufferEmuD3D11&)commandBuffer).ZeroBuffer(buffer, offset, size);
 }
 
+static void NRI_CALL EmuCmdUpdateBuffer(CommandBuffer& commandBuffer, Buffer& buffer, uint64_t offset, const void* data, uint32_t size) {
+    ((CommandBufferEmuD3D11&)commandBuffer).UpdateBuffer(buffer, offset, data, size);
+}
+
 static void NRI_CALL EmuCmdResolveTexture(CommandBuffer& commandBuffer, Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion) {
     ((CommandBufferEmuD3D11&)commandBuffer).ResolveTexture(dstTexture, dstRegion, srcTexture, srcRegion);
 }
@@ -748,7 +826,10 @@ Result DeviceD3D11::FillFunctionTable(CoreInterface& table) const {
     table.DeviceWaitIdle = ::DeviceWaitIdle;
     table.QueueWaitIdle = ::QueueWaitIdle;
     table.QueueSubmit = ::QueueSubmit;
+    table.QueueSubmitMulti = ::QueueSubmitMulti;
     table.Wait = ::Wait;
+    table.WaitMulti = ::WaitMulti;
+    table.Signal = ::Signal;
     table.GetFenceValue = ::GetFenceValue;
     table.UpdateDescriptorRanges = ::UpdateDescriptorRanges;
     table.UpdateDynamicConstantBuffers = ::UpdateDynamicConstantBuffers;
@@ -767,6 +848,7 @@ Result DeviceD3D11::FillFunctionTable(CoreInterface& table) const {
 
     if (m_IsDeferredContextEmulated) {
         table.BeginCommandBuffer = ::EmuBeginCommandBuffer;
+        table.BeginReusableCommandBuffer = ::EmuBeginReusableCommandBuffer;
         table.CmdSetDescriptorPool = ::EmuCmdSetDescriptorPool;
         table.CmdSetDescriptorSet = ::EmuCmdSetDescriptorSet;
         table.CmdSetPipelineLayout = ::EmuCmdSetPipelineLayout;
@@ -788,6 +870,8 @@ Result DeviceD3D11::FillFunctionTable(CoreInterface& table) const {
         table.CmdClearAttachments = ::EmuCmdClearAttachments;
         table.CmdDraw = ::EmuCmdDraw;
         table.CmdDrawIndexed = ::EmuCmdDrawIndexed;
+        table.CmdDrawMulti = ::EmuCmdDrawMulti;
+        table.CmdDrawIndexedMulti = ::EmuCmdDrawIndexedMulti;
         table.CmdDrawIndirect = ::EmuCmdDrawIndirect;
         table.CmdDrawIndexedIndirect = ::EmuCmdDrawIndexedIndirect;
         table.CmdEndRendering = ::EmuCmdEndRendering;
@@ -798,6 +882,11 @@ Result DeviceD3D11::FillFunctionTable(CoreInterface& table) const {
         table.CmdUploadBufferToTexture = ::EmuCmdUploadBufferToTexture;
         table.CmdReadbackTextureToBuffer = ::EmuCmdReadbackTextureToBuffer;
         table.CmdZeroBuffer = ::EmuCmdFillBuffer;
+        table.CmdUpdateBuffer = ::EmuCmdUpdateBuffer;
+        table.CmdCopyBufferMulti = ::EmuCmdCopyBufferMulti;
+        table.CmdCopyTextureMulti = ::EmuCmdCopyTextureMulti;
+        table.CmdUploadBufferToTextureMulti = ::EmuCmdUploadBufferToTextureMulti;
+        table.CmdReadbackTextureToBufferMulti = ::EmuCmdReadbackTextureToBufferMulti;
         table.CmdResolveTexture = ::EmuCmdResolveTexture;
         table.CmdClearStorage = ::EmuCmdClearStorage;
         table.CmdResetQueries = ::EmuCmdResetQueries;
@@ -811,6 +900,7 @@ Result DeviceD3D11::FillFunctionTable(CoreInterface& table) const {
         table.GetCommandBufferNativeObject = ::EmuGetCommandBufferNativeObject;
     } else {
         table.BeginCommandBuffer = ::BeginCommandBuffer;
+        table.BeginReusableCommandBuffer = ::BeginReusableCommandBuffer;
         table.CmdSetDescriptorPool = ::CmdSetDescriptorPool;
         table.CmdSetDescriptorSet = ::CmdSetDescriptorSet;
         table.CmdSetPipelineLayout = ::CmdSetPipelineLayout;
@@ -832,6 +922,8 @@ Result DeviceD3D11::FillFunctionTable(CoreInterface& table) const {
         table.CmdClearAttachments = ::CmdClearAttachments;
         table.CmdDraw = ::CmdDraw;
         table.CmdDrawIndexed = ::CmdDrawIndexed;
+        table.CmdDrawMulti = ::CmdDrawMulti;
+        table.CmdDrawIndexedMulti = ::CmdDrawIndexedMulti;
         table.CmdDrawIndirect = ::CmdDrawIndirect;
         table.CmdDrawIndexedIndirect = ::CmdDrawIndexedIndirect;
         table.CmdEndRendering = ::CmdEndRendering;
@@ -842,6 +934,11 @@ Result DeviceD3D11::FillFunctionTable(CoreInterface& table) const {
         table.CmdUploadBufferToTexture = ::CmdUploadBufferToTexture;
         table.CmdReadbackTextureToBuffer = ::CmdReadbackTextureToBuffer;
         table.CmdZeroBuffer = ::CmdZeroBuffer;
+        table.CmdUpdateBuffer = ::CmdUpdateBuffer;
+        table.CmdCopyBufferMulti = ::CmdCopyBufferMulti;
+        table.CmdCopyTextureMulti = ::CmdCopyTextureMulti;
+        table.CmdUploadBufferToTextureMulti = ::CmdUploadBufferToTextureMulti;
+        table.CmdReadbackTextureToBufferMulti = ::CmdReadbackTextureToBufferMulti;
         table.CmdResolveTexture = ::CmdResolveTexture;
         table.CmdClearStorage = ::CmdClearStorage;
         table.CmdResetQueries = ::CmdResetQueries;
@@ -891,11 +988,72 @@ static Result NRI_CALL QueryVideoMemoryInfo(const Device& device, MemoryLocation
     return QueryVideoMemoryInfoDXGI(luid, memoryLocation, videoMemoryInfo);
 }
 
+static void NRI_CALL DestroyDeferred(Device& device, const DeferredDestroyDesc* deferredDestroyDescs, uint32_t deferredDestroyDescNum) {
+    DeviceD3D11& deviceD3D11 = (DeviceD3D11&)device;
+    HelperDeferredDestroyer deferredDestroyer(deviceD3D11.GetCoreInterface(), device);
+
+    deferredDestroyer.DestroyDeferred(deferredDestroyDescs, deferredDestroyDescNum);
+}
+
+static void NRI_CALL ProcessDeferredDestroys(Device& device, bool all) {
+    DeviceD3D11& deviceD3D11 = (DeviceD3D11&)device;
+    HelperDeferredDestroyer deferredDestroyer(deviceD3D11.GetCoreInterface(), device);
+
+    deferredDestroyer.ProcessDeferredDestroys(all);
+}
+
+static Result NRI_CALL CreateFrameContext(Device& device, const FrameContextDesc& frameContextDesc, FrameContext*& frameContext) {
+    DeviceD3D11& deviceD3D11 = (DeviceD3D11&)device;
+    FrameContextImpl* impl = Allocate<FrameContextImpl>(deviceD3D11.GetAllocationCallbacks(), device, deviceD3D11.GetCoreInterface());
+    Result result = impl->Create(frameContextDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        frameContext = nullptr;
+    } else
+        frameContext = (FrameContext*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyFrameContext(FrameContext& frameContext) {
+    Destroy((FrameContextImpl*)&frameContext);
+}
+
+static uint32_t NRI_CALL BeginFrameContext(FrameContext& frameContext) {
+    return ((FrameContextImpl&)frameContext).BeginFrame();
+}
+
+static Result NRI_CALL EndFrameContext(FrameContext& frameContext) {
+    return ((FrameContextImpl&)frameContext).EndFrame();
+}
+
+static CommandAllocator* NRI_CALL GetFrameCommandAllocator(const FrameContext& frameContext, uint32_t threadIndex) {
+    return ((FrameContextImpl&)frameContext).GetCommandAllocator(threadIndex);
+}
+
+static CommandBuffer* NRI_CALL GetFrameCommandBuffer(const FrameContext& frameContext, uint32_t threadIndex, uint32_t commandBufferIndex) {
+    return ((FrameContextImpl&)frameContext).GetCommandBuffer(threadIndex, commandBufferIndex);
+}
+
+static DescriptorPool* NRI_CALL GetFrameDescriptorPool(const FrameContext& frameContext, uint32_t threadIndex) {
+    return ((FrameContextImpl&)frameContext).GetDescriptorPool(threadIndex);
+}
+
 Result DeviceD3D11::FillFunctionTable(HelperInterface& table) const {
     table.CalculateAllocationNumber = ::CalculateAllocationNumber;
     table.AllocateAndBindMemory = ::AllocateAndBindMemory;
     table.UploadData = ::UploadData;
     table.QueryVideoMemoryInfo = ::QueryVideoMemoryInfo;
+    table.DestroyDeferred = ::DestroyDeferred;
+    table.ProcessDeferredDestroys = ::ProcessDeferredDestroys;
+    table.CreateFrameContext = ::CreateFrameContext;
+    table.DestroyFrameContext = ::DestroyFrameContext;
+    table.BeginFrameContext = ::BeginFrameContext;
+    table.EndFrameContext = ::EndFrameContext;
+    table.GetFrameCommandAllocator = ::GetFrameCommandAllocator;
+    table.GetFrameCommandBuffer = ::GetFrameCommandBuffer;
+    table.GetFrameDescriptorPool = ::GetFrameDescriptorPool;
 
     return Result::SUCCESS;
 }
@@ -988,6 +1146,94 @@ Result DeviceD3D11::FillFunctionTable(LowLatencyInterface& table) const {
 
 #pragma endregion
 
+//============================================================================================================================================================================================
+#pragma region[  QueueScheduler  ]
+
+static Result NRI_CALL CreateQueueScheduler(Device& device, QueueScheduler*& queueScheduler) {
+    DeviceD3D11& deviceD3D11 = (DeviceD3D11&)device;
+    QueueSchedulerImpl* impl = Allocate<QueueSchedulerImpl>(deviceD3D11.GetAllocationCallbacks(), device, deviceD3D11.GetCoreInterface());
+    Result result = impl->Create();
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        queueScheduler = nullptr;
+    } else
+        queueScheduler = (QueueScheduler*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyQueueScheduler(QueueScheduler& queueScheduler) {
+    Destroy((QueueSchedulerImpl*)&queueScheduler);
+}
+
+static Queue* NRI_CALL GetQueueSchedulerQueue(const QueueScheduler& queueScheduler, QueueType queueType) {
+    return ((QueueSchedulerImpl&)queueScheduler).GetQueue(queueType);
+}
+
+static Result NRI_CALL SubmitSchedule(QueueScheduler& queueScheduler, const ScheduleDesc& scheduleDesc) {
+    return ((QueueSchedulerImpl&)queueScheduler).Submit(scheduleDesc);
+}
+
+Result DeviceD3D11::FillFunctionTable(QueueSchedulerInterface& table) const {
+    table.CreateQueueScheduler = ::CreateQueueScheduler;
+    table.DestroyQueueScheduler = ::DestroyQueueScheduler;
+    table.GetQueueSchedulerQueue = ::GetQueueSchedulerQueue;
+    table.SubmitSchedule = ::SubmitSchedule;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  RenderGraph  ]
+
+static Result NRI_CALL CreateRenderGraph(Device& device, RenderGraph*& renderGraph) {
+    DeviceD3D11& deviceD3D11 = (DeviceD3D11&)device;
+    renderGraph = (RenderGraph*)Allocate<RenderGraphImpl>(deviceD3D11.GetAllocationCallbacks(), device, deviceD3D11.GetCoreInterface());
+
+    return Result::SUCCESS;
+}
+
+static void NRI_CALL DestroyRenderGraph(RenderGraph& renderGraph) {
+    Destroy((RenderGraphImpl*)&renderGraph);
+}
+
+static Result NRI_CALL CompileRenderGraph(RenderGraph& renderGraph, const RenderGraphDesc& renderGraphDesc) {
+    return ((RenderGraphImpl&)renderGraph).Compile(renderGraphDesc);
+}
+
+static Texture* NRI_CALL GetRenderGraphTexture(const RenderGraph& renderGraph, uint32_t resourceIndex) {
+    return ((RenderGraphImpl&)renderGraph).GetTexture(resourceIndex);
+}
+
+static Buffer* NRI_CALL GetRenderGraphBuffer(const RenderGraph& renderGraph, uint32_t resourceIndex) {
+    return ((RenderGraphImpl&)renderGraph).GetBuffer(resourceIndex);
+}
+
+static void NRI_CALL GetRenderGraphStats(const RenderGraph& renderGraph, RenderGraphStats& renderGraphStats) {
+    ((RenderGraphImpl&)renderGraph).GetStats(renderGraphStats);
+}
+
+static void NRI_CALL CmdExecuteRenderGraph(CommandBuffer& commandBuffer, const RenderGraph& renderGraph) {
+    ((RenderGraphImpl&)renderGraph).CmdExecute(commandBuffer);
+}
+
+Result DeviceD3D11::FillFunctionTable(RenderGraphInterface& table) const {
+    table.CreateRenderGraph = ::CreateRenderGraph;
+    table.DestroyRenderGraph = ::DestroyRenderGraph;
+    table.CompileRenderGraph = ::CompileRenderGraph;
+    table.GetRenderGraphTexture = ::GetRenderGraphTexture;
+    table.GetRenderGraphBuffer = ::GetRenderGraphBuffer;
+    table.GetRenderGraphStats = ::GetRenderGraphStats;
+    table.CmdExecuteRenderGraph = ::CmdExecuteRenderGraph;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
 //============================================================================================================================================================================================
 #pragma region[  ResourceAllocator  ]
 
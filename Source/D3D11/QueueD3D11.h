@@ -21,6 +21,7 @@ struct QueueD3D11 final : public DebugNameBase {
     //================================================================================================================
 
     Result Submit(const QueueSubmitDesc& queueSubmitDesc);
+    Result SubmitMulti(const QueueSubmitDesc* queueSubmitDescs, uint32_t queueSubmitDescNum);
     Result WaitIdle();
 
 private:
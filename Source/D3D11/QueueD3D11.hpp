@@ -21,6 +21,16 @@ NRI_INLINE Result QueueD3D11::Submit(const QueueSubmitDesc& queueSubmitDesc) {
     return Result::SUCCESS;
 }
 
+NRI_INLINE Result QueueD3D11::SubmitMulti(const QueueSubmitDesc* queueSubmitDescs, uint32_t queueSubmitDescNum) {
+    for (uint32_t i = 0; i < queueSubmitDescNum; i++) {
+        Result result = Submit(queueSubmitDescs[i]);
+        if (result != Result::SUCCESS)
+            return result;
+    }
+
+    return Result::SUCCESS;
+}
+
 NRI_INLINE Result QueueD3D11::WaitIdle() {
     FenceD3D11* fence = nullptr;
     Result result = m_Device.CreateImplementation<FenceD3D11>(fence, 0);
@@ -426,6 +426,26 @@ NRI_INLINE void CommandBufferD3D12::BeginRendering(const AttachmentsDesc& attach
 
     m_GraphicsCommandList->OMSetRenderTargets(m_RenderTargetNum, m_RenderTargets.data(), FALSE, m_DepthStencil.ptr ? &m_DepthStencil : nullptr);
 
+    // Load ops ("DONT_CARE" is treated as "LOAD")
+    if (attachmentsDesc.colorOps) {
+        for (i = 0; i < m_RenderTargetNum; i++) {
+            const AttachmentOpsDesc& colorOps = attachmentsDesc.colorOps[i];
+            if (colorOps.loadOp == LoadOp::CLEAR)
+                m_GraphicsCommandList->ClearRenderTargetView(m_RenderTargets[i], &colorOps.clearValue.color.f.x, 0, nullptr);
+        }
+    }
+
+    if (m_DepthStencil.ptr && attachmentsDesc.depthStencilOps && attachmentsDesc.depthStencilOps->loadOp == LoadOp::CLEAR) {
+        const DescriptorD3D12& descriptor = *(DescriptorD3D12*)attachmentsDesc.depthStencil;
+
+        D3D12_CLEAR_FLAGS clearFlags = D3D12_CLEAR_FLAG_DEPTH;
+        if (descriptor.IsStencilFormat())
+            clearFlags |= D3D12_CLEAR_FLAG_STENCIL;
+
+        const DepthStencil& clearValue = attachmentsDesc.depthStencilOps->clearValue.depthStencil;
+        m_GraphicsCommandList->ClearDepthStencilView(m_DepthStencil, clearFlags, clearValue.depth, clearValue.stencil, 0, nullptr);
+    }
+
     // Shading rate
     if (m_Device.GetDesc().tiers.shadingRate >= 2) {
         ID3D12Resource* shadingRateImage = nullptr;
@@ -560,6 +580,16 @@ NRI_INLINE void CommandBufferD3D12::DrawIndexed(const DrawIndexedDesc& drawIndex
     m_GraphicsCommandList->DrawIndexedInstanced(drawIndexedDesc.indexNum, drawIndexedDesc.instanceNum, drawIndexedDesc.baseIndex, drawIndexedDesc.baseVertex, drawIndexedDesc.baseInstance);
 }
 
+NRI_INLINE void CommandBufferD3D12::DrawMulti(const DrawDesc* drawDescs, uint32_t drawNum) {
+    for (uint32_t i = 0; i < drawNum; i++)
+        Draw(drawDescs[i]);
+}
+
+NRI_INLINE void CommandBufferD3D12::DrawIndexedMulti(const DrawIndexedDesc* drawIndexedDescs, uint32_t drawNum) {
+    for (uint32_t i = 0; i < drawNum; i++)
+        DrawIndexed(drawIndexedDescs[i]);
+}
+
 NRI_INLINE void CommandBufferD3D12::DrawIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
     ID3D12Resource* pCountBuffer = nullptr;
     if (countBuffer)
@@ -682,6 +712,21 @@ NRI_INLINE void CommandBufferD3D12::ZeroBuffer(Buffer& buffer, uint64_t offset,
 #endif
 }
 
+NRI_INLINE void CommandBufferD3D12::UpdateBuffer(Buffer& buffer, uint64_t offset, const void* data, uint32_t size) {
+    const BufferD3D12& dst = (BufferD3D12&)buffer;
+    D3D12_GPU_VIRTUAL_ADDRESS dstAddress = dst.GetPointerGPU() + offset;
+
+    // "WriteBufferImmediate" writes 32-bit values only
+    uint32_t num = size / sizeof(uint32_t);
+    Scratch<D3D12_WRITEBUFFERIMMEDIATE_PARAMETER> params = AllocateScratch(m_Device, D3D12_WRITEBUFFERIMMEDIATE_PARAMETER, num);
+    for (uint32_t i = 0; i < num; i++) {
+        params[i].Dest = dstAddress + i * sizeof(uint32_t);
+        params[i].Value = ((const uint32_t*)data)[i];
+    }
+
+    m_GraphicsCommandList->WriteBufferImmediate(num, params, nullptr);
+}
+
 NRI_INLINE void CommandBufferD3D12::ResolveTexture(Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion) {
     const TextureD3D12& dst = (TextureD3D12&)dstTexture;
     const TextureD3D12& src = (TextureD3D12&)srcTexture;
@@ -782,6 +827,26 @@ NRI_INLINE void CommandBufferD3D12::ReadbackTextureToBuffer(Buffer& dstBuffer, c
     m_GraphicsCommandList->CopyTextureRegion(&dstTextureCopyLocation, 0, 0, 0, &srcTextureCopyLocation, &srcBox);
 }
 
+NRI_INLINE void CommandBufferD3D12::CopyBufferMulti(Buffer& dstBuffer, const Buffer& srcBuffer, const BufferCopyRegionDesc* regions, uint32_t regionNum) {
+    for (uint32_t i = 0; i < regionNum; i++)
+        CopyBuffer(dstBuffer, regions[i].dstOffset, srcBuffer, regions[i].srcOffset, regions[i].size);
+}
+
+NRI_INLINE void CommandBufferD3D12::CopyTextureMulti(Texture& dstTexture, const Texture& srcTexture, const TextureCopyRegionDesc* regions, uint32_t regionNum) {
+    for (uint32_t i = 0; i < regionNum; i++)
+        CopyTexture(dstTexture, &regions[i].dstRegion, srcTexture, &regions[i].srcRegion);
+}
+
+NRI_INLINE void CommandBufferD3D12::UploadBufferToTextureMulti(Texture& dstTexture, const Buffer& srcBuffer, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum) {
+    for (uint32_t i = 0; i < regionNum; i++)
+        UploadBufferToTexture(dstTexture, regions[i].textureRegion, srcBuffer, regions[i].dataLayout);
+}
+
+NRI_INLINE void CommandBufferD3D12::ReadbackTextureToBufferMulti(Buffer& dstBuffer, const Texture& srcTexture, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum) {
+    for (uint32_t i = 0; i < regionNum; i++)
+        ReadbackTextureToBuffer(dstBuffer, regions[i].dataLayout, srcTexture, regions[i].textureRegion);
+}
+
 NRI_INLINE void CommandBufferD3D12::Dispatch(const DispatchDesc& dispatchDesc) {
     m_GraphicsCommandList->Dispatch(dispatchDesc.x, dispatchDesc.y, dispatchDesc.z);
 }
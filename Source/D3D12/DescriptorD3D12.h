@@ -35,6 +35,10 @@ struct DescriptorD3D12 final : public DebugNameBase {
         return m_IsIntegerFormat;
     }
 
+    inline bool IsStencilFormat() const {
+        return m_IsStencilFormat;
+    }
+
     inline bool IsAccelerationStructure() const {
         return m_IsAccelerationStructure;
     }
@@ -55,7 +59,7 @@ private:
     Result CreateShaderResourceView(ID3D12Resource* resource, const D3D12_SHADER_RESOURCE_VIEW_DESC& desc);
     Result CreateUnorderedAccessView(ID3D12Resource* resource, const D3D12_UNORDERED_ACCESS_VIEW_DESC& desc, Format format);
     Result CreateRenderTargetView(ID3D12Resource* resource, const D3D12_RENDER_TARGET_VIEW_DESC& desc);
-    Result CreateDepthStencilView(ID3D12Resource* resource, const D3D12_DEPTH_STENCIL_VIEW_DESC& desc);
+    Result CreateDepthStencilView(ID3D12Resource* resource, const D3D12_DEPTH_STENCIL_VIEW_DESC& desc, Format format);
 
 private:
     DeviceD3D12& m_Device;
@@ -65,6 +69,7 @@ private:
     DescriptorHandle m_Handle = {};
     BufferViewType m_BufferViewType = BufferViewType::MAX_NUM;
     bool m_IsIntegerFormat = false;
+    bool m_IsStencilFormat = false;
     bool m_IsAccelerationStructure = false;
 };
 
@@ -119,7 +119,7 @@ Result DescriptorD3D12::Create(const Texture1DViewDesc& textureViewDesc) {
             else if (textureViewDesc.viewType == Texture1DViewType::DEPTH_STENCIL_READONLY)
                 desc.Flags = D3D12_DSV_FLAG_READ_ONLY_DEPTH | D3D12_DSV_FLAG_READ_ONLY_STENCIL;
 
-            return CreateDepthStencilView(texture, desc);
+            return CreateDepthStencilView(texture, desc, textureViewDesc.format);
         }
     }
 
@@ -252,7 +252,7 @@ Result DescriptorD3D12::Create(const Texture2DViewDesc& textureViewDesc) {
             else if (textureViewDesc.viewType == Texture2DViewType::DEPTH_STENCIL_READONLY)
                 desc.Flags = D3D12_DSV_FLAG_READ_ONLY_DEPTH | D3D12_DSV_FLAG_READ_ONLY_STENCIL;
 
-            return CreateDepthStencilView(texture, desc);
+            return CreateDepthStencilView(texture, desc, textureViewDesc.format);
         }
         case Texture2DViewType::SHADING_RATE_ATTACHMENT: {
             m_Resource = texture; // a resource view is not needed
@@ -485,12 +485,13 @@ Result DescriptorD3D12::CreateRenderTargetView(ID3D12Resource* resource, const D
     return result;
 }
 
-Result DescriptorD3D12::CreateDepthStencilView(ID3D12Resource* resource, const D3D12_DEPTH_STENCIL_VIEW_DESC& desc) {
+Result DescriptorD3D12::CreateDepthStencilView(ID3D12Resource* resource, const D3D12_DEPTH_STENCIL_VIEW_DESC& desc, Format format) {
     Result result = m_Device.GetDescriptorHandle(D3D12_DESCRIPTOR_HEAP_TYPE_DSV, m_Handle);
     if (result == Result::SUCCESS) {
         m_DescriptorPointerCPU = m_Device.GetDescriptorPointerCPU(m_Handle);
         m_Device->CreateDepthStencilView(resource, &desc, {m_DescriptorPointerCPU});
         m_Resource = resource;
+        m_IsStencilFormat = GetFormatProps(format).isStencil;
     }
 
     return result;
@@ -745,6 +745,7 @@ void DeviceD3D12::FillDesc(bool disableD3D12EnhancedBarrier) {
     m_Desc.features.viewportBasedMultiview = options3.ViewInstancingTier != D3D12_VIEW_INSTANCING_TIER_NOT_SUPPORTED;
     m_Desc.features.waitableSwapChain = true; // TODO: swap chain version >= 2?
     m_Desc.features.pipelineStatistics = true;
+    m_Desc.features.hostFenceSignal = true;
 
     bool isShaderAtomicsF16Supported = false;
     bool isShaderAtomicsF32Supported = false;
@@ -1240,6 +1241,40 @@ NRI_INLINE Result DeviceD3D12::WaitIdle() {
     return Result::SUCCESS;
 }
 
+NRI_INLINE Result DeviceD3D12::WaitMulti(const FenceWaitDesc* fenceWaitDescs, uint32_t fenceWaitDescNum, bool waitAny, uint32_t timeout) {
+    Scratch<ID3D12Fence*> fences = AllocateScratch(*this, ID3D12Fence*, fenceWaitDescNum);
+    Scratch<uint64_t> values = AllocateScratch(*this, uint64_t, fenceWaitDescNum);
+    for (uint32_t i = 0; i < fenceWaitDescNum; i++) {
+        fences[i] = *(FenceD3D12*)fenceWaitDescs[i].fence;
+        values[i] = fenceWaitDescs[i].value;
+    }
+
+    HANDLE event = CreateEventA(nullptr, FALSE, FALSE, nullptr);
+    RETURN_ON_FAILURE(this, event != 0, Result::FAILURE, "CreateEventA() failed!");
+
+    D3D12_MULTIPLE_FENCE_WAIT_FLAGS flags = waitAny ? D3D12_MULTIPLE_FENCE_WAIT_FLAG_ANY : D3D12_MULTIPLE_FENCE_WAIT_FLAG_ALL;
+    HRESULT hr = m_Device->SetEventOnMultipleFenceCompletion(fences, values, fenceWaitDescNum, flags, event);
+
+    uint32_t result = WAIT_FAILED;
+    if (SUCCEEDED(hr))
+        result = WaitForSingleObjectEx(event, timeout == UINT32_MAX ? INFINITE : timeout, TRUE);
+
+    CloseHandle(event);
+
+    RETURN_ON_BAD_HRESULT(this, hr, "ID3D12Device1::SetEventOnMultipleFenceCompletion");
+
+    if (result == WAIT_TIMEOUT)
+        return Result::TIMEOUT;
+
+    RETURN_ON_FAILURE(this, result == WAIT_OBJECT_0, Result::FAILURE, "WaitForSingleObjectEx() failed!");
+
+    // Is device lost?
+    hr = m_Device->GetDeviceRemovedReason() == S_OK ? S_OK : DXGI_ERROR_DEVICE_REMOVED;
+    RETURN_ON_BAD_HRESULT(this, hr, "WaitMulti");
+
+    return Result::SUCCESS;
+}
+
 NRI_INLINE Result DeviceD3D12::BindBufferMemory(const BufferMemoryBindingDesc* memoryBindingDescs, uint32_t memoryBindingDescNum) {
     for (uint32_t i = 0; i < memoryBindingDescNum; i++) {
         Result result = ((BufferD3D12*)memoryBindingDescs[i].buffer)->BindMemory((MemoryD3D12*)memoryBindingDescs[i].memory, memoryBindingDescs[i].offset);
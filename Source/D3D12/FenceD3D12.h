@@ -16,6 +16,10 @@ struct FenceD3D12 final : public DebugNameBase {
             CloseHandle(m_Event);
     }
 
+    inline operator ID3D12Fence*() const {
+        return m_Fence.GetInterface();
+    }
+
     inline DeviceD3D12& GetDevice() const {
         return m_Device;
     }
@@ -38,6 +42,7 @@ struct FenceD3D12 final : public DebugNameBase {
     void QueueSignal(QueueD3D12& queue, uint64_t value);
     void QueueWait(QueueD3D12& queue, uint64_t value);
     void Wait(uint64_t value);
+    void Signal(uint64_t value);
 
 private:
     DeviceD3D12& m_Device;
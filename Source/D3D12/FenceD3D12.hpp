@@ -44,3 +44,10 @@ NRI_INLINE void FenceD3D12::Wait(uint64_t value) {
         RETURN_ON_FAILURE(&m_Device, result == WAIT_OBJECT_0, ReturnVoid(), "WaitForSingleObjectEx() failed!");
     }
 }
+
+NRI_INLINE void FenceD3D12::Signal(uint64_t value) {
+    if (m_Fence) {
+        HRESULT hr = m_Fence->Signal(value);
+        RETURN_VOID_ON_BAD_HRESULT(&m_Device, hr, "ID3D12Fence::Signal");
+    }
+}
@@ -21,6 +21,8 @@
 
 #include "HelperInterface.h"
 #include "ImguiInterface.h"
+#include "QueueSchedulerInterface.h"
+#include "RenderGraphInterface.h"
 #include "StreamerInterface.h"
 #include "UpscalerInterface.h"
 
@@ -249,6 +251,10 @@ static Result NRI_CALL BeginCommandBuffer(CommandBuffer& commandBuffer, const De
     return ((CommandBufferD3D12&)commandBuffer).Begin(descriptorPool);
 }
 
+static Result NRI_CALL BeginReusableCommandBuffer(CommandBuffer& commandBuffer, const DescriptorPool* descriptorPool) {
+    return ((CommandBufferD3D12&)commandBuffer).Begin(descriptorPool); // command lists are always reusable
+}
+
 static void NRI_CALL CmdSetDescriptorPool(CommandBuffer& commandBuffer, const DescriptorPool& descriptorPool) {
     ((CommandBufferD3D12&)commandBuffer).SetDescriptorPool(descriptorPool);
 }
@@ -333,6 +339,14 @@ static void NRI_CALL CmdDrawIndexed(CommandBuffer& commandBuffer, const DrawInde
     ((CommandBufferD3D12&)commandBuffer).DrawIndexed(drawIndexedDesc);
 }
 
+static void NRI_CALL CmdDrawMulti(CommandBuffer& commandBuffer, const DrawDesc* drawDescs, uint32_t drawNum) {
+    ((CommandBufferD3D12&)commandBuffer).DrawMulti(drawDescs, drawNum);
+}
+
+static void NRI_CALL CmdDrawIndexedMulti(CommandBuffer& commandBuffer, const DrawIndexedDesc* drawIndexedDescs, uint32_t drawNum) {
+    ((CommandBufferD3D12&)commandBuffer).DrawIndexedMulti(drawIndexedDescs, drawNum);
+}
+
 static void NRI_CALL CmdDrawIndirect(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
     ((CommandBufferD3D12&)commandBuffer).DrawIndirect(buffer, offset, drawNum, stride, countBuffer, countBufferOffset);
 }
@@ -369,10 +383,30 @@ static void NRI_CALL CmdReadbackTextureToBuffer(CommandBuffer& commandBuffer, Bu
     ((CommandBufferD3D12&)commandBuffer).ReadbackTextureToBuffer(dstBuffer, dstDataLayout, srcTexture, srcRegion);
 }
 
+static void NRI_CALL CmdCopyBufferMulti(CommandBuffer& commandBuffer, Buffer& dstBuffer, const Buffer& srcBuffer, const BufferCopyRegionDesc* regions, uint32_t regionNum) {
+    ((CommandBufferD3D12&)commandBuffer).CopyBufferMulti(dstBuffer, srcBuffer, regions, regionNum);
+}
+
+static void NRI_CALL CmdCopyTextureMulti(CommandBuffer& commandBuffer, Texture& dstTexture, const Texture& srcTexture, const TextureCopyRegionDesc* regions, uint32_t regionNum) {
+    ((CommandBufferD3D12&)commandBuffer).CopyTextureMulti(dstTexture, srcTexture, regions, regionNum);
+}
+
+static void NRI_CALL CmdUploadBufferToTextureMulti(CommandBuffer& commandBuffer, Texture& dstTexture, const Buffer& srcBuffer, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum) {
+    ((CommandBufferD3D12&)commandBuffer).UploadBufferToTextureMulti(dstTexture, srcBuffer, regions, regionNum);
+}
+
+static void NRI_CALL CmdReadbackTextureToBufferMulti(CommandBuffer& commandBuffer, Buffer& dstBuffer, const Texture& srcTexture, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum) {
+    ((CommandBufferD3D12&)commandBuffer).ReadbackTextureToBufferMulti(dstBuffer, srcTexture, regions, regionNum);
+}
+
 static void NRI_CALL CmdZeroBuffer(CommandBuffer& commandBuffer, Buffer& buffer, uint64_t offset, uint64_t size) {
     ((CommandBufferD3D12&)commandBuffer).ZeroBuffer(buffer, offset, size);
 }
 
+static void NRI_CALL CmdUpdateBuffer(CommandBuffer& commandBuffer, Buffer& buffer, uint64_t offset, const void* data, uint32_t size) {
+    ((CommandBufferD3D12&)commandBuffer).UpdateBuffer(buffer, offset, data, size);
+}
+
 static void NRI_CALL CmdResolveTexture(CommandBuffer& commandBuffer, Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion) {
     ((CommandBufferD3D12&)commandBuffer).ResolveTexture(dstTexture, dstRegion, srcTexture, srcRegion);
 }
@@ -450,6 +484,10 @@ static Result NRI_CALL QueueSubmit(Queue& queue, const QueueSubmitDesc& queueSub
     return ((QueueD3D12&)queue).Submit(queueSubmitDesc);
 }
 
+static Result NRI_CALL QueueSubmitMulti(Queue& queue, const QueueSubmitDesc* queueSubmitDescs, uint32_t queueSubmitDescNum) {
+    return ((QueueD3D12&)queue).SubmitMulti(queueSubmitDescs, queueSubmitDescNum);
+}
+
 static Result NRI_CALL DeviceWaitIdle(Device& device) {
     if (!(&device))
         return Result::SUCCESS;
@@ -468,6 +506,14 @@ static void NRI_CALL Wait(Fence& fence, uint64_t value) {
     ((FenceD3D12&)fence).Wait(value);
 }
 
+static void NRI_CALL Signal(Fence& fence, uint64_t value) {
+    ((FenceD3D12&)fence).Signal(value);
+}
+
+static Result NRI_CALL WaitMulti(Device& device, const FenceWaitDesc* fenceWaitDescs, uint32_t fenceWaitDescNum, bool waitAny, uint32_t timeout) {
+    return ((DeviceD3D12&)device).WaitMulti(fenceWaitDescs, fenceWaitDescNum, waitAny, timeout);
+}
+
 static void NRI_CALL UpdateDescriptorRanges(DescriptorSet& descriptorSet, uint32_t baseRange, uint32_t rangeNum, const DescriptorRangeUpdateDesc* rangeUpdateDescs) {
     ((DescriptorSetD3D12&)descriptorSet).UpdateDescriptorRanges(baseRange, rangeNum, rangeUpdateDescs);
 }
@@ -590,6 +636,7 @@ Result DeviceD3D12::FillFunctionTable(CoreInterface& table) const {
     table.BindTextureMemory = ::BindTextureMemory;
     table.FreeMemory = ::FreeMemory;
     table.BeginCommandBuffer = ::BeginCommandBuffer;
+    table.BeginReusableCommandBuffer = ::BeginReusableCommandBuffer;
     table.CmdSetDescriptorPool = ::CmdSetDescriptorPool;
     table.CmdSetDescriptorSet = ::CmdSetDescriptorSet;
     table.CmdSetPipelineLayout = ::CmdSetPipelineLayout;
@@ -611,6 +658,8 @@ Result DeviceD3D12::FillFunctionTable(CoreInterface& table) const {
     table.CmdClearAttachments = ::CmdClearAttachments;
     table.CmdDraw = ::CmdDraw;
     table.CmdDrawIndexed = ::CmdDrawIndexed;
+    table.CmdDrawMulti = ::CmdDrawMulti;
+    table.CmdDrawIndexedMulti = ::CmdDrawIndexedMulti;
     table.CmdDrawIndirect = ::CmdDrawIndirect;
     table.CmdDrawIndexedIndirect = ::CmdDrawIndexedIndirect;
     table.CmdEndRendering = ::CmdEndRendering;
@@ -621,6 +670,11 @@ Result DeviceD3D12::FillFunctionTable(CoreInterface& table) const {
     table.CmdUploadBufferToTexture = ::CmdUploadBufferToTexture;
     table.CmdReadbackTextureToBuffer = ::CmdReadbackTextureToBuffer;
     table.CmdZeroBuffer = ::CmdZeroBuffer;
+    table.CmdUpdateBuffer = ::CmdUpdateBuffer;
+    table.CmdCopyBufferMulti = ::CmdCopyBufferMulti;
+    table.CmdCopyTextureMulti = ::CmdCopyTextureMulti;
+    table.CmdUploadBufferToTextureMulti = ::CmdUploadBufferToTextureMulti;
+    table.CmdReadbackTextureToBufferMulti = ::CmdReadbackTextureToBufferMulti;
     table.CmdResolveTexture = ::CmdResolveTexture;
     table.CmdClearStorage = ::CmdClearStorage;
     table.CmdResetQueries = ::CmdResetQueries;
@@ -638,7 +692,10 @@ Result DeviceD3D12::FillFunctionTable(CoreInterface& table) const {
     table.DeviceWaitIdle = ::DeviceWaitIdle;
     table.QueueWaitIdle = ::QueueWaitIdle;
     table.QueueSubmit = ::QueueSubmit;
+    table.QueueSubmitMulti = ::QueueSubmitMulti;
     table.Wait = ::Wait;
+    table.WaitMulti = ::WaitMulti;
+    table.Signal = ::Signal;
     table.GetFenceValue = ::GetFenceValue;
     table.UpdateDescriptorRanges = ::UpdateDescriptorRanges;
     table.UpdateDynamicConstantBuffers = ::UpdateDynamicConstantBuffers;
@@ -692,11 +749,72 @@ static Result NRI_CALL QueryVideoMemoryInfo(const Device& device, MemoryLocation
     return QueryVideoMemoryInfoDXGI(luid, memoryLocation, videoMemoryInfo);
 }
 
+static void NRI_CALL DestroyDeferred(Device& device, const DeferredDestroyDesc* deferredDestroyDescs, uint32_t deferredDestroyDescNum) {
+    DeviceD3D12& deviceD3D12 = (DeviceD3D12&)device;
+    HelperDeferredDestroyer deferredDestroyer(deviceD3D12.GetCoreInterface(), device);
+
+    deferredDestroyer.DestroyDeferred(deferredDestroyDescs, deferredDestroyDescNum);
+}
+
+static void NRI_CALL ProcessDeferredDestroys(Device& device, bool all) {
+    DeviceD3D12& deviceD3D12 = (DeviceD3D12&)device;
+    HelperDeferredDestroyer deferredDestroyer(deviceD3D12.GetCoreInterface(), device);
+
+    deferredDestroyer.ProcessDeferredDestroys(all);
+}
+
+static Result NRI_CALL CreateFrameContext(Device& device, const FrameContextDesc& frameContextDesc, FrameContext*& frameContext) {
+    DeviceD3D12& deviceD3D12 = (DeviceD3D12&)device;
+    FrameContextImpl* impl = Allocate<FrameContextImpl>(deviceD3D12.GetAllocationCallbacks(), device, deviceD3D12.GetCoreInterface());
+    Result result = impl->Create(frameContextDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        frameContext = nullptr;
+    } else
+        frameContext = (FrameContext*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyFrameContext(FrameContext& frameContext) {
+    Destroy((FrameContextImpl*)&frameContext);
+}
+
+static uint32_t NRI_CALL BeginFrameContext(FrameContext& frameContext) {
+    return ((FrameContextImpl&)frameContext).BeginFrame();
+}
+
+static Result NRI_CALL EndFrameContext(FrameContext& frameContext) {
+    return ((FrameContextImpl&)frameContext).EndFrame();
+}
+
+static CommandAllocator* NRI_CALL GetFrameCommandAllocator(const FrameContext& frameContext, uint32_t threadIndex) {
+    return ((FrameContextImpl&)frameContext).GetCommandAllocator(threadIndex);
+}
+
+static CommandBuffer* NRI_CALL GetFrameCommandBuffer(const FrameContext& frameContext, uint32_t threadIndex, uint32_t commandBufferIndex) {
+    return ((FrameContextImpl&)frameContext).GetCommandBuffer(threadIndex, commandBufferIndex);
+}
+
+static DescriptorPool* NRI_CALL GetFrameDescriptorPool(const FrameContext& frameContext, uint32_t threadIndex) {
+    return ((FrameContextImpl&)frameContext).GetDescriptorPool(threadIndex);
+}
+
 Result DeviceD3D12::FillFunctionTable(HelperInterface& table) const {
     table.CalculateAllocationNumber = ::CalculateAllocationNumber;
     table.AllocateAndBindMemory = ::AllocateAndBindMemory;
     table.UploadData = ::UploadData;
     table.QueryVideoMemoryInfo = ::QueryVideoMemoryInfo;
+    table.DestroyDeferred = ::DestroyDeferred;
+    table.ProcessDeferredDestroys = ::ProcessDeferredDestroys;
+    table.CreateFrameContext = ::CreateFrameContext;
+    table.DestroyFrameContext = ::DestroyFrameContext;
+    table.BeginFrameContext = ::BeginFrameContext;
+    table.EndFrameContext = ::EndFrameContext;
+    table.GetFrameCommandAllocator = ::GetFrameCommandAllocator;
+    table.GetFrameCommandBuffer = ::GetFrameCommandBuffer;
+    table.GetFrameDescriptorPool = ::GetFrameDescriptorPool;
 
     return Result::SUCCESS;
 }
@@ -812,6 +930,46 @@ Result DeviceD3D12::FillFunctionTable(MeshShaderInterface& table) const {
 
 #pragma endregion
 
+//============================================================================================================================================================================================
+#pragma region[  QueueScheduler  ]
+
+static Result NRI_CALL CreateQueueScheduler(Device& device, QueueScheduler*& queueScheduler) {
+    DeviceD3D12& deviceD3D12 = (DeviceD3D12&)device;
+    QueueSchedulerImpl* impl = Allocate<QueueSchedulerImpl>(deviceD3D12.GetAllocationCallbacks(), device, deviceD3D12.GetCoreInterface());
+    Result result = impl->Create();
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        queueScheduler = nullptr;
+    } else
+        queueScheduler = (QueueScheduler*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyQueueScheduler(QueueScheduler& queueScheduler) {
+    Destroy((QueueSchedulerImpl*)&queueScheduler);
+}
+
+static Queue* NRI_CALL GetQueueSchedulerQueue(const QueueScheduler& queueScheduler, QueueType queueType) {
+    return ((QueueSchedulerImpl&)queueScheduler).GetQueue(queueType);
+}
+
+static Result NRI_CALL SubmitSchedule(QueueScheduler& queueScheduler, const ScheduleDesc& scheduleDesc) {
+    return ((QueueSchedulerImpl&)queueScheduler).Submit(scheduleDesc);
+}
+
+Result DeviceD3D12::FillFunctionTable(QueueSchedulerInterface& table) const {
+    table.CreateQueueScheduler = ::CreateQueueScheduler;
+    table.DestroyQueueScheduler = ::DestroyQueueScheduler;
+    table.GetQueueSchedulerQueue = ::GetQueueSchedulerQueue;
+    table.SubmitSchedule = ::SubmitSchedule;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
 //============================================================================================================================================================================================
 #pragma region[  RayTracing  ]
 
@@ -997,6 +1155,54 @@ Result DeviceD3D12::FillFunctionTable(RayTracingInterface& table) const {
 
 #pragma endregion
 
+//============================================================================================================================================================================================
+#pragma region[  RenderGraph  ]
+
+static Result NRI_CALL CreateRenderGraph(Device& device, RenderGraph*& renderGraph) {
+    DeviceD3D12& deviceD3D12 = (DeviceD3D12&)device;
+    renderGraph = (RenderGraph*)Allocate<RenderGraphImpl>(deviceD3D12.GetAllocationCallbacks(), device, deviceD3D12.GetCoreInterface());
+
+    return Result::SUCCESS;
+}
+
+static void NRI_CALL DestroyRenderGraph(RenderGraph& renderGraph) {
+    Destroy((RenderGraphImpl*)&renderGraph);
+}
+
+static Result NRI_CALL CompileRenderGraph(RenderGraph& renderGraph, const RenderGraphDesc& renderGraphDesc) {
+    return ((RenderGraphImpl&)renderGraph).Compile(renderGraphDesc);
+}
+
+static Texture* NRI_CALL GetRenderGraphTexture(const RenderGraph& renderGraph, uint32_t resourceIndex) {
+    return ((RenderGraphImpl&)renderGraph).GetTexture(resourceIndex);
+}
+
+static Buffer* NRI_CALL GetRenderGraphBuffer(const RenderGraph& renderGraph, uint32_t resourceIndex) {
+    return ((RenderGraphImpl&)renderGraph).GetBuffer(resourceIndex);
+}
+
+static void NRI_CALL GetRenderGraphStats(const RenderGraph& renderGraph, RenderGraphStats& renderGraphStats) {
+    ((RenderGraphImpl&)renderGraph).GetStats(renderGraphStats);
+}
+
+static void NRI_CALL CmdExecuteRenderGraph(CommandBuffer& commandBuffer, const RenderGraph& renderGraph) {
+    ((RenderGraphImpl&)renderGraph).CmdExecute(commandBuffer);
+}
+
+Result DeviceD3D12::FillFunctionTable(RenderGraphInterface& table) const {
+    table.CreateRenderGraph = ::CreateRenderGraph;
+    table.DestroyRenderGraph = ::DestroyRenderGraph;
+    table.CompileRenderGraph = ::CompileRenderGraph;
+    table.GetRenderGraphTexture = ::GetRenderGraphTexture;
+    table.GetRenderGraphBuffer = ::GetRenderGraphBuffer;
+    table.GetRenderGraphStats = ::GetRenderGraphStats;
+    table.CmdExecuteRenderGraph = ::CmdExecuteRenderGraph;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
 //============================================================================================================================================================================================
 #pragma region[  ResourceAllocator  ]
 
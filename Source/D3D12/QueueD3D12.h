@@ -47,6 +47,7 @@ struct QueueD3D12 final : public DebugNameBase {
     void EndAnnotation();
     void Annotation(const char* name, uint32_t bgra);
     Result Submit(const QueueSubmitDesc& queueSubmitDesc);
+    Result SubmitMulti(const QueueSubmitDesc* queueSubmitDescs, uint32_t queueSubmitDescNum);
     Result WaitIdle();
 
 private:
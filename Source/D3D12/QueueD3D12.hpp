@@ -76,6 +76,55 @@ NRI_INLINE Result QueueD3D12::Submit(const QueueSubmitDesc& queueSubmitDesc) {
     return Result::SUCCESS;
 }
 
+NRI_INLINE Result QueueD3D12::SubmitMulti(const QueueSubmitDesc* queueSubmitDescs, uint32_t queueSubmitDescNum) {
+    uint32_t commandBufferNum = 0;
+    for (uint32_t i = 0; i < queueSubmitDescNum; i++)
+        commandBufferNum += queueSubmitDescs[i].commandBufferNum;
+
+    // Command lists not separated by a fence wait or signal are merged into one "ExecuteCommandLists"
+    Scratch<ID3D12CommandList*> commandLists = AllocateScratch(m_Device, ID3D12CommandList*, commandBufferNum);
+    uint32_t executedNum = 0;
+    uint32_t pendingNum = 0;
+
+    for (uint32_t i = 0; i < queueSubmitDescNum; i++) {
+        const QueueSubmitDesc& queueSubmitDesc = queueSubmitDescs[i];
+
+        if (queueSubmitDesc.waitFenceNum && pendingNum > executedNum) {
+            m_Queue->ExecuteCommandLists(pendingNum - executedNum, commandLists + executedNum);
+            executedNum = pendingNum;
+        }
+
+        for (uint32_t j = 0; j < queueSubmitDesc.waitFenceNum; j++) {
+            const FenceSubmitDesc& fenceSubmitDesc = queueSubmitDesc.waitFences[j];
+            FenceD3D12* fence = (FenceD3D12*)fenceSubmitDesc.fence;
+            fence->QueueWait(*this, fenceSubmitDesc.value);
+        }
+
+        for (uint32_t j = 0; j < queueSubmitDesc.commandBufferNum; j++)
+            commandLists[pendingNum++] = *(CommandBufferD3D12*)queueSubmitDesc.commandBuffers[j];
+
+        if (queueSubmitDesc.signalFenceNum && pendingNum > executedNum) {
+            m_Queue->ExecuteCommandLists(pendingNum - executedNum, commandLists + executedNum);
+            executedNum = pendingNum;
+        }
+
+        for (uint32_t j = 0; j < queueSubmitDesc.signalFenceNum; j++) {
+            const FenceSubmitDesc& fenceSubmitDesc = queueSubmitDesc.signalFences[j];
+            FenceD3D12* fence = (FenceD3D12*)fenceSubmitDesc.fence;
+            fence->QueueSignal(*this, fenceSubmitDesc.value);
+        }
+    }
+
+    if (pendingNum > executedNum)
+        m_Queue->ExecuteCommandLists(pendingNum - executedNum, commandLists + executedNum);
+
+    // Is device lost?
+    HRESULT hr = m_Device->GetDeviceRemovedReason() == S_OK ? S_OK : DXGI_ERROR_DEVICE_REMOVED;
+    RETURN_ON_BAD_HRESULT(&m_Device, hr, "SubmitMulti");
+
+    return Result::SUCCESS;
+}
+
 NRI_INLINE Result QueueD3D12::WaitIdle() {
     FenceD3D12* fence = nullptr;
     Result result = m_Device.CreateImplementation<FenceD3D12>(fence, 0);
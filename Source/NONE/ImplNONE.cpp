@@ -175,11 +175,20 @@ struct DeviceNONE final : public DeviceBase {
     }
 
     Result FillFunctionTable(CoreInterface& table) const override;
+    Result FillFunctionTable(CommandBufferStatsInterface& table) const override;
+    Result FillFunctionTable(ConditionalRenderingInterface& table) const override;
+    Result FillFunctionTable(DeviceGeneratedCommandsInterface& table) const override;
+    Result FillFunctionTable(FenceCallbackInterface& table) const override;
     Result FillFunctionTable(HelperInterface& table) const override;
     Result FillFunctionTable(LowLatencyInterface& table) const override;
     Result FillFunctionTable(MeshShaderInterface& table) const override;
+    Result FillFunctionTable(QueueSchedulerInterface& table) const override;
+    Result FillFunctionTable(QueueTimelineInterface& table) const override;
     Result FillFunctionTable(RayTracingInterface& table) const override;
+    Result FillFunctionTable(RenderGraphInterface& table) const override;
     Result FillFunctionTable(ResourceAllocatorInterface& table) const override;
+    Result FillFunctionTable(SecondaryCommandBufferInterface& table) const override;
+    Result FillFunctionTable(SplitBarrierInterface& table) const override;
     Result FillFunctionTable(StreamerInterface& table) const override;
     Result FillFunctionTable(SwapChainInterface& table) const override;
     Result FillFunctionTable(UpscalerInterface& table) const override;
@@ -401,6 +410,10 @@ static Result NRI_CALL BeginCommandBuffer(CommandBuffer&, const DescriptorPool*)
     return Result::SUCCESS;
 }
 
+static Result NRI_CALL BeginReusableCommandBuffer(CommandBuffer&, const DescriptorPool*) {
+    return Result::SUCCESS;
+}
+
 static void NRI_CALL CmdSetDescriptorPool(CommandBuffer&, const DescriptorPool&) {
 }
 
@@ -464,6 +477,12 @@ static void NRI_CALL CmdDraw(CommandBuffer&, const DrawDesc&) {
 static void NRI_CALL CmdDrawIndexed(CommandBuffer&, const DrawIndexedDesc&) {
 }
 
+static void NRI_CALL CmdDrawMulti(CommandBuffer&, const DrawDesc*, uint32_t) {
+}
+
+static void NRI_CALL CmdDrawIndexedMulti(CommandBuffer&, const DrawIndexedDesc*, uint32_t) {
+}
+
 static void NRI_CALL CmdDrawIndirect(CommandBuffer&, const Buffer&, uint64_t, uint32_t, uint32_t, const Buffer*, uint64_t) {
 }
 
@@ -491,9 +510,24 @@ static void NRI_CALL CmdUploadBufferToTexture(CommandBuffer&, Texture&, const Te
 static void NRI_CALL CmdReadbackTextureToBuffer(CommandBuffer&, Buffer&, const TextureDataLayoutDesc&, const Texture&, const TextureRegionDesc&) {
 }
 
+static void NRI_CALL CmdCopyBufferMulti(CommandBuffer&, Buffer&, const Buffer&, const BufferCopyRegionDesc*, uint32_t) {
+}
+
+static void NRI_CALL CmdCopyTextureMulti(CommandBuffer&, Texture&, const Texture&, const TextureCopyRegionDesc*, uint32_t) {
+}
+
+static void NRI_CALL CmdUploadBufferToTextureMulti(CommandBuffer&, Texture&, const Buffer&, const TextureBufferCopyRegionDesc*, uint32_t) {
+}
+
+static void NRI_CALL CmdReadbackTextureToBufferMulti(CommandBuffer&, Buffer&, const Texture&, const TextureBufferCopyRegionDesc*, uint32_t) {
+}
+
 static void NRI_CALL CmdZeroBuffer(CommandBuffer&, Buffer&, uint64_t, uint64_t) {
 }
 
+static void NRI_CALL CmdUpdateBuffer(CommandBuffer&, Buffer&, uint64_t, const void*, uint32_t) {
+}
+
 static void NRI_CALL CmdResolveTexture(CommandBuffer&, Texture&, const TextureRegionDesc*, const Texture&, const TextureRegionDesc*) {
 }
 
@@ -541,6 +575,10 @@ static Result NRI_CALL QueueSubmit(Queue&, const QueueSubmitDesc&) {
     return Result::SUCCESS;
 }
 
+static Result NRI_CALL QueueSubmitMulti(Queue&, const QueueSubmitDesc*, uint32_t) {
+    return Result::SUCCESS;
+}
+
 static Result NRI_CALL DeviceWaitIdle(Device&) {
     return Result::SUCCESS;
 }
@@ -552,6 +590,13 @@ static Result NRI_CALL QueueWaitIdle(Queue&) {
 static void NRI_CALL Wait(Fence&, uint64_t) {
 }
 
+static void NRI_CALL Signal(Fence&, uint64_t) {
+}
+
+static Result NRI_CALL WaitMulti(Device&, const FenceWaitDesc*, uint32_t, bool, uint32_t) {
+    return Result::SUCCESS;
+}
+
 static void NRI_CALL UpdateDescriptorRanges(DescriptorSet&, uint32_t, uint32_t, const DescriptorRangeUpdateDesc*) {
 }
 
@@ -646,6 +691,7 @@ Result DeviceNONE::FillFunctionTable(CoreInterface& table) const {
     table.BindTextureMemory = ::BindTextureMemory;
     table.FreeMemory = ::FreeMemory;
     table.BeginCommandBuffer = ::BeginCommandBuffer;
+    table.BeginReusableCommandBuffer = ::BeginReusableCommandBuffer;
     table.CmdSetDescriptorPool = ::CmdSetDescriptorPool;
     table.CmdSetDescriptorSet = ::CmdSetDescriptorSet;
     table.CmdSetPipelineLayout = ::CmdSetPipelineLayout;
@@ -667,6 +713,8 @@ Result DeviceNONE::FillFunctionTable(CoreInterface& table) const {
     table.CmdClearAttachments = ::CmdClearAttachments;
     table.CmdDraw = ::CmdDraw;
     table.CmdDrawIndexed = ::CmdDrawIndexed;
+    table.CmdDrawMulti = ::CmdDrawMulti;
+    table.CmdDrawIndexedMulti = ::CmdDrawIndexedMulti;
     table.CmdDrawIndirect = ::CmdDrawIndirect;
     table.CmdDrawIndexedIndirect = ::CmdDrawIndexedIndirect;
     table.CmdEndRendering = ::CmdEndRendering;
@@ -677,6 +725,11 @@ Result DeviceNONE::FillFunctionTable(CoreInterface& table) const {
     table.CmdUploadBufferToTexture = ::CmdUploadBufferToTexture;
     table.CmdReadbackTextureToBuffer = ::CmdReadbackTextureToBuffer;
     table.CmdZeroBuffer = ::CmdZeroBuffer;
+    table.CmdUpdateBuffer = ::CmdUpdateBuffer;
+    table.CmdCopyBufferMulti = ::CmdCopyBufferMulti;
+    table.CmdCopyTextureMulti = ::CmdCopyTextureMulti;
+    table.CmdUploadBufferToTextureMulti = ::CmdUploadBufferToTextureMulti;
+    table.CmdReadbackTextureToBufferMulti = ::CmdReadbackTextureToBufferMulti;
     table.CmdResolveTexture = ::CmdResolveTexture;
     table.CmdClearStorage = ::CmdClearStorage;
     table.CmdResetQueries = ::CmdResetQueries;
@@ -694,7 +747,10 @@ Result DeviceNONE::FillFunctionTable(CoreInterface& table) const {
     table.DeviceWaitIdle = ::DeviceWaitIdle;
     table.QueueWaitIdle = ::QueueWaitIdle;
     table.QueueSubmit = ::QueueSubmit;
+    table.QueueSubmitMulti = ::QueueSubmitMulti;
     table.Wait = ::Wait;
+    table.WaitMulti = ::WaitMulti;
+    table.Signal = ::Signal;
     table.GetFenceValue = ::GetFenceValue;
     table.UpdateDescriptorRanges = ::UpdateDescriptorRanges;
     table.UpdateDynamicConstantBuffers = ::UpdateDynamicConstantBuffers;
@@ -717,6 +773,101 @@ Result DeviceNONE::FillFunctionTable(CoreInterface& table) const {
 
 #pragma endregion
 
+//============================================================================================================================================================================================
+#pragma region[  CommandBufferStats  ]
+
+static void NRI_CALL GetCommandBufferStats(const CommandBuffer&, CommandBufferStats& commandBufferStats) {
+    commandBufferStats = {};
+}
+
+Result DeviceNONE::FillFunctionTable(CommandBufferStatsInterface& table) const {
+    table.GetCommandBufferStats = ::GetCommandBufferStats;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  ConditionalRendering  ]
+
+static void NRI_CALL CmdBeginConditionalRendering(CommandBuffer&, const Buffer&, uint64_t, bool) {
+}
+
+static void NRI_CALL CmdEndConditionalRendering(CommandBuffer&) {
+}
+
+Result DeviceNONE::FillFunctionTable(ConditionalRenderingInterface& table) const {
+    table.CmdBeginConditionalRendering = ::CmdBeginConditionalRendering;
+    table.CmdEndConditionalRendering = ::CmdEndConditionalRendering;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  DeviceGeneratedCommands  ]
+
+static Result NRI_CALL CreateIndirectCommandLayout(Device&, const IndirectCommandLayoutDesc&, IndirectCommandLayout*& indirectCommandLayout) {
+    indirectCommandLayout = DummyObject<IndirectCommandLayout>();
+
+    return Result::SUCCESS;
+}
+
+static Result NRI_CALL CreateIndirectExecutionSet(Device&, const IndirectExecutionSetDesc&, IndirectExecutionSet*& indirectExecutionSet) {
+    indirectExecutionSet = DummyObject<IndirectExecutionSet>();
+
+    return Result::SUCCESS;
+}
+
+static uint64_t NRI_CALL GetGeneratedCommandsPreprocessBufferSize(const IndirectCommandLayout&, const IndirectExecutionSet*, uint32_t) {
+    return 0;
+}
+
+static void NRI_CALL DestroyIndirectCommandLayout(IndirectCommandLayout&) {
+}
+
+static void NRI_CALL DestroyIndirectExecutionSet(IndirectExecutionSet&) {
+}
+
+static void NRI_CALL UpdateIndirectExecutionSet(IndirectExecutionSet&, uint32_t, const Pipeline* const*, uint32_t) {
+}
+
+static void NRI_CALL CmdExecuteGeneratedCommands(CommandBuffer&, const GeneratedCommandsDesc&) {
+}
+
+Result DeviceNONE::FillFunctionTable(DeviceGeneratedCommandsInterface& table) const {
+    table.CreateIndirectCommandLayout = ::CreateIndirectCommandLayout;
+    table.CreateIndirectExecutionSet = ::CreateIndirectExecutionSet;
+    table.GetGeneratedCommandsPreprocessBufferSize = ::GetGeneratedCommandsPreprocessBufferSize;
+    table.DestroyIndirectCommandLayout = ::DestroyIndirectCommandLayout;
+    table.DestroyIndirectExecutionSet = ::DestroyIndirectExecutionSet;
+    table.UpdateIndirectExecutionSet = ::UpdateIndirectExecutionSet;
+    table.CmdExecuteGeneratedCommands = ::CmdExecuteGeneratedCommands;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  FenceCallback  ]
+
+static Result NRI_CALL RegisterFenceCallback(Fence&, uint64_t, const FenceCallbackDesc& fenceCallbackDesc) {
+    fenceCallbackDesc.Callback(fenceCallbackDesc.userArg); // nothing to wait for
+
+    return Result::SUCCESS;
+}
+
+Result DeviceNONE::FillFunctionTable(FenceCallbackInterface& table) const {
+    table.RegisterFenceCallback = ::RegisterFenceCallback;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
 //============================================================================================================================================================================================
 #pragma region[  Helper  ]
 
@@ -738,11 +889,55 @@ static Result NRI_CALL QueryVideoMemoryInfo(const Device&, MemoryLocation, Video
     return Result::SUCCESS;
 }
 
+static void NRI_CALL DestroyDeferred(Device&, const DeferredDestroyDesc*, uint32_t) {
+}
+
+static void NRI_CALL ProcessDeferredDestroys(Device&, bool) {
+}
+
+static Result NRI_CALL CreateFrameContext(Device&, const FrameContextDesc&, FrameContext*& frameContext) {
+    frameContext = DummyObject<FrameContext>();
+
+    return Result::SUCCESS;
+}
+
+static void NRI_CALL DestroyFrameContext(FrameContext&) {
+}
+
+static uint32_t NRI_CALL BeginFrameContext(FrameContext&) {
+    return 0;
+}
+
+static Result NRI_CALL EndFrameContext(FrameContext&) {
+    return Result::SUCCESS;
+}
+
+static CommandAllocator* NRI_CALL GetFrameCommandAllocator(const FrameContext&, uint32_t) {
+    return DummyObject<CommandAllocator>();
+}
+
+static CommandBuffer* NRI_CALL GetFrameCommandBuffer(const FrameContext&, uint32_t, uint32_t) {
+    return DummyObject<CommandBuffer>();
+}
+
+static DescriptorPool* NRI_CALL GetFrameDescriptorPool(const FrameContext&, uint32_t) {
+    return DummyObject<DescriptorPool>();
+}
+
 Result DeviceNONE::FillFunctionTable(HelperInterface& table) const {
     table.CalculateAllocationNumber = ::CalculateAllocationNumber;
     table.AllocateAndBindMemory = ::AllocateAndBindMemory;
     table.UploadData = ::UploadData;
     table.QueryVideoMemoryInfo = ::QueryVideoMemoryInfo;
+    table.DestroyDeferred = ::DestroyDeferred;
+    table.ProcessDeferredDestroys = ::ProcessDeferredDestroys;
+    table.CreateFrameContext = ::CreateFrameContext;
+    table.DestroyFrameContext = ::DestroyFrameContext;
+    table.BeginFrameContext = ::BeginFrameContext;
+    table.EndFrameContext = ::EndFrameContext;
+    table.GetFrameCommandAllocator = ::GetFrameCommandAllocator;
+    table.GetFrameCommandBuffer = ::GetFrameCommandBuffer;
+    table.GetFrameDescriptorPool = ::GetFrameDescriptorPool;
 
     return Result::SUCCESS;
 }
@@ -835,6 +1030,57 @@ Result DeviceNONE::FillFunctionTable(MeshShaderInterface& table) const {
 
 #pragma endregion
 
+//============================================================================================================================================================================================
+#pragma region[  QueueScheduler  ]
+
+static Result NRI_CALL CreateQueueScheduler(Device&, QueueScheduler*& queueScheduler) {
+    queueScheduler = DummyObject<QueueScheduler>();
+
+    return Result::SUCCESS;
+}
+
+static void NRI_CALL DestroyQueueScheduler(QueueScheduler&) {
+}
+
+static Queue* NRI_CALL GetQueueSchedulerQueue(const QueueScheduler&, QueueType) {
+    return DummyObject<Queue>();
+}
+
+static Result NRI_CALL SubmitSchedule(QueueScheduler&, const ScheduleDesc&) {
+    return Result::SUCCESS;
+}
+
+Result DeviceNONE::FillFunctionTable(QueueSchedulerInterface& table) const {
+    table.CreateQueueScheduler = ::CreateQueueScheduler;
+    table.DestroyQueueScheduler = ::DestroyQueueScheduler;
+    table.GetQueueSchedulerQueue = ::GetQueueSchedulerQueue;
+    table.SubmitSchedule = ::SubmitSchedule;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  QueueTimeline  ]
+
+static uint64_t NRI_CALL GetQueueSubmissionId(const Queue&) {
+    return 0;
+}
+
+static uint64_t NRI_CALL GetQueueCompletedSubmissionId(const Queue&) {
+    return 0;
+}
+
+Result DeviceNONE::FillFunctionTable(QueueTimelineInterface& table) const {
+    table.GetQueueSubmissionId = ::GetQueueSubmissionId;
+    table.GetQueueCompletedSubmissionId = ::GetQueueCompletedSubmissionId;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
 //============================================================================================================================================================================================
 #pragma region[  RayTracing  ]
 
@@ -988,6 +1234,51 @@ Result DeviceNONE::FillFunctionTable(RayTracingInterface& table) const {
 
 #pragma endregion
 
+//============================================================================================================================================================================================
+#pragma region[  RenderGraph  ]
+
+static Result NRI_CALL CreateRenderGraph(Device&, RenderGraph*& renderGraph) {
+    renderGraph = DummyObject<RenderGraph>();
+
+    return Result::SUCCESS;
+}
+
+static void NRI_CALL DestroyRenderGraph(RenderGraph&) {
+}
+
+static Result NRI_CALL CompileRenderGraph(RenderGraph&, const RenderGraphDesc&) {
+    return Result::SUCCESS;
+}
+
+static Texture* NRI_CALL GetRenderGraphTexture(const RenderGraph&, uint32_t) {
+    return DummyObject<Texture>();
+}
+
+static Buffer* NRI_CALL GetRenderGraphBuffer(const RenderGraph&, uint32_t) {
+    return DummyObject<Buffer>();
+}
+
+static void NRI_CALL GetRenderGraphStats(const RenderGraph&, RenderGraphStats& renderGraphStats) {
+    renderGraphStats = {};
+}
+
+static void NRI_CALL CmdExecuteRenderGraph(CommandBuffer&, const RenderGraph&) {
+}
+
+Result DeviceNONE::FillFunctionTable(RenderGraphInterface& table) const {
+    table.CreateRenderGraph = ::CreateRenderGraph;
+    table.DestroyRenderGraph = ::DestroyRenderGraph;
+    table.CompileRenderGraph = ::CompileRenderGraph;
+    table.GetRenderGraphTexture = ::GetRenderGraphTexture;
+    table.GetRenderGraphBuffer = ::GetRenderGraphBuffer;
+    table.GetRenderGraphStats = ::GetRenderGraphStats;
+    table.CmdExecuteRenderGraph = ::CmdExecuteRenderGraph;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
 //============================================================================================================================================================================================
 #pragma region[  ResourceAllocator  ]
 
@@ -1026,6 +1317,55 @@ Result DeviceNONE::FillFunctionTable(ResourceAllocatorInterface& table) const {
 
 #pragma endregion
 
+//============================================================================================================================================================================================
+#pragma region[  SecondaryCommandBuffer  ]
+
+static Result NRI_CALL CreateSecondaryCommandBuffer(CommandAllocator&, CommandBuffer*& commandBuffer) {
+    commandBuffer = DummyObject<CommandBuffer>();
+
+    return Result::SUCCESS;
+}
+
+static Result NRI_CALL BeginSecondaryCommandBuffer(CommandBuffer&, const AttachmentsDesc*, const DescriptorPool*) {
+    return Result::SUCCESS;
+}
+
+static void NRI_CALL CmdBeginRenderingSecondary(CommandBuffer&, const AttachmentsDesc&) {
+}
+
+static void NRI_CALL CmdExecuteCommands(CommandBuffer&, const CommandBuffer* const*, uint32_t) {
+}
+
+Result DeviceNONE::FillFunctionTable(SecondaryCommandBufferInterface& table) const {
+    table.CreateSecondaryCommandBuffer = ::CreateSecondaryCommandBuffer;
+    table.BeginSecondaryCommandBuffer = ::BeginSecondaryCommandBuffer;
+    table.CmdBeginRenderingSecondary = ::CmdBeginRenderingSecondary;
+    table.CmdExecuteCommands = ::CmdExecuteCommands;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  SplitBarrier  ]
+
+static uint32_t NRI_CALL CmdBeginBarrier(CommandBuffer&, const BarrierGroupDesc&) {
+    return 0;
+}
+
+static void NRI_CALL CmdEndBarrier(CommandBuffer&, const BarrierGroupDesc&, uint32_t) {
+}
+
+Result DeviceNONE::FillFunctionTable(SplitBarrierInterface& table) const {
+    table.CmdBeginBarrier = ::CmdBeginBarrier;
+    table.CmdEndBarrier = ::CmdEndBarrier;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
 //============================================================================================================================================================================================
 #pragma region[  Streamer  ]
 
@@ -44,6 +44,7 @@ struct DeviceBase : public DebugNameBaseVal {
         : m_CallbackInterface(callbacks)
         , m_AllocationCallbacks(allocationCallbacks)
         , m_StdAllocator(m_AllocationCallbacks)
+        , m_DeferredDestroys(m_StdAllocator)
 #ifndef NDEBUG
         , m_Signature(signature)
 #endif
@@ -59,6 +60,14 @@ struct DeviceBase : public DebugNameBaseVal {
         return m_AllocationCallbacks;
     }
 
+    inline Vector<DeferredDestroyDesc>& GetDeferredDestroys() {
+        return m_DeferredDestroys;
+    }
+
+    inline Lock& GetDeferredDestroyLock() {
+        return m_DeferredDestroyLock;
+    }
+
     void ReportMessage(Message messageType, Result result, const char* file, uint32_t line, const char* format, ...) const;
 
     // Pure virtual
@@ -73,6 +82,22 @@ struct DeviceBase : public DebugNameBaseVal {
         return Result::UNSUPPORTED;
     }
 
+    virtual Result FillFunctionTable(CommandBufferStatsInterface&) const {
+        return Result::UNSUPPORTED;
+    }
+
+    virtual Result FillFunctionTable(ConditionalRenderingInterface&) const {
+        return Result::UNSUPPORTED;
+    }
+
+    virtual Result FillFunctionTable(DeviceGeneratedCommandsInterface&) const {
+        return Result::UNSUPPORTED;
+    }
+
+    virtual Result FillFunctionTable(FenceCallbackInterface&) const {
+        return Result::UNSUPPORTED;
+    }
+
     virtual Result FillFunctionTable(HelperInterface&) const {
         return Result::UNSUPPORTED;
     }
@@ -89,14 +114,34 @@ struct DeviceBase : public DebugNameBaseVal {
         return Result::UNSUPPORTED;
     }
 
+    virtual Result FillFunctionTable(QueueSchedulerInterface&) const {
+        return Result::UNSUPPORTED;
+    }
+
+    virtual Result FillFunctionTable(QueueTimelineInterface&) const {
+        return Result::UNSUPPORTED;
+    }
+
     virtual Result FillFunctionTable(RayTracingInterface&) const {
         return Result::UNSUPPORTED;
     }
 
+    virtual Result FillFunctionTable(RenderGraphInterface&) const {
+        return Result::UNSUPPORTED;
+    }
+
     virtual Result FillFunctionTable(ResourceAllocatorInterface&) const {
         return Result::UNSUPPORTED;
     }
 
+    virtual Result FillFunctionTable(SecondaryCommandBufferInterface&) const {
+        return Result::UNSUPPORTED;
+    }
+
+    virtual Result FillFunctionTable(SplitBarrierInterface&) const {
+        return Result::UNSUPPORTED;
+    }
+
     virtual Result FillFunctionTable(StreamerInterface&) const {
         return Result::UNSUPPORTED;
     }
@@ -122,12 +167,14 @@ struct DeviceBase : public DebugNameBaseVal {
     }
 
 protected:
-#ifndef NDEBUG
-    uint64_t m_Signature = 0; // .natvis
-#endif
     CallbackInterface m_CallbackInterface = {};
     AllocationCallbacks m_AllocationCallbacks = {};
     StdAllocator<uint8_t> m_StdAllocator;
+    Vector<DeferredDestroyDesc> m_DeferredDestroys; // filled by "HelperInterface::DestroyDeferred", shared by all queues and threads
+    Lock m_DeferredDestroyLock;
+#ifndef NDEBUG
+    uint64_t m_Signature = 0; // .natvis
+#endif
 };
 
 } // namespace nri
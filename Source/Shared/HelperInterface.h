@@ -38,6 +38,87 @@ private:
     uint64_t m_FenceValue = 1;
 };
 
+struct HelperDeferredDestroyer {
+    inline HelperDeferredDestroyer(const CoreInterface& NRI, Device& device)
+        : m_iCore(NRI)
+        , m_Device(device) {
+    }
+
+    void DestroyDeferred(const DeferredDestroyDesc* deferredDestroyDescs, uint32_t deferredDestroyDescNum);
+    void ProcessDeferredDestroys(bool all);
+
+private:
+    void Destroy(const DeferredDestroyDesc& deferredDestroyDesc);
+
+    const CoreInterface& m_iCore;
+    Device& m_Device;
+};
+
+struct FrameContextImpl : public DebugNameBase {
+    inline FrameContextImpl(Device& device, const CoreInterface& NRI)
+        : m_Device(device)
+        , m_iCore(NRI)
+        , m_CommandAllocators(((DeviceBase&)device).GetStdAllocator())
+        , m_CommandBuffers(((DeviceBase&)device).GetStdAllocator())
+        , m_DescriptorPools(((DeviceBase&)device).GetStdAllocator())
+        , m_FrameFenceValues(((DeviceBase&)device).GetStdAllocator()) {
+    }
+
+    inline Device& GetDevice() const {
+        return m_Device;
+    }
+
+    inline uint32_t GetThreadNum() const {
+        return m_ThreadNum;
+    }
+
+    inline uint32_t GetCommandBufferNum() const {
+        return m_CommandBufferNum;
+    }
+
+    inline CommandAllocator* GetCommandAllocator(uint32_t threadIndex) const {
+        return m_CommandAllocators[m_FrameIndex * m_ThreadNum + threadIndex];
+    }
+
+    inline CommandBuffer* GetCommandBuffer(uint32_t threadIndex, uint32_t commandBufferIndex) const {
+        return m_CommandBuffers[(m_FrameIndex * m_ThreadNum + threadIndex) * m_CommandBufferNum + commandBufferIndex];
+    }
+
+    inline DescriptorPool* GetDescriptorPool(uint32_t threadIndex) const {
+        return m_DescriptorPools.empty() ? nullptr : m_DescriptorPools[m_FrameIndex * m_ThreadNum + threadIndex];
+    }
+
+    ~FrameContextImpl();
+
+    Result Create(const FrameContextDesc& frameContextDesc);
+    uint32_t BeginFrame();
+    Result EndFrame();
+
+    //================================================================================================================
+    // DebugNameBase
+    //================================================================================================================
+
+    void SetDebugName(const char* name) DEBUG_NAME_OVERRIDE {
+        m_iCore.SetDebugName(m_Fence, name);
+    }
+
+private:
+    Device& m_Device;
+    const CoreInterface& m_iCore;
+    Vector<CommandAllocator*> m_CommandAllocators; // [frame][thread]
+    Vector<CommandBuffer*> m_CommandBuffers;       // [frame][thread][commandBuffer]
+    Vector<DescriptorPool*> m_DescriptorPools;     // [frame][thread]
+    Vector<uint64_t> m_FrameFenceValues;           // signaled by the last use of a frame
+    Queue* m_Queue = nullptr;
+    Fence* m_Fence = nullptr;
+    uint64_t m_FenceValue = 0;
+    uint64_t m_FrameCounter = 0;
+    uint32_t m_FrameIndex = 0;
+    uint32_t m_FrameNum = 0;
+    uint32_t m_ThreadNum = 0;
+    uint32_t m_CommandBufferNum = 0;
+};
+
 struct HelperDeviceMemoryAllocator {
     HelperDeviceMemoryAllocator(const CoreInterface& NRI, Device& device);
 
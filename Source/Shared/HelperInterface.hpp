@@ -392,6 +392,106 @@ bool HelperDataUpload::CopyBufferContent(const BufferUploadDesc& bufferUploadDes
     return true;
 }
 
+// FrameContextImpl
+FrameContextImpl::~FrameContextImpl() {
+    if (m_Fence)
+        m_iCore.Wait(*m_Fence, m_FenceValue);
+
+    for (CommandBuffer* commandBuffer : m_CommandBuffers) {
+        if (commandBuffer)
+            m_iCore.DestroyCommandBuffer(*commandBuffer);
+    }
+
+    for (CommandAllocator* commandAllocator : m_CommandAllocators) {
+        if (commandAllocator)
+            m_iCore.DestroyCommandAllocator(*commandAllocator);
+    }
+
+    for (DescriptorPool* descriptorPool : m_DescriptorPools) {
+        if (descriptorPool)
+            m_iCore.DestroyDescriptorPool(*descriptorPool);
+    }
+
+    if (m_Fence)
+        m_iCore.DestroyFence(*m_Fence);
+}
+
+Result FrameContextImpl::Create(const FrameContextDesc& frameContextDesc) {
+    m_Queue = frameContextDesc.queue;
+    m_FrameNum = frameContextDesc.frameNum;
+    m_ThreadNum = frameContextDesc.threadNum ? frameContextDesc.threadNum : 1;
+    m_CommandBufferNum = frameContextDesc.commandBufferNum;
+
+    Result result = m_iCore.CreateFence(m_Device, 0, m_Fence);
+    if (result != Result::SUCCESS)
+        return result;
+
+    uint32_t slotNum = m_FrameNum * m_ThreadNum;
+    m_CommandAllocators.resize(slotNum, nullptr);
+    m_CommandBuffers.resize(slotNum * m_CommandBufferNum, nullptr);
+    m_FrameFenceValues.resize(m_FrameNum, 0);
+
+    if (frameContextDesc.descriptorPoolDesc)
+        m_DescriptorPools.resize(slotNum, nullptr);
+
+    for (uint32_t i = 0; i < slotNum; i++) {
+        result = m_iCore.CreateCommandAllocator(*m_Queue, m_CommandAllocators[i]);
+        if (result != Result::SUCCESS)
+            return result;
+
+        for (uint32_t j = 0; j < m_CommandBufferNum; j++) {
+            result = m_iCore.CreateCommandBuffer(*m_CommandAllocators[i], m_CommandBuffers[i * m_CommandBufferNum + j]);
+            if (result != Result::SUCCESS)
+                return result;
+        }
+
+        if (frameContextDesc.descriptorPoolDesc) {
+            result = m_iCore.CreateDescriptorPool(m_Device, *frameContextDesc.descriptorPoolDesc, m_DescriptorPools[i]);
+            if (result != Result::SUCCESS)
+                return result;
+        }
+    }
+
+    return Result::SUCCESS;
+}
+
+uint32_t FrameContextImpl::BeginFrame() {
+    m_FrameIndex = (uint32_t)(m_FrameCounter++ % m_FrameNum);
+
+    // Throttling: the previous use of the slot must be completed before its objects get reset
+    m_iCore.Wait(*m_Fence, m_FrameFenceValues[m_FrameIndex]);
+
+    for (uint32_t i = 0; i < m_ThreadNum; i++) {
+        uint32_t slot = m_FrameIndex * m_ThreadNum + i;
+
+        m_iCore.ResetCommandAllocator(*m_CommandAllocators[slot]);
+
+        if (!m_DescriptorPools.empty())
+            m_iCore.ResetDescriptorPool(*m_DescriptorPools[slot]);
+    }
+
+    return m_FrameIndex;
+}
+
+Result FrameContextImpl::EndFrame() {
+    FenceSubmitDesc fenceSubmitDesc = {};
+    fenceSubmitDesc.fence = m_Fence;
+    fenceSubmitDesc.value = m_FenceValue + 1;
+
+    QueueSubmitDesc queueSubmitDesc = {};
+    queueSubmitDesc.signalFences = &fenceSubmitDesc;
+    queueSubmitDesc.signalFenceNum = 1;
+
+    Result result = m_iCore.QueueSubmit(*m_Queue, queueSubmitDesc);
+    if (result != Result::SUCCESS)
+        return result;
+
+    m_FenceValue++;
+    m_FrameFenceValues[m_FrameIndex] = m_FenceValue;
+
+    return Result::SUCCESS;
+}
+
 // HelperDeviceMemoryAllocator
 HelperDeviceMemoryAllocator::MemoryHeap::MemoryHeap(MemoryType memoryType, const StdAllocator<uint8_t>& stdAllocator)
     : buffers(stdAllocator)
@@ -402,6 +502,99 @@ HelperDeviceMemoryAllocator::MemoryHeap::MemoryHeap(MemoryType memoryType, const
     , type(memoryType) {
 }
 
+void HelperDeferredDestroyer::DestroyDeferred(const DeferredDestroyDesc* deferredDestroyDescs, uint32_t deferredDestroyDescNum) {
+    DeviceBase& deviceBase = (DeviceBase&)m_Device;
+
+    ExclusiveScope lock(deviceBase.GetDeferredDestroyLock());
+
+    Vector<DeferredDestroyDesc>& deferredDestroys = deviceBase.GetDeferredDestroys();
+    deferredDestroys.insert(deferredDestroys.end(), deferredDestroyDescs, deferredDestroyDescs + deferredDestroyDescNum);
+}
+
+void HelperDeferredDestroyer::ProcessDeferredDestroys(bool all) {
+    DeviceBase& deviceBase = (DeviceBase&)m_Device;
+
+    ExclusiveScope lock(deviceBase.GetDeferredDestroyLock());
+
+    // Objects usually come in runs sharing a fence, so the fence value is queried once per run
+    Vector<DeferredDestroyDesc>& deferredDestroys = deviceBase.GetDeferredDestroys();
+    Vector<DeferredDestroyDesc> readyFences(deviceBase.GetStdAllocator());
+    Fence* fence = nullptr;
+    uint64_t fenceValue = 0;
+    size_t pendingNum = 0;
+
+    // Pass 1: fences are not destroyed yet, since they can be keys of other entries
+    for (const DeferredDestroyDesc& deferredDestroyDesc : deferredDestroys) {
+        if (!all && deferredDestroyDesc.fence != fence) {
+            fence = deferredDestroyDesc.fence;
+            fenceValue = m_iCore.GetFenceValue(*fence);
+        }
+
+        if (!all && fenceValue < deferredDestroyDesc.value)
+            deferredDestroys[pendingNum++] = deferredDestroyDesc;
+        else if (deferredDestroyDesc.type == DeferredDestroyType::FENCE)
+            readyFences.push_back(deferredDestroyDesc);
+        else
+            Destroy(deferredDestroyDesc);
+    }
+
+    deferredDestroys.resize(pendingNum);
+
+    // Pass 2: fences, which are not keys of pending entries
+    for (const DeferredDestroyDesc& readyFence : readyFences) {
+        bool isKey = false;
+        for (size_t i = 0; i < pendingNum && !isKey; i++)
+            isKey = deferredDestroys[i].fence == (Fence*)readyFence.object;
+
+        if (isKey)
+            deferredDestroys.push_back(readyFence);
+        else
+            Destroy(readyFence);
+    }
+}
+
+void HelperDeferredDestroyer::Destroy(const DeferredDestroyDesc& deferredDestroyDesc) {
+    void* object = deferredDestroyDesc.object;
+
+    switch (deferredDestroyDesc.type) {
+        case DeferredDestroyType::COMMAND_ALLOCATOR:
+            m_iCore.DestroyCommandAllocator(*(CommandAllocator*)object);
+            break;
+        case DeferredDestroyType::COMMAND_BUFFER:
+            m_iCore.DestroyCommandBuffer(*(CommandBuffer*)object);
+            break;
+        case DeferredDestroyType::DESCRIPTOR_POOL:
+            m_iCore.DestroyDescriptorPool(*(DescriptorPool*)object);
+            break;
+        case DeferredDestroyType::BUFFER:
+            m_iCore.DestroyBuffer(*(Buffer*)object);
+            break;
+        case DeferredDestroyType::TEXTURE:
+            m_iCore.DestroyTexture(*(Texture*)object);
+            break;
+        case DeferredDestroyType::DESCRIPTOR:
+            m_iCore.DestroyDescriptor(*(Descriptor*)object);
+            break;
+        case DeferredDestroyType::PIPELINE_LAYOUT:
+            m_iCore.DestroyPipelineLayout(*(PipelineLayout*)object);
+            break;
+        case DeferredDestroyType::PIPELINE:
+            m_iCore.DestroyPipeline(*(Pipeline*)object);
+            break;
+        case DeferredDestroyType::QUERY_POOL:
+            m_iCore.DestroyQueryPool(*(QueryPool*)object);
+            break;
+        case DeferredDestroyType::FENCE:
+            m_iCore.DestroyFence(*(Fence*)object);
+            break;
+        case DeferredDestroyType::MEMORY:
+            m_iCore.FreeMemory(*(Memory*)object);
+            break;
+        default:
+            break;
+    }
+}
+
 HelperDeviceMemoryAllocator::HelperDeviceMemoryAllocator(const CoreInterface& NRI, Device& device)
     : m_iCore(NRI)
     , m_Device(device)
@@ -3,8 +3,20 @@
 #pragma once
 
 #include <atomic>
+#include <thread>
+
+#if NRI_ENABLE_LOCK_STATS
+#    include <chrono>
+#endif
+
+#if (defined(__linux__) || defined(__ANDROID__))
+#    include <linux/futex.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif
 
 constexpr size_t LOCK_CACHELINE_SIZE = 64;
+constexpr uint32_t LOCK_SPIN_MAX_PAUSE_NUM = 128; // the last backoff step, ~256 pauses in total before parking
 
 // Found in sse2neon
 #if (defined(__arm__) || defined(__aarch64__) || defined(_M_ARM64) || defined(_M_ARM))
@@ -19,22 +31,94 @@ inline void _mm_pause() {
 #    include <xmmintrin.h>
 #endif
 
-// Very lightweight exclusive lock
+#if NRI_ENABLE_LOCK_STATS
+
+// Accumulated over all locks, see "nriGetLockStats"
+struct LockCounters {
+    std::atomic_uint64_t acquisitionNum;
+    std::atomic_uint64_t contendedAcquisitionNum;
+    std::atomic_uint64_t parkNum;
+    std::atomic_uint64_t spinTime;
+};
+
+inline LockCounters g_LockCounters = {};
+
+#endif
+
+// Lightweight exclusive lock: bounded exponential spinning, then parking (a futex on Linux, yielding elsewhere)
 struct alignas(LOCK_CACHELINE_SIZE) Lock {
     inline Lock() {
-        m_Atomic.store(0, std::memory_order_relaxed);
+        m_Atomic.store(UNLOCKED, std::memory_order_relaxed);
     }
 
     inline void Acquire() {
-        while (m_Atomic.exchange(1, std::memory_order_acquire))
-            _mm_pause();
+#if NRI_ENABLE_LOCK_STATS
+        g_LockCounters.acquisitionNum.fetch_add(1, std::memory_order_relaxed);
+#endif
+
+        uint32_t expected = UNLOCKED;
+        if (!m_Atomic.compare_exchange_strong(expected, LOCKED, std::memory_order_acquire, std::memory_order_relaxed))
+            AcquireContended();
     }
 
     inline void Release() {
-        m_Atomic.store(0, std::memory_order_release);
+        if (m_Atomic.exchange(UNLOCKED, std::memory_order_release) == LOCKED_WITH_WAITERS)
+            Wake();
     }
 
 private:
+    enum : uint32_t {
+        UNLOCKED,
+        LOCKED,
+        LOCKED_WITH_WAITERS,
+    };
+
+    inline void AcquireContended() {
+#if NRI_ENABLE_LOCK_STATS
+        g_LockCounters.contendedAcquisitionNum.fetch_add(1, std::memory_order_relaxed);
+        auto begin = std::chrono::steady_clock::now();
+#endif
+
+        bool isAcquired = false;
+        for (uint32_t pauseNum = 1; pauseNum <= LOCK_SPIN_MAX_PAUSE_NUM && !isAcquired; pauseNum *= 2) {
+            for (uint32_t i = 0; i < pauseNum; i++)
+                _mm_pause();
+
+            uint32_t expected = UNLOCKED;
+            isAcquired = m_Atomic.load(std::memory_order_relaxed) == UNLOCKED && m_Atomic.compare_exchange_strong(expected, LOCKED, std::memory_order_acquire, std::memory_order_relaxed);
+        }
+
+#if NRI_ENABLE_LOCK_STATS
+        auto end = std::chrono::steady_clock::now();
+        g_LockCounters.spinTime.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count(), std::memory_order_relaxed);
+#endif
+
+        if (isAcquired)
+            return;
+
+#if NRI_ENABLE_LOCK_STATS
+        g_LockCounters.parkNum.fetch_add(1, std::memory_order_relaxed);
+#endif
+
+        // Park, marking the lock as having waiters (it stays marked until "Release", even if the waiter is the last one)
+        while (m_Atomic.exchange(LOCKED_WITH_WAITERS, std::memory_order_acquire) != UNLOCKED)
+            Wait();
+    }
+
+    inline void Wait() {
+#if (defined(__linux__) || defined(__ANDROID__))
+        syscall(SYS_futex, (uint32_t*)&m_Atomic, FUTEX_WAIT_PRIVATE, LOCKED_WITH_WAITERS, nullptr, nullptr, 0);
+#else
+        std::this_thread::yield();
+#endif
+    }
+
+    inline void Wake() {
+#if (defined(__linux__) || defined(__ANDROID__))
+        syscall(SYS_futex, (uint32_t*)&m_Atomic, FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+#endif
+    }
+
     std::atomic_uint32_t m_Atomic;
 };
 
@@ -0,0 +1,110 @@
+// © 2025 NVIDIA Corporation
+
+#pragma once
+
+namespace nri {
+
+constexpr uint32_t SCHEDULE_QUEUE_MAX_NUM = (uint32_t)QueueType::MAX_NUM;
+
+struct ScheduleResourceState {
+    // Current schedule (nodes)
+    int32_t lastWriter;
+    std::array<int32_t, SCHEDULE_QUEUE_MAX_NUM> lastReaders; // per slot, since the last write
+
+    // Previous schedules (fence values, "0" if none)
+    uint64_t prevWriterValue;
+    uint32_t prevWriterSlot;
+    std::array<uint64_t, SCHEDULE_QUEUE_MAX_NUM> prevReaderValues; // per slot, since the last write
+};
+
+struct ScheduleNode {
+    std::array<int32_t, SCHEDULE_QUEUE_MAX_NUM> dependencies; // the latest node to wait for per slot, "-1" if none
+    std::array<uint64_t, SCHEDULE_QUEUE_MAX_NUM> prevDependencies; // fence values of previous schedules to wait for per slot, "0" if none
+    uint32_t slot;
+    uint32_t batch;
+    bool hasCrossQueueDependents;
+};
+
+struct ScheduleBatch {
+    uint32_t slot;
+    uint32_t waitOffset; // in "m_Waits[slot]"
+    uint32_t waitNum;
+    uint32_t commandBufferOffset; // in "m_CommandBuffers[slot]"
+    uint32_t commandBufferNum;
+    uint32_t signalOffset; // in "m_Signals[slot]"
+    uint32_t signalNum;
+    uint64_t signalValue;
+};
+
+struct QueueSchedulerImpl : public DebugNameBase {
+    inline QueueSchedulerImpl(Device& device, const CoreInterface& NRI)
+        : m_Device(device)
+        , m_iCore(NRI)
+        , m_Resources(((DeviceBase&)device).GetStdAllocator())
+        , m_Nodes(((DeviceBase&)device).GetStdAllocator())
+        , m_Batches(((DeviceBase&)device).GetStdAllocator())
+        , m_SubmitDescs(((DeviceBase&)device).GetStdAllocator())
+        , m_Waits{
+              Vector<FenceSubmitDesc>(((DeviceBase&)device).GetStdAllocator()),
+              Vector<FenceSubmitDesc>(((DeviceBase&)device).GetStdAllocator()),
+              Vector<FenceSubmitDesc>(((DeviceBase&)device).GetStdAllocator()),
+          }
+        , m_Signals{
+              Vector<FenceSubmitDesc>(((DeviceBase&)device).GetStdAllocator()),
+              Vector<FenceSubmitDesc>(((DeviceBase&)device).GetStdAllocator()),
+              Vector<FenceSubmitDesc>(((DeviceBase&)device).GetStdAllocator()),
+          }
+        , m_CommandBuffers{
+              Vector<const CommandBuffer*>(((DeviceBase&)device).GetStdAllocator()),
+              Vector<const CommandBuffer*>(((DeviceBase&)device).GetStdAllocator()),
+              Vector<const CommandBuffer*>(((DeviceBase&)device).GetStdAllocator()),
+          } {
+    }
+
+    inline Device& GetDevice() const {
+        return m_Device;
+    }
+
+    inline Queue* GetQueue(QueueType queueType) const {
+        return m_Queues[m_Slots[(uint32_t)queueType]];
+    }
+
+    ~QueueSchedulerImpl();
+
+    Result Create();
+    Result Submit(const ScheduleDesc& scheduleDesc);
+
+    //================================================================================================================
+    // DebugNameBase
+    //================================================================================================================
+
+    void SetDebugName(const char* name) DEBUG_NAME_OVERRIDE {
+        for (Fence* fence : m_Fences) {
+            if (fence)
+                m_iCore.SetDebugName(fence, name);
+        }
+    }
+
+private:
+    void FindDependencies(const ScheduleDesc& scheduleDesc);
+    void PlanBatches(const ScheduleDesc& scheduleDesc);
+    void UpdateResourceStates();
+    uint32_t AddBatch(uint32_t slot);
+
+    Device& m_Device;
+    const CoreInterface& m_iCore;
+    UnorderedMap<const void*, ScheduleResourceState> m_Resources; // persistent, pruned once all accesses are completed
+    Vector<ScheduleNode> m_Nodes;
+    Vector<ScheduleBatch> m_Batches;
+    Vector<QueueSubmitDesc> m_SubmitDescs;
+    std::array<Vector<FenceSubmitDesc>, SCHEDULE_QUEUE_MAX_NUM> m_Waits;
+    std::array<Vector<FenceSubmitDesc>, SCHEDULE_QUEUE_MAX_NUM> m_Signals;
+    std::array<Vector<const CommandBuffer*>, SCHEDULE_QUEUE_MAX_NUM> m_CommandBuffers;
+    std::array<Queue*, SCHEDULE_QUEUE_MAX_NUM> m_Queues = {};  // per slot (a distinct queue)
+    std::array<Fence*, SCHEDULE_QUEUE_MAX_NUM> m_Fences = {};  // per slot
+    std::array<uint64_t, SCHEDULE_QUEUE_MAX_NUM> m_FenceValues = {};
+    std::array<uint32_t, SCHEDULE_QUEUE_MAX_NUM> m_Slots = {}; // queue type => slot
+    uint32_t m_SlotNum = 0;
+};
+
+} // namespace nri
@@ -0,0 +1,276 @@
+// © 2025 NVIDIA Corporation
+
+QueueSchedulerImpl::~QueueSchedulerImpl() {
+    for (Fence* fence : m_Fences) {
+        if (fence)
+            m_iCore.DestroyFence(*fence);
+    }
+}
+
+Result QueueSchedulerImpl::Create() {
+    const DeviceDesc& deviceDesc = m_iCore.GetDeviceDesc(m_Device);
+
+    Queue* graphicsQueue = nullptr;
+    Result result = m_iCore.GetQueue(m_Device, QueueType::GRAPHICS, 0, graphicsQueue);
+    if (result != Result::SUCCESS)
+        return result;
+
+    // Missing queue types fall back to GRAPHICS, equal queues share a slot. D3D11 has only one context, so cross-queue waits would deadlock it
+    for (uint32_t i = 0; i < SCHEDULE_QUEUE_MAX_NUM; i++) {
+        Queue* queue = nullptr;
+        if (deviceDesc.graphicsAPI == GraphicsAPI::D3D11 || m_iCore.GetQueue(m_Device, (QueueType)i, 0, queue) != Result::SUCCESS)
+            queue = graphicsQueue;
+
+        uint32_t slot = 0;
+        while (slot < m_SlotNum && m_Queues[slot] != queue)
+            slot++;
+
+        if (slot == m_SlotNum) {
+            result = m_iCore.CreateFence(m_Device, 0, m_Fences[slot]);
+            if (result != Result::SUCCESS)
+                return result;
+
+            m_Queues[slot] = queue;
+            m_SlotNum++;
+        }
+
+        m_Slots[i] = slot;
+    }
+
+    return Result::SUCCESS;
+}
+
+void QueueSchedulerImpl::FindDependencies(const ScheduleDesc& scheduleDesc) {
+    m_Nodes.resize(scheduleDesc.nodeNum);
+
+    for (uint32_t i = 0; i < scheduleDesc.nodeNum; i++) {
+        const ScheduleNodeDesc& nodeDesc = scheduleDesc.nodes[i];
+
+        ScheduleNode& node = m_Nodes[i];
+        node.dependencies.fill(-1);
+        node.prevDependencies.fill(0);
+        node.slot = m_Slots[(uint32_t)nodeDesc.queueType];
+        node.batch = 0;
+        node.hasCrossQueueDependents = false;
+
+        for (uint32_t j = 0; j < nodeDesc.resourceNum; j++) {
+            const ScheduleResourceDesc& resourceDesc = nodeDesc.resources[j];
+
+            auto it = m_Resources.find(resourceDesc.resource);
+            if (it == m_Resources.end()) {
+                ScheduleResourceState state = {};
+                state.lastWriter = -1;
+                state.lastReaders.fill(-1);
+
+                it = m_Resources.insert({resourceDesc.resource, state}).first;
+            }
+
+            // Only cross-queue dependencies matter, a queue executes its own work in order
+            ScheduleResourceState& state = it->second;
+            std::array<int32_t, SCHEDULE_QUEUE_MAX_NUM + 1> producers = {state.lastWriter};
+            if (resourceDesc.isWrite)
+                std::copy(state.lastReaders.begin(), state.lastReaders.end(), producers.begin() + 1);
+            else
+                std::fill(producers.begin() + 1, producers.end(), -1);
+
+            for (int32_t producer : producers) {
+                if (producer < 0 || producer == (int32_t)i || m_Nodes[producer].slot == node.slot)
+                    continue;
+
+                int32_t& dependency = node.dependencies[m_Nodes[producer].slot];
+                dependency = std::max(dependency, producer);
+
+                m_Nodes[producer].hasCrossQueueDependents = true;
+            }
+
+            // Accesses from previous schedules (cleared by the first write in this schedule, which depends on them)
+            if (state.prevWriterValue && state.prevWriterSlot != node.slot) {
+                uint64_t& prevDependency = node.prevDependencies[state.prevWriterSlot];
+                prevDependency = std::max(prevDependency, state.prevWriterValue);
+            }
+
+            if (resourceDesc.isWrite) {
+                for (uint32_t k = 0; k < m_SlotNum; k++) {
+                    if (k != node.slot)
+                        node.prevDependencies[k] = std::max(node.prevDependencies[k], state.prevReaderValues[k]);
+                }
+
+                state.prevWriterValue = 0;
+                state.prevReaderValues.fill(0);
+
+                state.lastWriter = (int32_t)i;
+                state.lastReaders.fill(-1);
+            } else
+                state.lastReaders[node.slot] = (int32_t)i;
+        }
+    }
+}
+
+uint32_t QueueSchedulerImpl::AddBatch(uint32_t slot) {
+    ScheduleBatch& batch = m_Batches.emplace_back();
+    batch = {};
+    batch.slot = slot;
+    batch.waitOffset = (uint32_t)m_Waits[slot].size();
+    batch.commandBufferOffset = (uint32_t)m_CommandBuffers[slot].size();
+    batch.signalOffset = (uint32_t)m_Signals[slot].size();
+    batch.signalNum = 1;
+    batch.signalValue = ++m_FenceValues[slot];
+
+    m_Signals[slot].push_back({m_Fences[slot], batch.signalValue});
+
+    return (uint32_t)m_Batches.size() - 1;
+}
+
+void QueueSchedulerImpl::PlanBatches(const ScheduleDesc& scheduleDesc) {
+    m_Batches.clear();
+    for (uint32_t i = 0; i < m_SlotNum; i++) {
+        m_Waits[i].clear();
+        m_Signals[i].clear();
+        m_CommandBuffers[i].clear();
+    }
+
+    std::array<int32_t, SCHEDULE_QUEUE_MAX_NUM> openBatches;
+    openBatches.fill(-1);
+
+    std::array<bool, SCHEDULE_QUEUE_MAX_NUM> isUsed = {};
+
+    for (uint32_t i = 0; i < scheduleDesc.nodeNum; i++) {
+        const ScheduleNodeDesc& nodeDesc = scheduleDesc.nodes[i];
+        ScheduleNode& node = m_Nodes[i];
+        uint32_t slot = node.slot;
+
+        // A new batch starts with cross-queue waits
+        bool hasCrossQueueDependencies = false;
+        for (uint32_t j = 0; j < m_SlotNum; j++)
+            hasCrossQueueDependencies |= node.dependencies[j] >= 0 || node.prevDependencies[j] != 0;
+
+        if (openBatches[slot] < 0 || hasCrossQueueDependencies) {
+            openBatches[slot] = (int32_t)AddBatch(slot);
+            ScheduleBatch& batch = m_Batches.back();
+
+            if (!isUsed[slot]) {
+                m_Waits[slot].insert(m_Waits[slot].end(), scheduleDesc.waitFences, scheduleDesc.waitFences + scheduleDesc.waitFenceNum);
+                batch.waitNum += scheduleDesc.waitFenceNum;
+                isUsed[slot] = true;
+            }
+
+            // A dependency in this schedule implies dependencies on the same queue in previous schedules
+            for (uint32_t j = 0; j < m_SlotNum; j++) {
+                int32_t dependency = node.dependencies[j];
+                uint64_t value = dependency >= 0 ? m_Batches[m_Nodes[dependency].batch].signalValue : node.prevDependencies[j];
+                if (value) {
+                    m_Waits[slot].push_back({m_Fences[j], value});
+                    batch.waitNum++;
+                }
+            }
+        }
+
+        node.batch = (uint32_t)openBatches[slot];
+
+        ScheduleBatch& batch = m_Batches[node.batch];
+        m_CommandBuffers[slot].insert(m_CommandBuffers[slot].end(), nodeDesc.commandBuffers, nodeDesc.commandBuffers + nodeDesc.commandBufferNum);
+        batch.commandBufferNum += nodeDesc.commandBufferNum;
+
+        // A batch ends with a signal someone waits for, to not delay dependents by the rest of the batch
+        if (node.hasCrossQueueDependents)
+            openBatches[slot] = -1;
+    }
+
+    // Join on the graphics queue (slot 0)
+    if (scheduleDesc.signalFenceNum) {
+        AddBatch(0);
+        ScheduleBatch& batch = m_Batches.back();
+
+        if (!isUsed[0]) {
+            m_Waits[0].insert(m_Waits[0].end(), scheduleDesc.waitFences, scheduleDesc.waitFences + scheduleDesc.waitFenceNum);
+            batch.waitNum += scheduleDesc.waitFenceNum;
+        }
+
+        for (uint32_t i = 1; i < m_SlotNum; i++) {
+            if (isUsed[i]) {
+                m_Waits[0].push_back({m_Fences[i], m_FenceValues[i]});
+                batch.waitNum++;
+            }
+        }
+
+        m_Signals[0].insert(m_Signals[0].end(), scheduleDesc.signalFences, scheduleDesc.signalFences + scheduleDesc.signalFenceNum);
+        batch.signalNum += scheduleDesc.signalFenceNum;
+    }
+}
+
+void QueueSchedulerImpl::UpdateResourceStates() {
+    std::array<uint64_t, SCHEDULE_QUEUE_MAX_NUM> completedValues = {};
+    for (uint32_t i = 0; i < m_SlotNum; i++)
+        completedValues[i] = m_iCore.GetFenceValue(*m_Fences[i]);
+
+    // Node indices become fence values for the next schedules
+    for (auto it = m_Resources.begin(); it != m_Resources.end();) {
+        ScheduleResourceState& state = it->second;
+
+        if (state.lastWriter >= 0) {
+            const ScheduleNode& node = m_Nodes[state.lastWriter];
+            state.prevWriterValue = m_Batches[node.batch].signalValue;
+            state.prevWriterSlot = node.slot;
+        }
+
+        for (uint32_t i = 0; i < m_SlotNum; i++) {
+            int32_t lastReader = state.lastReaders[i];
+            if (lastReader >= 0)
+                state.prevReaderValues[i] = m_Batches[m_Nodes[lastReader].batch].signalValue;
+        }
+
+        state.lastWriter = -1;
+        state.lastReaders.fill(-1);
+
+        // Completed accesses don't need waits
+        if (state.prevWriterValue <= completedValues[state.prevWriterSlot])
+            state.prevWriterValue = 0;
+
+        bool isPending = state.prevWriterValue != 0;
+        for (uint32_t i = 0; i < m_SlotNum; i++) {
+            if (state.prevReaderValues[i] <= completedValues[i])
+                state.prevReaderValues[i] = 0;
+
+            isPending |= state.prevReaderValues[i] != 0;
+        }
+
+        if (isPending)
+            it++;
+        else
+            it = m_Resources.erase(it);
+    }
+}
+
+Result QueueSchedulerImpl::Submit(const ScheduleDesc& scheduleDesc) {
+    FindDependencies(scheduleDesc);
+    PlanBatches(scheduleDesc);
+
+    // One submission per queue (waits on values of other queues submitted later are fine for timeline fences)
+    for (uint32_t i = 0; i < m_SlotNum; i++) {
+        m_SubmitDescs.clear();
+
+        for (const ScheduleBatch& batch : m_Batches) {
+            if (batch.slot != i)
+                continue;
+
+            QueueSubmitDesc& queueSubmitDesc = m_SubmitDescs.emplace_back();
+            queueSubmitDesc = {};
+            queueSubmitDesc.waitFences = m_Waits[i].data() + batch.waitOffset;
+            queueSubmitDesc.waitFenceNum = batch.waitNum;
+            queueSubmitDesc.commandBuffers = m_CommandBuffers[i].data() + batch.commandBufferOffset;
+            queueSubmitDesc.commandBufferNum = batch.commandBufferNum;
+            queueSubmitDesc.signalFences = m_Signals[i].data() + batch.signalOffset;
+            queueSubmitDesc.signalFenceNum = batch.signalNum;
+        }
+
+        if (!m_SubmitDescs.empty()) {
+            Result result = m_iCore.QueueSubmitMulti(*m_Queues[i], m_SubmitDescs.data(), (uint32_t)m_SubmitDescs.size());
+            if (result != Result::SUCCESS)
+                return result;
+        }
+    }
+
+    UpdateResourceStates();
+
+    return Result::SUCCESS;
+}
@@ -0,0 +1,127 @@
+// © 2025 NVIDIA Corporation
+
+#pragma once
+
+namespace nri {
+
+constexpr uint32_t RENDER_GRAPH_NOT_USED = uint32_t(-1);
+
+struct RenderGraphBarrierRange {
+    uint32_t textureOffset; // in "m_TextureBarriers"
+    uint32_t textureNum;
+    uint32_t bufferOffset; // in "m_BufferBarriers"
+    uint32_t bufferNum;
+};
+
+struct RenderGraphResource {
+    RenderGraphResourceDesc desc;
+    Texture* texture;
+    Buffer* buffer;
+    AccessLayoutStage state;      // while planning
+    AccessLayoutStage finalState; // at the end of the graph
+    uint32_t firstPass;           // alive pass index
+    uint32_t lastPass;
+    uint32_t prevOccupant; // transient: the resource, which used the memory before
+    bool isNeeded;
+    bool isWritten; // the last access was a write
+};
+
+struct RenderGraphPass {
+    RenderGraphPassDesc desc; // "reads" and "writes" are valid only during compilation
+    RenderGraphBarrierRange barriers;
+};
+
+struct RenderGraphPassAccess {
+    uint32_t resourceIndex;
+    AccessLayoutStage state;
+    bool isWrite;
+};
+
+struct RenderGraphTransient {
+    RenderGraphResourceType type;
+    TextureDesc textureDesc;
+    BufferDesc bufferDesc;
+    uint32_t resourceIndex;
+    uint32_t firstPass;
+    uint32_t lastPass;
+    Texture* texture;
+    Buffer* buffer;
+    MemoryDesc memoryDesc;
+    uint32_t heapIndex;
+};
+
+struct RenderGraphHeap {
+    Memory* memory;
+    uint64_t size;
+    MemoryType type;
+    bool isDedicated;
+};
+
+struct RenderGraphImpl : public DebugNameBase {
+    inline RenderGraphImpl(Device& device, const CoreInterface& NRI)
+        : m_Device(device)
+        , m_iCore(NRI)
+        , m_Resources(((DeviceBase&)device).GetStdAllocator())
+        , m_Passes(((DeviceBase&)device).GetStdAllocator())
+        , m_AlivePasses(((DeviceBase&)device).GetStdAllocator())
+        , m_PassAccesses(((DeviceBase&)device).GetStdAllocator())
+        , m_Transients(((DeviceBase&)device).GetStdAllocator())
+        , m_NewTransients(((DeviceBase&)device).GetStdAllocator())
+        , m_Heaps(((DeviceBase&)device).GetStdAllocator())
+        , m_TextureBarriers(((DeviceBase&)device).GetStdAllocator())
+        , m_BufferBarriers(((DeviceBase&)device).GetStdAllocator()) {
+    }
+
+    inline Device& GetDevice() const {
+        return m_Device;
+    }
+
+    inline Texture* GetTexture(uint32_t resourceIndex) const {
+        return resourceIndex < m_Resources.size() ? m_Resources[resourceIndex].texture : nullptr;
+    }
+
+    inline Buffer* GetBuffer(uint32_t resourceIndex) const {
+        return resourceIndex < m_Resources.size() ? m_Resources[resourceIndex].buffer : nullptr;
+    }
+
+    ~RenderGraphImpl();
+
+    Result Compile(const RenderGraphDesc& renderGraphDesc);
+    void GetStats(RenderGraphStats& renderGraphStats) const;
+    void CmdExecute(CommandBuffer& commandBuffer) const;
+
+    //================================================================================================================
+    // DebugNameBase
+    //================================================================================================================
+
+    void SetDebugName(const char* name) DEBUG_NAME_OVERRIDE {
+        for (const RenderGraphHeap& heap : m_Heaps)
+            m_iCore.SetDebugName(heap.memory, name);
+    }
+
+private:
+    void Cull(const RenderGraphDesc& renderGraphDesc);
+    Result UpdateTransientResources();
+    Result CreateTransientResources();
+    void DestroyTransientResources();
+    void GatherPassAccesses(const RenderGraphPassDesc& passDesc);
+    void PlanBarriers(bool isEmitted);
+    void CmdBarriers(CommandBuffer& commandBuffer, const RenderGraphBarrierRange& barriers) const;
+
+    Device& m_Device;
+    const CoreInterface& m_iCore;
+    Vector<RenderGraphResource> m_Resources;
+    Vector<RenderGraphPass> m_Passes; // alive
+    Vector<uint32_t> m_AlivePasses;   // indices in "RenderGraphDesc::passes", in reverse order
+    Vector<RenderGraphPassAccess> m_PassAccesses;
+    Vector<RenderGraphTransient> m_Transients;
+    Vector<RenderGraphTransient> m_NewTransients;
+    Vector<RenderGraphHeap> m_Heaps;
+    Vector<TextureBarrierDesc> m_TextureBarriers;
+    Vector<BufferBarrierDesc> m_BufferBarriers;
+    RenderGraphBarrierRange m_FinalBarriers = {};
+    uint64_t m_TransientMemorySize = 0;
+    uint64_t m_TransientResourceSize = 0;
+};
+
+} // namespace nri
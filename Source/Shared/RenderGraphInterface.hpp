@@ -0,0 +1,477 @@
+// © 2025 NVIDIA Corporation
+
+#include <algorithm>
+
+constexpr AccessBits RENDER_GRAPH_WRITE_ACCESS = AccessBits::SCRATCH_BUFFER | AccessBits::COLOR_ATTACHMENT | AccessBits::DEPTH_STENCIL_ATTACHMENT_WRITE
+    | AccessBits::ACCELERATION_STRUCTURE_WRITE | AccessBits::MICROMAP_WRITE | AccessBits::SHADER_RESOURCE_STORAGE | AccessBits::COPY_DESTINATION | AccessBits::RESOLVE_DESTINATION;
+
+static inline StageBits MergeStages(StageBits stages1, StageBits stages2) {
+    if (stages1 == StageBits::NONE)
+        return stages2;
+
+    if (stages2 == StageBits::NONE)
+        return stages1;
+
+    if (stages1 == StageBits::ALL || stages2 == StageBits::ALL)
+        return StageBits::ALL;
+
+    return stages1 | stages2;
+}
+
+static inline bool IsStagesCovered(StageBits stages, StageBits subset) {
+    if (stages == StageBits::ALL || subset == StageBits::NONE)
+        return true;
+
+    if (subset == StageBits::ALL || stages == StageBits::NONE)
+        return false;
+
+    return (subset & ~stages) == 0;
+}
+
+static inline bool IsSameTransient(const RenderGraphTransient& a, const RenderGraphTransient& b) {
+    if (a.type != b.type || a.resourceIndex != b.resourceIndex || a.firstPass != b.firstPass || a.lastPass != b.lastPass)
+        return false;
+
+    if (a.type == RenderGraphResourceType::BUFFER)
+        return a.bufferDesc.size == b.bufferDesc.size && a.bufferDesc.structureStride == b.bufferDesc.structureStride && a.bufferDesc.usage == b.bufferDesc.usage;
+
+    const TextureDesc& ta = a.textureDesc;
+    const TextureDesc& tb = b.textureDesc;
+
+    return ta.type == tb.type && ta.usage == tb.usage && ta.format == tb.format
+        && ta.width == tb.width && ta.height == tb.height && ta.depth == tb.depth
+        && ta.mipNum == tb.mipNum && ta.layerNum == tb.layerNum && ta.sampleNum == tb.sampleNum
+        && ta.sharingMode == tb.sharingMode && !memcmp(&ta.optimizedClearValue, &tb.optimizedClearValue, sizeof(ClearValue));
+}
+
+RenderGraphImpl::~RenderGraphImpl() {
+    DestroyTransientResources();
+}
+
+Result RenderGraphImpl::Compile(const RenderGraphDesc& renderGraphDesc) {
+    m_Resources.resize(renderGraphDesc.resourceNum);
+    for (uint32_t i = 0; i < renderGraphDesc.resourceNum; i++) {
+        const RenderGraphResourceDesc& resourceDesc = renderGraphDesc.resources[i];
+
+        RenderGraphResource& resource = m_Resources[i];
+        resource = {};
+        resource.desc = resourceDesc;
+        resource.texture = resourceDesc.texture;
+        resource.buffer = resourceDesc.buffer;
+        resource.firstPass = RENDER_GRAPH_NOT_USED;
+        resource.lastPass = RENDER_GRAPH_NOT_USED;
+        resource.prevOccupant = i;
+        resource.isNeeded = resourceDesc.texture || resourceDesc.buffer;
+    }
+
+    Cull(renderGraphDesc);
+
+    // Lifetimes
+    for (uint32_t i = 0; i < (uint32_t)m_Passes.size(); i++) {
+        GatherPassAccesses(m_Passes[i].desc);
+
+        for (const RenderGraphPassAccess& access : m_PassAccesses) {
+            RenderGraphResource& resource = m_Resources[access.resourceIndex];
+            if (resource.firstPass == RENDER_GRAPH_NOT_USED)
+                resource.firstPass = i;
+
+            resource.lastPass = i;
+        }
+    }
+
+    Result result = UpdateTransientResources();
+    if (result != Result::SUCCESS) {
+        m_Passes.clear();
+        m_TextureBarriers.clear();
+        m_BufferBarriers.clear();
+        m_FinalBarriers = {};
+
+        return result;
+    }
+
+    // The first run finds final states, needed for transitions of aliased memory
+    PlanBarriers(false);
+    PlanBarriers(true);
+
+    for (RenderGraphPass& pass : m_Passes) {
+        pass.desc.reads = nullptr;
+        pass.desc.readNum = 0;
+        pass.desc.writes = nullptr;
+        pass.desc.writeNum = 0;
+    }
+
+    return Result::SUCCESS;
+}
+
+void RenderGraphImpl::GetStats(RenderGraphStats& renderGraphStats) const {
+    renderGraphStats = {};
+    renderGraphStats.transientMemorySize = m_TransientMemorySize;
+    renderGraphStats.transientResourceSize = m_TransientResourceSize;
+    renderGraphStats.passNum = (uint32_t)m_Passes.size();
+    renderGraphStats.barrierNum = (uint32_t)(m_TextureBarriers.size() + m_BufferBarriers.size());
+
+    for (const RenderGraphPass& pass : m_Passes) {
+        if (pass.barriers.textureNum || pass.barriers.bufferNum)
+            renderGraphStats.barrierGroupNum++;
+    }
+
+    if (m_FinalBarriers.textureNum || m_FinalBarriers.bufferNum)
+        renderGraphStats.barrierGroupNum++;
+}
+
+void RenderGraphImpl::CmdExecute(CommandBuffer& commandBuffer) const {
+    for (const RenderGraphPass& pass : m_Passes) {
+        CmdBarriers(commandBuffer, pass.barriers);
+
+        if (pass.desc.name)
+            m_iCore.CmdBeginAnnotation(commandBuffer, pass.desc.name, BGRA_UNUSED);
+
+        if (pass.desc.Record)
+            pass.desc.Record(commandBuffer, pass.desc.userArg);
+
+        if (pass.desc.name)
+            m_iCore.CmdEndAnnotation(commandBuffer);
+    }
+
+    CmdBarriers(commandBuffer, m_FinalBarriers);
+}
+
+void RenderGraphImpl::Cull(const RenderGraphDesc& renderGraphDesc) {
+    m_AlivePasses.clear();
+
+    for (uint32_t i = renderGraphDesc.passNum; i > 0; i--) {
+        const RenderGraphPassDesc& passDesc = renderGraphDesc.passes[i - 1];
+
+        bool isAlive = passDesc.hasSideEffects;
+        for (uint32_t j = 0; j < passDesc.writeNum && !isAlive; j++)
+            isAlive = m_Resources[passDesc.writes[j].resourceIndex].isNeeded;
+
+        if (!isAlive)
+            continue;
+
+        // Writes can be partial, so previous writers of a needed resource stay alive too
+        for (uint32_t j = 0; j < passDesc.readNum; j++)
+            m_Resources[passDesc.reads[j].resourceIndex].isNeeded = true;
+
+        m_AlivePasses.push_back(i - 1);
+    }
+
+    m_Passes.resize(m_AlivePasses.size());
+    for (size_t i = 0; i < m_AlivePasses.size(); i++) {
+        RenderGraphPass& pass = m_Passes[i];
+        pass = {};
+        pass.desc = renderGraphDesc.passes[m_AlivePasses[m_AlivePasses.size() - 1 - i]];
+    }
+}
+
+Result RenderGraphImpl::UpdateTransientResources() {
+    m_NewTransients.clear();
+
+    for (uint32_t i = 0; i < (uint32_t)m_Resources.size(); i++) {
+        const RenderGraphResource& resource = m_Resources[i];
+        if (resource.texture || resource.buffer || resource.firstPass == RENDER_GRAPH_NOT_USED)
+            continue;
+
+        RenderGraphTransient& transient = m_NewTransients.emplace_back();
+        transient = {};
+        transient.type = resource.desc.type;
+        transient.textureDesc = resource.desc.textureDesc;
+        transient.bufferDesc = resource.desc.bufferDesc;
+        transient.resourceIndex = i;
+        transient.firstPass = resource.firstPass;
+        transient.lastPass = resource.lastPass;
+        transient.heapIndex = RENDER_GRAPH_NOT_USED;
+    }
+
+    // Recreate only if something has changed
+    bool isSame = m_NewTransients.size() == m_Transients.size();
+    for (size_t i = 0; i < m_NewTransients.size() && isSame; i++)
+        isSame = IsSameTransient(m_NewTransients[i], m_Transients[i]);
+
+    if (!isSame) {
+        DestroyTransientResources();
+        m_Transients.assign(m_NewTransients.begin(), m_NewTransients.end());
+
+        Result result = CreateTransientResources();
+        if (result != Result::SUCCESS) {
+            DestroyTransientResources();
+            return result;
+        }
+    }
+
+    for (const RenderGraphTransient& transient : m_Transients) {
+        RenderGraphResource& resource = m_Resources[transient.resourceIndex];
+        resource.texture = transient.texture;
+        resource.buffer = transient.buffer;
+
+        // The first occupant follows the last one, since the memory is reused by the next execution
+        const RenderGraphTransient* prevTransient = nullptr;
+        const RenderGraphTransient* lastTransient = &transient;
+
+        for (const RenderGraphTransient& other : m_Transients) {
+            if (other.heapIndex != transient.heapIndex)
+                continue;
+
+            if (other.lastPass < transient.firstPass && (!prevTransient || other.lastPass > prevTransient->lastPass))
+                prevTransient = &other;
+
+            if (other.firstPass > lastTransient->firstPass)
+                lastTransient = &other;
+        }
+
+        resource.prevOccupant = (prevTransient ? prevTransient : lastTransient)->resourceIndex;
+    }
+
+    return Result::SUCCESS;
+}
+
+Result RenderGraphImpl::CreateTransientResources() {
+    // Resources
+    for (RenderGraphTransient& transient : m_Transients) {
+        const RenderGraphResourceDesc& resourceDesc = m_Resources[transient.resourceIndex].desc;
+
+        if (transient.type == RenderGraphResourceType::TEXTURE) {
+            Result result = m_iCore.CreateTexture(m_Device, transient.textureDesc, transient.texture);
+            if (result != Result::SUCCESS)
+                return result;
+
+            m_iCore.GetTextureMemoryDesc(*transient.texture, MemoryLocation::DEVICE, transient.memoryDesc);
+
+            if (resourceDesc.name)
+                m_iCore.SetDebugName(transient.texture, resourceDesc.name);
+        } else {
+            Result result = m_iCore.CreateBuffer(m_Device, transient.bufferDesc, transient.buffer);
+            if (result != Result::SUCCESS)
+                return result;
+
+            m_iCore.GetBufferMemoryDesc(*transient.buffer, MemoryLocation::DEVICE, transient.memoryDesc);
+
+            if (resourceDesc.name)
+                m_iCore.SetDebugName(transient.buffer, resourceDesc.name);
+        }
+
+        m_TransientResourceSize += transient.memoryDesc.size;
+    }
+
+    // Aliasing: bigger resources go first, each one into the first compatible heap with non-overlapping lifetimes of occupants
+    Vector<uint32_t> order(m_Transients.size(), 0, ((DeviceBase&)m_Device).GetStdAllocator());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+        return m_Transients[a].memoryDesc.size > m_Transients[b].memoryDesc.size;
+    });
+
+    for (uint32_t i : order) {
+        RenderGraphTransient& transient = m_Transients[i];
+        const MemoryDesc& memoryDesc = transient.memoryDesc;
+
+        uint32_t heapIndex = (uint32_t)m_Heaps.size();
+        for (uint32_t j = 0; j < (uint32_t)m_Heaps.size() && heapIndex == m_Heaps.size() && !memoryDesc.mustBeDedicated; j++) {
+            const RenderGraphHeap& heap = m_Heaps[j];
+
+            bool isCompatible = !heap.isDedicated && heap.type == memoryDesc.type;
+            for (const RenderGraphTransient& other : m_Transients) {
+                if (other.heapIndex == j && other.firstPass <= transient.lastPass && transient.firstPass <= other.lastPass)
+                    isCompatible = false;
+            }
+
+            if (isCompatible)
+                heapIndex = j;
+        }
+
+        if (heapIndex == m_Heaps.size()) {
+            RenderGraphHeap& heap = m_Heaps.emplace_back();
+            heap = {};
+            heap.type = memoryDesc.type;
+            heap.isDedicated = memoryDesc.mustBeDedicated;
+        }
+
+        RenderGraphHeap& heap = m_Heaps[heapIndex];
+        heap.size = std::max(heap.size, memoryDesc.size);
+
+        transient.heapIndex = heapIndex;
+    }
+
+    // Memory
+    for (RenderGraphHeap& heap : m_Heaps) {
+        AllocateMemoryDesc allocateMemoryDesc = {};
+        allocateMemoryDesc.size = heap.size;
+        allocateMemoryDesc.type = heap.type;
+
+        Result result = m_iCore.AllocateMemory(m_Device, allocateMemoryDesc, heap.memory);
+        if (result != Result::SUCCESS)
+            return result;
+
+        m_TransientMemorySize += heap.size;
+    }
+
+    // Binding (all occupants at offset 0)
+    for (const RenderGraphTransient& transient : m_Transients) {
+        Memory* memory = m_Heaps[transient.heapIndex].memory;
+
+        Result result = Result::SUCCESS;
+        if (transient.texture) {
+            TextureMemoryBindingDesc textureMemoryBindingDesc = {transient.texture, memory, 0};
+            result = m_iCore.BindTextureMemory(m_Device, &textureMemoryBindingDesc, 1);
+        } else {
+            BufferMemoryBindingDesc bufferMemoryBindingDesc = {transient.buffer, memory, 0};
+            result = m_iCore.BindBufferMemory(m_Device, &bufferMemoryBindingDesc, 1);
+        }
+
+        if (result != Result::SUCCESS)
+            return result;
+    }
+
+    return Result::SUCCESS;
+}
+
+void RenderGraphImpl::DestroyTransientResources() {
+    for (const RenderGraphTransient& transient : m_Transients) {
+        if (transient.texture)
+            m_iCore.DestroyTexture(*transient.texture);
+
+        if (transient.buffer)
+            m_iCore.DestroyBuffer(*transient.buffer);
+    }
+
+    for (const RenderGraphHeap& heap : m_Heaps) {
+        if (heap.memory)
+            m_iCore.FreeMemory(*heap.memory);
+    }
+
+    m_Transients.clear();
+    m_Heaps.clear();
+    m_TransientMemorySize = 0;
+    m_TransientResourceSize = 0;
+}
+
+void RenderGraphImpl::GatherPassAccesses(const RenderGraphPassDesc& passDesc) {
+    m_PassAccesses.clear();
+
+    auto merge = [&](const RenderGraphAccessDesc& accessDesc, bool isWrite) {
+        for (RenderGraphPassAccess& access : m_PassAccesses) {
+            if (access.resourceIndex == accessDesc.resourceIndex) {
+                access.state.access |= accessDesc.state.access;
+                access.state.stages = MergeStages(access.state.stages, accessDesc.state.stages);
+                if (isWrite)
+                    access.state.layout = accessDesc.state.layout;
+                access.isWrite |= isWrite;
+
+                return;
+            }
+        }
+
+        m_PassAccesses.push_back({accessDesc.resourceIndex, accessDesc.state, isWrite});
+    };
+
+    for (uint32_t i = 0; i < passDesc.readNum; i++)
+        merge(passDesc.reads[i], false);
+
+    for (uint32_t i = 0; i < passDesc.writeNum; i++)
+        merge(passDesc.writes[i], true);
+}
+
+void RenderGraphImpl::PlanBarriers(bool isEmitted) {
+    m_TextureBarriers.clear();
+    m_BufferBarriers.clear();
+
+    for (RenderGraphResource& resource : m_Resources) {
+        if (resource.desc.texture || resource.desc.buffer) {
+            resource.state = resource.desc.initialState;
+            resource.isWritten = resource.state.access == AccessBits::NONE || (resource.state.access & RENDER_GRAPH_WRITE_ACCESS);
+        } else {
+            // Wait for the previous occupant of the memory, the content is discarded
+            resource.state = m_Resources[resource.prevOccupant].finalState;
+            resource.state.layout = Layout::UNDEFINED;
+            resource.isWritten = true;
+        }
+    }
+
+    auto addBarrier = [&](const RenderGraphResource& resource, const AccessLayoutStage& after) {
+        if (!isEmitted)
+            return;
+
+        if (resource.desc.type == RenderGraphResourceType::TEXTURE) {
+            TextureBarrierDesc& textureBarrierDesc = m_TextureBarriers.emplace_back();
+            textureBarrierDesc = {};
+            textureBarrierDesc.texture = resource.texture;
+            textureBarrierDesc.before = resource.state;
+            textureBarrierDesc.after = after;
+        } else {
+            BufferBarrierDesc& bufferBarrierDesc = m_BufferBarriers.emplace_back();
+            bufferBarrierDesc = {};
+            bufferBarrierDesc.buffer = resource.buffer;
+            bufferBarrierDesc.before = {resource.state.access, resource.state.stages};
+            bufferBarrierDesc.after = {after.access, after.stages};
+        }
+    };
+
+    auto beginRange = [&](RenderGraphBarrierRange& barriers) {
+        barriers.textureOffset = (uint32_t)m_TextureBarriers.size();
+        barriers.bufferOffset = (uint32_t)m_BufferBarriers.size();
+    };
+
+    auto endRange = [&](RenderGraphBarrierRange& barriers) {
+        barriers.textureNum = (uint32_t)m_TextureBarriers.size() - barriers.textureOffset;
+        barriers.bufferNum = (uint32_t)m_BufferBarriers.size() - barriers.bufferOffset;
+    };
+
+    // Passes (all barriers of a pass are merged into one group)
+    for (RenderGraphPass& pass : m_Passes) {
+        beginRange(pass.barriers);
+        GatherPassAccesses(pass.desc);
+
+        for (const RenderGraphPassAccess& access : m_PassAccesses) {
+            RenderGraphResource& resource = m_Resources[access.resourceIndex];
+
+            bool isTexture = resource.desc.type == RenderGraphResourceType::TEXTURE;
+            bool isReadAfterRead = !access.isWrite && !resource.isWritten && (!isTexture || resource.state.layout == access.state.layout);
+
+            // A read after reads needs no barrier, if the previous barrier already covers its access and stages
+            bool isCovered = isReadAfterRead && !(access.state.access & ~resource.state.access) && IsStagesCovered(resource.state.stages, access.state.stages);
+            if (!isCovered)
+                addBarrier(resource, access.state);
+
+            if (isReadAfterRead) {
+                resource.state.access |= access.state.access;
+                resource.state.stages = MergeStages(resource.state.stages, access.state.stages);
+            } else
+                resource.state = access.state;
+
+            resource.isWritten = access.isWrite;
+        }
+
+        endRange(pass.barriers);
+    }
+
+    // Final states
+    beginRange(m_FinalBarriers);
+
+    for (RenderGraphResource& resource : m_Resources) {
+        resource.finalState = resource.state;
+
+        if (!resource.desc.texture && !resource.desc.buffer)
+            continue;
+
+        const AccessLayoutStage& finalState = resource.desc.finalState;
+        bool isTexture = resource.desc.type == RenderGraphResourceType::TEXTURE;
+        bool isSame = resource.state.access == finalState.access && resource.state.stages == finalState.stages && (!isTexture || resource.state.layout == finalState.layout);
+
+        if (!isSame)
+            addBarrier(resource, finalState);
+    }
+
+    endRange(m_FinalBarriers);
+}
+
+void RenderGraphImpl::CmdBarriers(CommandBuffer& commandBuffer, const RenderGraphBarrierRange& barriers) const {
+    if (!barriers.textureNum && !barriers.bufferNum)
+        return;
+
+    BarrierGroupDesc barrierGroupDesc = {};
+    barrierGroupDesc.textures = m_TextureBarriers.data() + barriers.textureOffset;
+    barrierGroupDesc.textureNum = barriers.textureNum;
+    barrierGroupDesc.buffers = m_BufferBarriers.data() + barriers.bufferOffset;
+    barrierGroupDesc.bufferNum = barriers.bufferNum;
+
+    m_iCore.CmdBarrier(commandBuffer, barrierGroupDesc);
+}
@@ -8,6 +8,8 @@
 
 #include "HelperInterface.h"
 #include "ImguiInterface.h"
+#include "QueueSchedulerInterface.h"
+#include "RenderGraphInterface.h"
 #include "StreamerInterface.h"
 #include "UpscalerInterface.h"
 
@@ -15,6 +17,8 @@ using namespace nri;
 
 #include "HelperInterface.hpp"
 #include "ImguiInterface.hpp"
+#include "QueueSchedulerInterface.hpp"
+#include "RenderGraphInterface.hpp"
 #include "StreamerInterface.hpp"
 #include "UpscalerInterface.hpp"
 
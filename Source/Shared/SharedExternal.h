@@ -20,13 +20,22 @@ typedef uint32_t DXGI_FORMAT;
 #include "NRI.h"
 #include "NRI.hlsl"
 
+#include "Extensions/NRICommandBufferStats.h"
+#include "Extensions/NRIConditionalRendering.h"
 #include "Extensions/NRIDeviceCreation.h"
+#include "Extensions/NRIDeviceGeneratedCommands.h"
+#include "Extensions/NRIFenceCallback.h"
 #include "Extensions/NRIHelper.h"
 #include "Extensions/NRIImgui.h"
 #include "Extensions/NRILowLatency.h"
 #include "Extensions/NRIMeshShader.h"
+#include "Extensions/NRIQueueScheduler.h"
+#include "Extensions/NRIQueueTimeline.h"
 #include "Extensions/NRIRayTracing.h"
+#include "Extensions/NRIRenderGraph.h"
 #include "Extensions/NRIResourceAllocator.h"
+#include "Extensions/NRISecondaryCommandBuffer.h"
+#include "Extensions/NRISplitBarrier.h"
 #include "Extensions/NRIStreamer.h"
 #include "Extensions/NRISwapChain.h"
 #include "Extensions/NRIUpscaler.h"
@@ -4,6 +4,7 @@
 
 #include <assert.h>
 
+#include <cstddef>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -157,7 +158,83 @@ using String = std::basic_string<char, std::char_traits<char>, StdAllocator<char
 
 //================================================================================================================
 
-constexpr size_t MAX_STACK_ALLOC_SIZE = 32 * 1024;
+constexpr size_t MAX_STACK_ALLOC_SIZE = 4 * 1024;       // bigger scratch requests go to the thread-local arena
+constexpr size_t MIN_SCRATCH_ARENA_SIZE = 256 * 1024;
+
+// Per-thread linear allocator, rewound by "Scratch" destructors (LIFO by construction)
+// IMPORTANT: blocks come from the process-level allocator, since the arena outlives devices and their allocation callbacks
+class ScratchArena {
+public:
+    ~ScratchArena() {
+        Release();
+    }
+
+    inline void* Allocate(size_t size, size_t alignment, size_t& prevOffset) {
+        uint8_t* mem = m_Memory ? Align(m_Memory + m_Offset, alignment) : nullptr;
+        bool isFit = mem && mem + size <= m_Memory + m_Capacity;
+        bool isTooSmall = !m_Offset && m_DesiredCapacity > m_Capacity; // a previous request didn't fit
+
+        if (!isFit || isTooSmall) {
+            // Can't move or grow a block with live allocations
+            if (m_Offset) {
+                if (m_Offset + size + alignment > m_DesiredCapacity)
+                    m_DesiredCapacity = m_Offset + size + alignment;
+
+                return nullptr;
+            }
+
+            size_t capacity = isFit ? m_Capacity : m_Capacity * 2;
+            if (capacity < m_DesiredCapacity)
+                capacity = m_DesiredCapacity;
+            if (capacity < size + alignment)
+                capacity = size + alignment;
+            if (capacity < MIN_SCRATCH_ARENA_SIZE)
+                capacity = MIN_SCRATCH_ARENA_SIZE;
+
+            Release();
+
+            m_Memory = (uint8_t*)AlignedMalloc(nullptr, capacity, alignof(std::max_align_t));
+            if (!m_Memory)
+                return nullptr;
+
+            m_Capacity = capacity;
+            m_DesiredCapacity = 0;
+
+            mem = Align(m_Memory, alignment);
+        }
+
+        prevOffset = m_Offset;
+        m_Offset = (size_t)(mem + size - m_Memory);
+
+        return mem;
+    }
+
+    inline void Rewind(size_t offset) {
+        assert(offset <= m_Offset);
+        m_Offset = offset;
+    }
+
+    inline void Release() {
+        assert(m_Offset == 0);
+
+        AlignedFree(nullptr, m_Memory);
+
+        m_Memory = nullptr;
+        m_Capacity = 0;
+    }
+
+private:
+    uint8_t* m_Memory = nullptr;
+    size_t m_Capacity = 0;
+    size_t m_DesiredCapacity = 0;
+    size_t m_Offset = 0;
+};
+
+inline ScratchArena& GetScratchArena() {
+    static thread_local ScratchArena scratchArena;
+
+    return scratchArena;
+}
 
 template <typename T>
 class Scratch {
@@ -166,11 +243,22 @@ public:
         : m_Allocator(allocator)
         , m_Mem(mem)
         , m_Num(num) {
-        m_IsHeap = (num * sizeof(T) + alignof(T)) > MAX_STACK_ALLOC_SIZE;
+        if ((num * sizeof(T) + alignof(T)) > MAX_STACK_ALLOC_SIZE) {
+            m_Mem = (T*)GetScratchArena().Allocate(num * sizeof(T), alignof(T), m_ArenaOffset);
+            m_IsArena = m_Mem != nullptr;
+
+            // Fallback if the arena can't grow
+            if (!m_IsArena) {
+                m_Mem = (T*)allocator.Allocate(allocator.userArg, num * sizeof(T), alignof(T));
+                m_IsHeap = true;
+            }
+        }
     }
 
     ~Scratch() {
-        if (m_IsHeap)
+        if (m_IsArena)
+            GetScratchArena().Rewind(m_ArenaOffset);
+        else if (m_IsHeap)
             m_Allocator.Free(m_Allocator.userArg, m_Mem);
     }
 
@@ -187,12 +275,15 @@ private:
     const AllocationCallbacks& m_Allocator;
     T* m_Mem = nullptr;
     size_t m_Num = 0;
+    size_t m_ArenaOffset = 0;
+    bool m_IsArena = false;
     bool m_IsHeap = false;
 };
 
+// "alloca" must be called in the caller's frame, bigger requests are handled by "Scratch"
 #define AllocateScratch(device, T, elementNum) \
     {(device).GetAllocationCallbacks(), \
         ((elementNum) * sizeof(T) + alignof(T)) > MAX_STACK_ALLOC_SIZE \
-            ? (T*)(device).GetAllocationCallbacks().Allocate((device).GetAllocationCallbacks().userArg, (elementNum) * sizeof(T), alignof(T)) \
+            ? nullptr \
             : (T*)Align((elementNum) ? (T*)alloca(((elementNum) * sizeof(T) + alignof(T))) : nullptr, alignof(T)), \
         (elementNum)}
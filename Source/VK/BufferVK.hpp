@@ -15,7 +15,8 @@ Result BufferVK::Create(const BufferDesc& bufferDesc) {
     m_Desc = bufferDesc;
 
     VkBufferCreateInfo info = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
-    m_Device.FillCreateInfo(bufferDesc, info);
+    VkBufferUsageFlags2CreateInfoKHR usageFlags2 = {};
+    m_Device.FillCreateInfo(bufferDesc, info, usageFlags2);
 
     const auto& vk = m_Device.GetDispatchTable();
     VkResult vkResult = vk.CreateBuffer(m_Device, &info, m_Device.GetVkAllocationCallbacks(), &m_Handle);
@@ -4,9 +4,14 @@
 
 namespace nri {
 
+struct CommandBufferVK;
+
 struct CommandAllocatorVK final : public DebugNameBase {
     inline CommandAllocatorVK(DeviceVK& device)
-        : m_Device(device) {
+        : m_Device(device)
+        , m_FreeCommandBuffers(device.GetStdAllocator())
+        , m_ReleasedCommandBuffers(device.GetStdAllocator())
+        , m_Events(device.GetStdAllocator()) {
     }
 
     inline operator VkCommandPool() const {
@@ -21,6 +26,8 @@ struct CommandAllocatorVK final : public DebugNameBase {
 
     Result Create(const Queue& queue);
     Result Create(const CommandAllocatorVKDesc& commandAllocatorDesc);
+    void ReleaseCommandBuffer(CommandBufferVK& commandBuffer);
+    Result AcquireEvent(VkEvent& event);
 
     //================================================================================================================
     // DebugNameBase
@@ -32,13 +39,17 @@ struct CommandAllocatorVK final : public DebugNameBase {
     // NRI
     //================================================================================================================
 
-    Result CreateCommandBuffer(CommandBuffer*& commandBuffer);
+    Result CreateCommandBuffer(CommandBuffer*& commandBuffer, VkCommandBufferLevel level = VK_COMMAND_BUFFER_LEVEL_PRIMARY);
     void Reset();
 
 private:
     DeviceVK& m_Device;
     VkCommandPool m_Handle = VK_NULL_HANDLE;
     QueueType m_Type = (QueueType)0;
+    Vector<CommandBufferVK*> m_FreeCommandBuffers;     // can be handed out
+    Vector<CommandBufferVK*> m_ReleasedCommandBuffers; // destroyed by the app, become free after "Reset"
+    Vector<VkEvent> m_Events;                          // for split barriers, "m_EventNum" are in use until "Reset"
+    uint32_t m_EventNum = 0;
     bool m_OwnsNativeObjects = true;
     Lock m_Lock;
 };
@@ -1,10 +1,18 @@
 // © 2021 NVIDIA Corporation
 
 CommandAllocatorVK::~CommandAllocatorVK() {
-    if (m_OwnsNativeObjects) {
-        const auto& vk = m_Device.GetDispatchTable();
+    for (CommandBufferVK* commandBuffer : m_FreeCommandBuffers)
+        Destroy(commandBuffer);
+
+    for (CommandBufferVK* commandBuffer : m_ReleasedCommandBuffers)
+        Destroy(commandBuffer);
+
+    const auto& vk = m_Device.GetDispatchTable();
+    for (VkEvent event : m_Events)
+        vk.DestroyEvent(m_Device, event, m_Device.GetVkAllocationCallbacks());
+
+    if (m_OwnsNativeObjects)
         vk.DestroyCommandPool(m_Device, m_Handle, m_Device.GetVkAllocationCallbacks());
-    }
 }
 
 Result CommandAllocatorVK::Create(const Queue& queue) {
@@ -32,14 +40,55 @@ Result CommandAllocatorVK::Create(const CommandAllocatorVKDesc& commandAllocator
     return Result::SUCCESS;
 }
 
+void CommandAllocatorVK::ReleaseCommandBuffer(CommandBufferVK& commandBuffer) {
+    ExclusiveScope lock(m_Lock);
+
+    m_ReleasedCommandBuffers.push_back(&commandBuffer);
+}
+
+Result CommandAllocatorVK::AcquireEvent(VkEvent& event) {
+    ExclusiveScope lock(m_Lock);
+
+    if (m_EventNum == m_Events.size()) {
+        VkEventCreateInfo info = {VK_STRUCTURE_TYPE_EVENT_CREATE_INFO};
+        info.flags = VK_EVENT_CREATE_DEVICE_ONLY_BIT;
+
+        VkEvent newEvent = VK_NULL_HANDLE;
+        const auto& vk = m_Device.GetDispatchTable();
+        VkResult vkResult = vk.CreateEvent(m_Device, &info, m_Device.GetVkAllocationCallbacks(), &newEvent);
+        RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkCreateEvent");
+
+        m_Events.push_back(newEvent);
+    }
+
+    event = m_Events[m_EventNum++];
+
+    return Result::SUCCESS;
+}
+
 NRI_INLINE void CommandAllocatorVK::SetDebugName(const char* name) {
     m_Device.SetDebugNameToTrivialObject(VK_OBJECT_TYPE_COMMAND_POOL, (uint64_t)m_Handle, name);
 }
 
-NRI_INLINE Result CommandAllocatorVK::CreateCommandBuffer(CommandBuffer*& commandBuffer) {
+NRI_INLINE Result CommandAllocatorVK::CreateCommandBuffer(CommandBuffer*& commandBuffer, VkCommandBufferLevel level) {
     ExclusiveScope lock(m_Lock);
 
-    const VkCommandBufferAllocateInfo info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO, nullptr, m_Handle, VK_COMMAND_BUFFER_LEVEL_PRIMARY, 1};
+    // Recycle a command buffer of the same level, if any
+    bool isSecondary = level == VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+    for (size_t i = m_FreeCommandBuffers.size(); i > 0; i--) {
+        CommandBufferVK* commandBufferImpl = m_FreeCommandBuffers[i - 1];
+        if (commandBufferImpl->IsSecondary() == isSecondary) {
+            m_FreeCommandBuffers[i - 1] = m_FreeCommandBuffers.back();
+            m_FreeCommandBuffers.pop_back();
+
+            commandBuffer = (CommandBuffer*)commandBufferImpl;
+
+            return Result::SUCCESS;
+        }
+    }
+
+    // Allocate a new one
+    const VkCommandBufferAllocateInfo info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO, nullptr, m_Handle, level, 1};
 
     VkCommandBuffer commandBufferHandle = VK_NULL_HANDLE;
 
@@ -48,7 +97,7 @@ NRI_INLINE Result CommandAllocatorVK::CreateCommandBuffer(CommandBuffer*& comman
     RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkAllocateCommandBuffers");
 
     CommandBufferVK* commandBufferImpl = Allocate<CommandBufferVK>(m_Device.GetAllocationCallbacks(), m_Device);
-    commandBufferImpl->Create(m_Handle, commandBufferHandle, m_Type);
+    commandBufferImpl->Create(*this, commandBufferHandle, m_Type, isSecondary);
 
     commandBuffer = (CommandBuffer*)commandBufferImpl;
 
@@ -61,4 +110,11 @@ NRI_INLINE void CommandAllocatorVK::Reset() {
     const auto& vk = m_Device.GetDispatchTable();
     VkResult vkResult = vk.ResetCommandPool(m_Device, m_Handle, (VkCommandPoolResetFlags)0);
     RETURN_VOID_ON_BAD_VKRESULT(&m_Device, vkResult, "vkResetCommandPool");
+
+    // All command buffers are in the initial state now, released ones can be reused
+    m_FreeCommandBuffers.insert(m_FreeCommandBuffers.end(), m_ReleasedCommandBuffers.begin(), m_ReleasedCommandBuffers.end());
+    m_ReleasedCommandBuffers.clear();
+
+    // Events are unsignaled after execution (reset right after the wait)
+    m_EventNum = 0;
 }
@@ -4,13 +4,18 @@
 
 namespace nri {
 
+struct CommandAllocatorVK;
 struct PipelineVK;
 struct PipelineLayoutVK;
 struct DescriptorVK;
 
 struct CommandBufferVK final : public DebugNameBase {
     inline CommandBufferVK(DeviceVK& device)
-        : m_Device(device) {
+        : m_Device(device)
+        , m_MemoryBarriers(device.GetStdAllocator())
+        , m_BufferBarriers(device.GetStdAllocator())
+        , m_ImageBarriers(device.GetStdAllocator())
+        , m_Events(device.GetStdAllocator()) {
     }
 
     inline operator VkCommandBuffer() const {
@@ -21,9 +26,21 @@ struct CommandBufferVK final : public DebugNameBase {
         return m_Device;
     }
 
+    inline CommandAllocatorVK* GetCommandAllocator() const {
+        return m_CommandAllocator;
+    }
+
+    inline bool IsSecondary() const {
+        return m_IsSecondary;
+    }
+
+    inline const CommandBufferStats& GetStats() const {
+        return m_Stats;
+    }
+
     ~CommandBufferVK();
 
-    void Create(VkCommandPool commandPool, VkCommandBuffer commandBuffer, QueueType type);
+    void Create(CommandAllocatorVK& commandAllocator, VkCommandBuffer commandBuffer, QueueType type, bool isSecondary);
     Result Create(const CommandBufferVKDesc& commandBufferDesc);
 
     //================================================================================================================
@@ -36,7 +53,8 @@ struct CommandBufferVK final : public DebugNameBase {
     // NRI
     //================================================================================================================
 
-    Result Begin(const DescriptorPool* descriptorPool);
+    Result Begin(const DescriptorPool* descriptorPool, bool isReusable = false);
+    Result BeginSecondary(const AttachmentsDesc* attachmentsDesc, const DescriptorPool* descriptorPool);
     Result End();
     void SetPipeline(const Pipeline& pipeline);
     void SetPipelineLayout(const PipelineLayout& pipelineLayout);
@@ -44,8 +62,8 @@ struct CommandBufferVK final : public DebugNameBase {
     void SetRootConstants(uint32_t rootConstantIndex, const void* data, uint32_t size);
     void SetRootDescriptor(uint32_t rootDescriptorIndex, Descriptor& descriptor);
     void SetDescriptorPool(const DescriptorPool& descriptorPool);
-    void Barrier(const BarrierGroupDesc& barrierGroupDesc);
-    void BeginRendering(const AttachmentsDesc& attachmentsDesc);
+    void Barrier(const BarrierGroupDesc& barrierGroupDesc, VkEvent event = VK_NULL_HANDLE, bool isEventWait = false);
+    void BeginRendering(const AttachmentsDesc& attachmentsDesc, VkRenderingFlags flags = 0);
     void EndRendering();
     void SetViewports(const Viewport* viewports, uint32_t viewportNum);
     void SetScissors(const Rect* rects, uint32_t rectNum);
@@ -61,6 +79,8 @@ struct CommandBufferVK final : public DebugNameBase {
     void SetVertexBuffers(uint32_t baseSlot, const VertexBufferDesc* vertexBufferDescs, uint32_t vertexBufferNum);
     void Draw(const DrawDesc& drawDesc);
     void DrawIndexed(const DrawIndexedDesc& drawIndexedDesc);
+    void DrawMulti(const DrawDesc* drawDescs, uint32_t drawNum);
+    void DrawIndexedMulti(const DrawIndexedDesc* drawIndexedDescs, uint32_t drawNum);
     void DrawIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset);
     void DrawIndexedIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset);
     void Dispatch(const DispatchDesc& dispatchDesc);
@@ -74,7 +94,12 @@ struct CommandBufferVK final : public DebugNameBase {
     void CopyTexture(Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion);
     void UploadBufferToTexture(Texture& dstTexture, const TextureRegionDesc& dstRegion, const Buffer& srcBuffer, const TextureDataLayoutDesc& srcDataLayout);
     void ReadbackTextureToBuffer(Buffer& dstBuffer, const TextureDataLayoutDesc& dstDataLayout, const Texture& srcTexture, const TextureRegionDesc& srcRegion);
+    void CopyBufferMulti(Buffer& dstBuffer, const Buffer& srcBuffer, const BufferCopyRegionDesc* regions, uint32_t regionNum);
+    void CopyTextureMulti(Texture& dstTexture, const Texture& srcTexture, const TextureCopyRegionDesc* regions, uint32_t regionNum);
+    void UploadBufferToTextureMulti(Texture& dstTexture, const Buffer& srcBuffer, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum);
+    void ReadbackTextureToBufferMulti(Buffer& dstBuffer, const Texture& srcTexture, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum);
     void ZeroBuffer(Buffer& buffer, uint64_t offset, uint64_t size);
+    void UpdateBuffer(Buffer& buffer, uint64_t offset, const void* data, uint32_t size);
     void ResolveTexture(Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion);
     void CopyQueries(const QueryPool& queryPool, uint32_t offset, uint32_t num, Buffer& dstBuffer, uint64_t dstOffset);
     void ResetQueries(QueryPool& queryPool, uint32_t offset, uint32_t num);
@@ -89,19 +114,36 @@ struct CommandBufferVK final : public DebugNameBase {
     void DispatchRaysIndirect(const Buffer& buffer, uint64_t offset);
     void DrawMeshTasks(const DrawMeshTasksDesc& drawMeshTasksDesc);
     void DrawMeshTasksIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset);
+    void ExecuteCommands(const CommandBuffer* const* secondaryCommandBuffers, uint32_t secondaryCommandBufferNum);
+    uint32_t BeginBarrier(const BarrierGroupDesc& barrierGroupDesc);
+    void EndBarrier(const BarrierGroupDesc& barrierGroupDesc, uint32_t splitBarrierIndex);
+    void ExecuteGeneratedCommands(const GeneratedCommandsDesc& generatedCommandsDesc);
+    void BeginConditionalRendering(const Buffer& buffer, uint64_t offset, bool inverted);
+    void EndConditionalRendering();
 
 private:
+    void SetRenderArea(const AttachmentsDesc& attachmentsDesc);
+    void DeferBarriers(const VkDependencyInfo& dependencyInfo);
+    void FlushBarriers();
+
     DeviceVK& m_Device;
+    Vector<VkMemoryBarrier2> m_MemoryBarriers; // pending, if "enableVKBarrierBatching"
+    Vector<VkBufferMemoryBarrier2> m_BufferBarriers;
+    Vector<VkImageMemoryBarrier2> m_ImageBarriers;
+    Vector<VkEvent> m_Events; // split barriers
+    CommandBufferStats m_Stats = {};
+    uint64_t m_BeginTime = 0;
     const PipelineVK* m_Pipeline = nullptr;
     const PipelineLayoutVK* m_PipelineLayout = nullptr;
     const DescriptorVK* m_DepthStencil = nullptr;
+    CommandAllocatorVK* m_CommandAllocator = nullptr;
     VkCommandBuffer m_Handle = VK_NULL_HANDLE;
-    VkCommandPool m_CommandPool = VK_NULL_HANDLE;
     QueueType m_Type = (QueueType)0;
     uint32_t m_ViewMask = 0;
     Dim_t m_RenderLayerNum = 0;
     Dim_t m_RenderWidth = 0;
     Dim_t m_RenderHeight = 0;
+    bool m_IsSecondary = false;
 };
 
 } // namespace nri
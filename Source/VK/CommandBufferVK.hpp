@@ -1,23 +1,30 @@
 // © 2021 NVIDIA Corporation
 
+#include <algorithm>
+#include <chrono>
 #include <math.h>
 
+static inline uint64_t GetTimeStamp() {
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
 CommandBufferVK::~CommandBufferVK() {
-    if (m_CommandPool == VK_NULL_HANDLE)
+    if (!m_CommandAllocator)
         return;
 
     const auto& vk = m_Device.GetDispatchTable();
-    vk.FreeCommandBuffers(m_Device, m_CommandPool, 1, &m_Handle);
+    vk.FreeCommandBuffers(m_Device, *m_CommandAllocator, 1, &m_Handle);
 }
 
-void CommandBufferVK::Create(VkCommandPool commandPool, VkCommandBuffer commandBuffer, QueueType type) {
-    m_CommandPool = commandPool;
+void CommandBufferVK::Create(CommandAllocatorVK& commandAllocator, VkCommandBuffer commandBuffer, QueueType type, bool isSecondary) {
+    m_CommandAllocator = &commandAllocator;
     m_Handle = commandBuffer;
     m_Type = type;
+    m_IsSecondary = isSecondary;
 }
 
 Result CommandBufferVK::Create(const CommandBufferVKDesc& commandBufferDesc) {
-    m_CommandPool = VK_NULL_HANDLE;
+    m_CommandAllocator = nullptr;
     m_Handle = (VkCommandBuffer)commandBufferDesc.vkCommandBuffer;
     m_Type = commandBufferDesc.queueType;
 
@@ -28,9 +35,12 @@ NRI_INLINE void CommandBufferVK::SetDebugName(const char* name) {
     m_Device.SetDebugNameToTrivialObject(VK_OBJECT_TYPE_COMMAND_BUFFER, (uint64_t)m_Handle, name);
 }
 
-NRI_INLINE Result CommandBufferVK::Begin(const DescriptorPool*) {
+NRI_INLINE Result CommandBufferVK::Begin(const DescriptorPool* descriptorPool, bool isReusable) {
+    if (m_IsSecondary)
+        return BeginSecondary(nullptr, descriptorPool);
+
     VkCommandBufferBeginInfo info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO};
-    info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    info.flags = isReusable ? 0 : VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
 
     const auto& vk = m_Device.GetDispatchTable();
     VkResult vkResult = vk.BeginCommandBuffer(m_Handle, &info);
@@ -38,15 +48,84 @@ NRI_INLINE Result CommandBufferVK::Begin(const DescriptorPool*) {
 
     m_PipelineLayout = nullptr;
     m_Pipeline = nullptr;
+    m_Events.clear();
+
+    m_Stats = {};
+    if (m_Device.IsCommandBufferStatsEnabled())
+        m_BeginTime = GetTimeStamp();
+
+    return Result::SUCCESS;
+}
+
+NRI_INLINE Result CommandBufferVK::BeginSecondary(const AttachmentsDesc* attachmentsDesc, const DescriptorPool*) {
+    uint32_t colorNum = attachmentsDesc ? attachmentsDesc->colorNum : 0;
+    Scratch<VkFormat> colorFormats = AllocateScratch(m_Device, VkFormat, colorNum);
+
+    VkCommandBufferInheritanceRenderingInfo renderingInfo = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO};
+    renderingInfo.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+
+    VkCommandBufferInheritanceInfo inheritanceInfo = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO};
+
+    VkCommandBufferBeginInfo info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO}; // no "ONE_TIME_SUBMIT", since can be executed by a reusable primary command buffer
+    info.pInheritanceInfo = &inheritanceInfo;
+
+    if (attachmentsDesc) {
+        for (uint32_t i = 0; i < colorNum; i++) {
+            const DescriptorVK& descriptor = *(DescriptorVK*)attachmentsDesc->colors[i];
+            const DescriptorTexDesc& desc = descriptor.GetTexDesc();
+
+            colorFormats[i] = desc.format;
+            renderingInfo.rasterizationSamples = (VkSampleCountFlagBits)desc.texture->GetDesc().sampleNum;
+        }
+
+        if (attachmentsDesc->depthStencil) {
+            const DescriptorVK& descriptor = *(DescriptorVK*)attachmentsDesc->depthStencil;
+            const DescriptorTexDesc& desc = descriptor.GetTexDesc();
+            const FormatProps& formatProps = GetFormatProps(desc.texture->GetDesc().format);
+
+            renderingInfo.depthAttachmentFormat = desc.format;
+            renderingInfo.stencilAttachmentFormat = formatProps.isStencil ? desc.format : VK_FORMAT_UNDEFINED;
+            renderingInfo.rasterizationSamples = (VkSampleCountFlagBits)desc.texture->GetDesc().sampleNum;
+        }
+
+        renderingInfo.viewMask = attachmentsDesc->viewMask;
+        renderingInfo.colorAttachmentCount = colorNum;
+        renderingInfo.pColorAttachmentFormats = colorFormats;
+
+        inheritanceInfo.pNext = &renderingInfo;
+        info.flags |= VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+
+        SetRenderArea(*attachmentsDesc);
+    } else {
+        m_DepthStencil = nullptr;
+        m_ViewMask = 0;
+    }
+
+    const auto& vk = m_Device.GetDispatchTable();
+    VkResult vkResult = vk.BeginCommandBuffer(m_Handle, &info);
+    RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkBeginCommandBuffer");
+
+    m_PipelineLayout = nullptr;
+    m_Pipeline = nullptr;
+    m_Events.clear();
+
+    m_Stats = {};
+    if (m_Device.IsCommandBufferStatsEnabled())
+        m_BeginTime = GetTimeStamp();
 
     return Result::SUCCESS;
 }
 
 NRI_INLINE Result CommandBufferVK::End() {
+    FlushBarriers();
+
     const auto& vk = m_Device.GetDispatchTable();
     VkResult vkResult = vk.EndCommandBuffer(m_Handle);
     RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkEndCommandBuffer");
 
+    if (m_Device.IsCommandBufferStatsEnabled())
+        m_Stats.recordingTime = GetTimeStamp() - m_BeginTime;
+
     return Result::SUCCESS;
 }
 
@@ -204,6 +283,8 @@ NRI_INLINE void CommandBufferVK::ClearAttachments(const ClearDesc* clearDescs, u
 }
 
 NRI_INLINE void CommandBufferVK::ClearStorage(const ClearStorageDesc& clearDesc) {
+    FlushBarriers();
+
     const DescriptorVK& storage = *(DescriptorVK*)clearDesc.storage;
 
     const auto& vk = m_Device.GetDispatchTable();
@@ -219,7 +300,7 @@ NRI_INLINE void CommandBufferVK::ClearStorage(const ClearStorageDesc& clearDesc)
     }
 }
 
-NRI_INLINE void CommandBufferVK::BeginRendering(const AttachmentsDesc& attachmentsDesc) {
+NRI_INLINE void CommandBufferVK::SetRenderArea(const AttachmentsDesc& attachmentsDesc) {
     const DeviceDesc& deviceDesc = m_Device.GetDesc();
 
     // TODO: if there are no attachments, render area has max dimensions. It can be suboptimal even on desktop. It's a no-go on tiled architectures
@@ -227,23 +308,10 @@ NRI_INLINE void CommandBufferVK::BeginRendering(const AttachmentsDesc& attachmen
     m_RenderWidth = deviceDesc.dimensions.attachmentMaxDim;
     m_RenderHeight = deviceDesc.dimensions.attachmentMaxDim;
 
-    // Color
-    Scratch<VkRenderingAttachmentInfo> colors = AllocateScratch(m_Device, VkRenderingAttachmentInfo, attachmentsDesc.colorNum);
     for (uint32_t i = 0; i < attachmentsDesc.colorNum; i++) {
         const DescriptorVK& descriptor = *(DescriptorVK*)attachmentsDesc.colors[i];
         const DescriptorTexDesc& desc = descriptor.GetTexDesc();
 
-        VkRenderingAttachmentInfo& color = colors[i];
-        color = {VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO};
-        color.imageView = descriptor.GetImageView();
-        color.imageLayout = descriptor.GetTexDesc().layout;
-        color.resolveMode = VK_RESOLVE_MODE_NONE; // TODO: add support for "on-the-fly" resolve
-        color.resolveImageView = VK_NULL_HANDLE;
-        color.resolveImageLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-        color.loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
-        color.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
-        color.clearValue = {};
-
         Dim_t w = desc.texture->GetSize(0, desc.mipOffset);
         Dim_t h = desc.texture->GetSize(1, desc.mipOffset);
 
@@ -252,22 +320,10 @@ NRI_INLINE void CommandBufferVK::BeginRendering(const AttachmentsDesc& attachmen
         m_RenderHeight = std::min(m_RenderHeight, h);
     }
 
-    // Depth-stencil
-    VkRenderingAttachmentInfo depthStencil = {VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO};
-    bool hasStencil = false;
     if (attachmentsDesc.depthStencil) {
         const DescriptorVK& descriptor = *(DescriptorVK*)attachmentsDesc.depthStencil;
         const DescriptorTexDesc& desc = descriptor.GetTexDesc();
 
-        depthStencil.imageView = descriptor.GetImageView();
-        depthStencil.imageLayout = desc.layout;
-        depthStencil.resolveMode = VK_RESOLVE_MODE_NONE;
-        depthStencil.resolveImageView = VK_NULL_HANDLE;
-        depthStencil.resolveImageLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-        depthStencil.loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
-        depthStencil.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
-        depthStencil.clearValue = {};
-
         Dim_t w = desc.texture->GetSize(0, desc.mipOffset);
         Dim_t h = desc.texture->GetSize(1, desc.mipOffset);
 
@@ -275,13 +331,83 @@ NRI_INLINE void CommandBufferVK::BeginRendering(const AttachmentsDesc& attachmen
         m_RenderWidth = std::min(m_RenderWidth, w);
         m_RenderHeight = std::min(m_RenderHeight, h);
 
-        const FormatProps& formatProps = GetFormatProps(descriptor.GetTexture().GetDesc().format);
-        hasStencil = formatProps.isStencil != 0;
-
         m_DepthStencil = &descriptor;
     } else
         m_DepthStencil = nullptr;
 
+    bool hasAttachment = attachmentsDesc.depthStencil || attachmentsDesc.colors;
+    if (!hasAttachment)
+        m_RenderLayerNum = 1;
+
+    m_ViewMask = attachmentsDesc.viewMask;
+}
+
+static inline void FillAttachmentOps(VkRenderingAttachmentInfo& attachment, const AttachmentOpsDesc* attachmentOpsDesc, bool isColor, bool isInteger) {
+    attachment.resolveMode = VK_RESOLVE_MODE_NONE;
+    attachment.resolveImageView = VK_NULL_HANDLE;
+    attachment.resolveImageLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    attachment.loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
+    attachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+    attachment.clearValue = {};
+
+    if (!attachmentOpsDesc)
+        return;
+
+    attachment.loadOp = GetLoadOp(attachmentOpsDesc->loadOp);
+    attachment.storeOp = GetStoreOp(attachmentOpsDesc->storeOp);
+
+    if (isColor)
+        memcpy(&attachment.clearValue.color, &attachmentOpsDesc->clearValue.color, sizeof(attachment.clearValue.color));
+    else {
+        attachment.clearValue.depthStencil.depth = attachmentOpsDesc->clearValue.depthStencil.depth;
+        attachment.clearValue.depthStencil.stencil = attachmentOpsDesc->clearValue.depthStencil.stencil;
+    }
+
+    if (attachmentOpsDesc->resolveDst) {
+        const DescriptorVK& resolveDst = *(DescriptorVK*)attachmentOpsDesc->resolveDst;
+
+        // Only "SAMPLE_ZERO" is guaranteed for depth-stencil and integer formats
+        attachment.resolveMode = (isColor && !isInteger) ? GetResolveMode(attachmentOpsDesc->resolveOp) : VK_RESOLVE_MODE_SAMPLE_ZERO_BIT;
+        attachment.resolveImageView = resolveDst.GetImageView();
+        attachment.resolveImageLayout = resolveDst.GetTexDesc().layout;
+    }
+}
+
+NRI_INLINE void CommandBufferVK::BeginRendering(const AttachmentsDesc& attachmentsDesc, VkRenderingFlags flags) {
+    FlushBarriers();
+
+    SetRenderArea(attachmentsDesc);
+
+    // Color
+    Scratch<VkRenderingAttachmentInfo> colors = AllocateScratch(m_Device, VkRenderingAttachmentInfo, attachmentsDesc.colorNum);
+    for (uint32_t i = 0; i < attachmentsDesc.colorNum; i++) {
+        const DescriptorVK& descriptor = *(DescriptorVK*)attachmentsDesc.colors[i];
+        const FormatProps& formatProps = GetFormatProps(descriptor.GetTexture().GetDesc().format);
+
+        VkRenderingAttachmentInfo& color = colors[i];
+        color = {VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO};
+        color.imageView = descriptor.GetImageView();
+        color.imageLayout = descriptor.GetTexDesc().layout;
+
+        FillAttachmentOps(color, attachmentsDesc.colorOps ? &attachmentsDesc.colorOps[i] : nullptr, true, formatProps.isInteger);
+    }
+
+    // Depth-stencil
+    VkRenderingAttachmentInfo depthStencil = {VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO};
+    bool hasStencil = false;
+    if (attachmentsDesc.depthStencil) {
+        const DescriptorVK& descriptor = *(DescriptorVK*)attachmentsDesc.depthStencil;
+        const DescriptorTexDesc& desc = descriptor.GetTexDesc();
+
+        depthStencil.imageView = descriptor.GetImageView();
+        depthStencil.imageLayout = desc.layout;
+
+        FillAttachmentOps(depthStencil, attachmentsDesc.depthStencilOps, false, false);
+
+        const FormatProps& formatProps = GetFormatProps(descriptor.GetTexture().GetDesc().format);
+        hasStencil = formatProps.isStencil != 0;
+    }
+
     // Shading rate
     VkRenderingFragmentShadingRateAttachmentInfoKHR shadingRate = {VK_STRUCTURE_TYPE_RENDERING_FRAGMENT_SHADING_RATE_ATTACHMENT_INFO_KHR};
     if (attachmentsDesc.shadingRate) {
@@ -293,12 +419,8 @@ NRI_INLINE void CommandBufferVK::BeginRendering(const AttachmentsDesc& attachmen
         shadingRate.shadingRateAttachmentTexelSize = {tileSize, tileSize};
     }
 
-    bool hasAttachment = attachmentsDesc.depthStencil || attachmentsDesc.colors;
-    if (!hasAttachment)
-        m_RenderLayerNum = 1;
-
     VkRenderingInfo renderingInfo = {VK_STRUCTURE_TYPE_RENDERING_INFO};
-    renderingInfo.flags = 0;
+    renderingInfo.flags = flags;
     renderingInfo.renderArea = {{0, 0}, {m_RenderWidth, m_RenderHeight}};
     renderingInfo.layerCount = m_RenderLayerNum;
     renderingInfo.viewMask = attachmentsDesc.viewMask;
@@ -312,8 +434,6 @@ NRI_INLINE void CommandBufferVK::BeginRendering(const AttachmentsDesc& attachmen
 
     const auto& vk = m_Device.GetDispatchTable();
     vk.CmdBeginRendering(m_Handle, &renderingInfo);
-
-    m_ViewMask = attachmentsDesc.viewMask;
 }
 
 NRI_INLINE void CommandBufferVK::EndRendering() {
@@ -379,6 +499,7 @@ NRI_INLINE void CommandBufferVK::SetPipelineLayout(const PipelineLayout& pipelin
 NRI_INLINE void CommandBufferVK::SetPipeline(const Pipeline& pipeline) {
     const PipelineVK& pipelineImpl = (const PipelineVK&)pipeline;
     m_Pipeline = &pipelineImpl;
+    m_Stats.pipelineNum++;
 
     const auto& vk = m_Device.GetDispatchTable();
     vk.CmdBindPipeline(m_Handle, pipelineImpl.GetBindPoint(), pipelineImpl);
@@ -406,6 +527,8 @@ NRI_INLINE void CommandBufferVK::SetDescriptorSet(uint32_t setIndex, const Descr
 
     const auto& vk = m_Device.GetDispatchTable();
     vk.CmdBindDescriptorSets(m_Handle, pipelineBindPoint, pipelineLayout, space, 1, &vkDescriptorSet, dynamicConstantBufferNum, dynamicConstantBufferOffsets);
+
+    m_Stats.descriptorSetNum++;
 }
 
 NRI_INLINE void CommandBufferVK::SetRootConstants(uint32_t rootConstantIndex, const void* data, uint32_t size) {
@@ -454,19 +577,98 @@ NRI_INLINE void CommandBufferVK::SetRootDescriptor(uint32_t rootDescriptorIndex,
 
     const auto& vk = m_Device.GetDispatchTable();
     vk.CmdPushDescriptorSetKHR(m_Handle, pipelineBindPoint, pipelineLayout, pushDescriptorBindingDesc.registerSpace, 1, &descriptorWrite);
+
+    m_Stats.descriptorSetNum++;
 }
 
 NRI_INLINE void CommandBufferVK::Draw(const DrawDesc& drawDesc) {
+    FlushBarriers();
+    m_Stats.drawNum++;
+
     const auto& vk = m_Device.GetDispatchTable();
     vk.CmdDraw(m_Handle, drawDesc.vertexNum, drawDesc.instanceNum, drawDesc.baseVertex, drawDesc.baseInstance);
 }
 
 NRI_INLINE void CommandBufferVK::DrawIndexed(const DrawIndexedDesc& drawIndexedDesc) {
+    FlushBarriers();
+    m_Stats.drawNum++;
+
     const auto& vk = m_Device.GetDispatchTable();
     vk.CmdDrawIndexed(m_Handle, drawIndexedDesc.indexNum, drawIndexedDesc.instanceNum, drawIndexedDesc.baseIndex, drawIndexedDesc.baseVertex, drawIndexedDesc.baseInstance);
 }
 
+NRI_INLINE void CommandBufferVK::DrawMulti(const DrawDesc* drawDescs, uint32_t drawNum) {
+    FlushBarriers();
+    m_Stats.drawNum += drawNum;
+
+    const auto& vk = m_Device.GetDispatchTable();
+    if (!m_Device.m_IsSupported.multiDraw) {
+        for (uint32_t i = 0; i < drawNum; i++) {
+            const DrawDesc& drawDesc = drawDescs[i];
+            vk.CmdDraw(m_Handle, drawDesc.vertexNum, drawDesc.instanceNum, drawDesc.baseVertex, drawDesc.baseInstance);
+        }
+
+        return;
+    }
+
+    // Consecutive draws with the same instancing are merged
+    Scratch<VkMultiDrawInfoEXT> multiDrawInfos = AllocateScratch(m_Device, VkMultiDrawInfoEXT, drawNum);
+
+    uint32_t i = 0;
+    while (i < drawNum) {
+        const DrawDesc& firstDrawDesc = drawDescs[i];
+
+        uint32_t num = 0;
+        for (; i < drawNum && num < m_Device.GetMultiDrawMaxNum(); i++, num++) {
+            const DrawDesc& drawDesc = drawDescs[i];
+            if (drawDesc.instanceNum != firstDrawDesc.instanceNum || drawDesc.baseInstance != firstDrawDesc.baseInstance)
+                break;
+
+            multiDrawInfos[num] = {drawDesc.baseVertex, drawDesc.vertexNum};
+        }
+
+        vk.CmdDrawMultiEXT(m_Handle, num, multiDrawInfos, firstDrawDesc.instanceNum, firstDrawDesc.baseInstance, sizeof(VkMultiDrawInfoEXT));
+    }
+}
+
+NRI_INLINE void CommandBufferVK::DrawIndexedMulti(const DrawIndexedDesc* drawIndexedDescs, uint32_t drawNum) {
+    FlushBarriers();
+    m_Stats.drawNum += drawNum;
+
+    const auto& vk = m_Device.GetDispatchTable();
+    if (!m_Device.m_IsSupported.multiDraw) {
+        for (uint32_t i = 0; i < drawNum; i++) {
+            const DrawIndexedDesc& drawIndexedDesc = drawIndexedDescs[i];
+            vk.CmdDrawIndexed(m_Handle, drawIndexedDesc.indexNum, drawIndexedDesc.instanceNum, drawIndexedDesc.baseIndex, drawIndexedDesc.baseVertex, drawIndexedDesc.baseInstance);
+        }
+
+        return;
+    }
+
+    // Consecutive draws with the same instancing are merged
+    Scratch<VkMultiDrawIndexedInfoEXT> multiDrawIndexedInfos = AllocateScratch(m_Device, VkMultiDrawIndexedInfoEXT, drawNum);
+
+    uint32_t i = 0;
+    while (i < drawNum) {
+        const DrawIndexedDesc& firstDrawIndexedDesc = drawIndexedDescs[i];
+
+        uint32_t num = 0;
+        for (; i < drawNum && num < m_Device.GetMultiDrawMaxNum(); i++, num++) {
+            const DrawIndexedDesc& drawIndexedDesc = drawIndexedDescs[i];
+            if (drawIndexedDesc.instanceNum != firstDrawIndexedDesc.instanceNum || drawIndexedDesc.baseInstance != firstDrawIndexedDesc.baseInstance)
+                break;
+
+            multiDrawIndexedInfos[num] = {drawIndexedDesc.baseIndex, drawIndexedDesc.indexNum, drawIndexedDesc.baseVertex};
+        }
+
+        vk.CmdDrawMultiIndexedEXT(m_Handle, num, multiDrawIndexedInfos, firstDrawIndexedDesc.instanceNum, firstDrawIndexedDesc.baseInstance, sizeof(VkMultiDrawIndexedInfoEXT), nullptr);
+    }
+}
+
 NRI_INLINE void CommandBufferVK::DrawIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
+    FlushBarriers();
+    m_Stats.drawNum++;
+
     const BufferVK& bufferVK = (const BufferVK&)buffer;
     const auto& vk = m_Device.GetDispatchTable();
 
@@ -478,6 +680,9 @@ NRI_INLINE void CommandBufferVK::DrawIndirect(const Buffer& buffer, uint64_t off
 }
 
 NRI_INLINE void CommandBufferVK::DrawIndexedIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
+    FlushBarriers();
+    m_Stats.drawNum++;
+
     const BufferVK& bufferVK = (const BufferVK&)buffer;
     const auto& vk = m_Device.GetDispatchTable();
 
@@ -488,7 +693,92 @@ NRI_INLINE void CommandBufferVK::DrawIndexedIndirect(const Buffer& buffer, uint6
         vk.CmdDrawIndexedIndirect(m_Handle, bufferVK.GetHandle(), offset, drawNum, stride);
 }
 
+static inline uint64_t GetTextureCopySize(const TextureVK& texture, const VkExtent3D& extent, uint32_t layerNum) {
+    const FormatProps& formatProps = GetFormatProps(texture.GetDesc().format);
+
+    uint64_t w = (extent.width + formatProps.blockWidth - 1) / formatProps.blockWidth;
+    uint64_t h = (extent.height + formatProps.blockHeight - 1) / formatProps.blockHeight;
+
+    return w * h * extent.depth * layerNum * formatProps.stride;
+}
+
+static void FillImageCopy(VkImageCopy2& region, const TextureVK& dst, const TextureRegionDesc& dstRegion, const TextureVK& src, const TextureRegionDesc& srcRegion) {
+    VkImageAspectFlags srcAspectFlags = GetImageAspectFlags(srcRegion.planes);
+    if (srcRegion.planes == PlaneBits::ALL)
+        srcAspectFlags = src.GetImageAspectFlags();
+
+    VkImageAspectFlags dstAspectFlags = GetImageAspectFlags(dstRegion.planes);
+    if (dstRegion.planes == PlaneBits::ALL)
+        dstAspectFlags = dst.GetImageAspectFlags();
+
+    region = {VK_STRUCTURE_TYPE_IMAGE_COPY_2};
+    region.srcSubresource = {
+        srcAspectFlags,
+        srcRegion.mipOffset,
+        srcRegion.layerOffset,
+        1,
+    };
+    region.srcOffset = {
+        (int32_t)srcRegion.x,
+        (int32_t)srcRegion.y,
+        (int32_t)srcRegion.z,
+    };
+    region.dstSubresource = {
+        dstAspectFlags,
+        dstRegion.mipOffset,
+        dstRegion.layerOffset,
+        1,
+    };
+    region.dstOffset = {
+        (int32_t)dstRegion.x,
+        (int32_t)dstRegion.y,
+        (int32_t)dstRegion.z,
+    };
+    region.extent = {
+        (srcRegion.width == WHOLE_SIZE) ? src.GetSize(0, srcRegion.mipOffset) : srcRegion.width,
+        (srcRegion.height == WHOLE_SIZE) ? src.GetSize(1, srcRegion.mipOffset) : srcRegion.height,
+        (srcRegion.depth == WHOLE_SIZE) ? src.GetSize(2, srcRegion.mipOffset) : srcRegion.depth,
+    };
+}
+
+static void FillBufferImageCopy(VkBufferImageCopy2& region, const TextureVK& texture, const TextureRegionDesc& textureRegion, const TextureDataLayoutDesc& dataLayout) {
+    const FormatProps& formatProps = GetFormatProps(texture.GetDesc().format);
+
+    uint32_t rowBlockNum = dataLayout.rowPitch / formatProps.stride;
+    uint32_t bufferRowLength = rowBlockNum * formatProps.blockWidth;
+
+    uint32_t sliceRowNum = dataLayout.slicePitch / dataLayout.rowPitch;
+    uint32_t bufferImageHeight = sliceRowNum * formatProps.blockWidth;
+
+    VkImageAspectFlags aspectFlags = GetImageAspectFlags(textureRegion.planes);
+    if (textureRegion.planes == PlaneBits::ALL)
+        aspectFlags = texture.GetImageAspectFlags();
+
+    region = {VK_STRUCTURE_TYPE_BUFFER_IMAGE_COPY_2};
+    region.bufferOffset = dataLayout.offset;
+    region.bufferRowLength = bufferRowLength;
+    region.bufferImageHeight = bufferImageHeight;
+    region.imageSubresource = VkImageSubresourceLayers{
+        aspectFlags,
+        textureRegion.mipOffset,
+        textureRegion.layerOffset,
+        1,
+    };
+    region.imageOffset = VkOffset3D{
+        textureRegion.x,
+        textureRegion.y,
+        textureRegion.z,
+    };
+    region.imageExtent = VkExtent3D{
+        (textureRegion.width == WHOLE_SIZE) ? texture.GetSize(0, textureRegion.mipOffset) : textureRegion.width,
+        (textureRegion.height == WHOLE_SIZE) ? texture.GetSize(1, textureRegion.mipOffset) : textureRegion.height,
+        (textureRegion.depth == WHOLE_SIZE) ? texture.GetSize(2, textureRegion.mipOffset) : textureRegion.depth,
+    };
+}
+
 NRI_INLINE void CommandBufferVK::CopyBuffer(Buffer& dstBuffer, uint64_t dstOffset, const Buffer& srcBuffer, uint64_t srcOffset, uint64_t size) {
+    FlushBarriers();
+
     const BufferVK& src = (const BufferVK&)srcBuffer;
     const BufferVK& dstBufferImpl = (const BufferVK&)dstBuffer;
 
@@ -505,9 +795,13 @@ NRI_INLINE void CommandBufferVK::CopyBuffer(Buffer& dstBuffer, uint64_t dstOffse
 
     const auto& vk = m_Device.GetDispatchTable();
     vk.CmdCopyBuffer2(m_Handle, &info);
+
+    m_Stats.copyBytes += region.size;
 }
 
 NRI_INLINE void CommandBufferVK::CopyTexture(Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion) {
+    FlushBarriers();
+
     const TextureVK& src = (const TextureVK&)srcTexture;
     const TextureVK& dst = (const TextureVK&)dstTexture;
     const TextureDesc& dstDesc = dst.GetDesc();
@@ -533,42 +827,7 @@ NRI_INLINE void CommandBufferVK::CopyTexture(Texture& dstTexture, const TextureR
         if (!dstRegion)
             dstRegion = &wholeResource;
 
-        VkImageAspectFlags srcAspectFlags = GetImageAspectFlags(srcRegion->planes);
-        if (srcRegion->planes == PlaneBits::ALL)
-            srcAspectFlags = src.GetImageAspectFlags();
-
-        VkImageAspectFlags dstAspectFlags = GetImageAspectFlags(dstRegion->planes);
-        if (dstRegion->planes == PlaneBits::ALL)
-            dstAspectFlags = dst.GetImageAspectFlags();
-
-        regions[0] = {VK_STRUCTURE_TYPE_IMAGE_COPY_2};
-        regions[0].srcSubresource = {
-            srcAspectFlags,
-            srcRegion->mipOffset,
-            srcRegion->layerOffset,
-            1,
-        };
-        regions[0].srcOffset = {
-            (int32_t)srcRegion->x,
-            (int32_t)srcRegion->y,
-            (int32_t)srcRegion->z,
-        };
-        regions[0].dstSubresource = {
-            dstAspectFlags,
-            dstRegion->mipOffset,
-            dstRegion->layerOffset,
-            1,
-        };
-        regions[0].dstOffset = {
-            (int32_t)dstRegion->x,
-            (int32_t)dstRegion->y,
-            (int32_t)dstRegion->z,
-        };
-        regions[0].extent = {
-            (srcRegion->width == WHOLE_SIZE) ? src.GetSize(0, srcRegion->mipOffset) : srcRegion->width,
-            (srcRegion->height == WHOLE_SIZE) ? src.GetSize(1, srcRegion->mipOffset) : srcRegion->height,
-            (srcRegion->depth == WHOLE_SIZE) ? src.GetSize(2, srcRegion->mipOffset) : srcRegion->depth,
-        };
+        FillImageCopy(regions[0], dst, *dstRegion, src, *srcRegion);
     }
 
     VkCopyImageInfo2 info = {VK_STRUCTURE_TYPE_COPY_IMAGE_INFO_2};
@@ -581,9 +840,14 @@ NRI_INLINE void CommandBufferVK::CopyTexture(Texture& dstTexture, const TextureR
 
     const auto& vk = m_Device.GetDispatchTable();
     vk.CmdCopyImage2(m_Handle, &info);
+
+    for (uint32_t i = 0; i < regionNum; i++)
+        m_Stats.copyBytes += GetTextureCopySize(dst, regions[i].extent, regions[i].dstSubresource.layerCount);
 }
 
 NRI_INLINE void CommandBufferVK::ResolveTexture(Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion) {
+    FlushBarriers();
+
     const TextureVK& src = (const TextureVK&)srcTexture;
     const TextureVK& dst = (const TextureVK&)dstTexture;
     const TextureDesc& dstDesc = dst.GetDesc();
@@ -660,40 +924,13 @@ NRI_INLINE void CommandBufferVK::ResolveTexture(Texture& dstTexture, const Textu
 }
 
 NRI_INLINE void CommandBufferVK::UploadBufferToTexture(Texture& dstTexture, const TextureRegionDesc& dstRegion, const Buffer& srcBuffer, const TextureDataLayoutDesc& srcDataLayout) {
+    FlushBarriers();
+
     const BufferVK& src = (const BufferVK&)srcBuffer;
     const TextureVK& dst = (const TextureVK&)dstTexture;
-    const FormatProps& formatProps = GetFormatProps(dst.GetDesc().format);
-
-    uint32_t rowBlockNum = srcDataLayout.rowPitch / formatProps.stride;
-    uint32_t bufferRowLength = rowBlockNum * formatProps.blockWidth;
-
-    uint32_t sliceRowNum = srcDataLayout.slicePitch / srcDataLayout.rowPitch;
-    uint32_t bufferImageHeight = sliceRowNum * formatProps.blockWidth;
-
-    VkImageAspectFlags dstAspectFlags = GetImageAspectFlags(dstRegion.planes);
-    if (dstRegion.planes == PlaneBits::ALL)
-        dstAspectFlags = dst.GetImageAspectFlags();
 
-    VkBufferImageCopy2 region = {VK_STRUCTURE_TYPE_BUFFER_IMAGE_COPY_2};
-    region.bufferOffset = srcDataLayout.offset;
-    region.bufferRowLength = bufferRowLength;
-    region.bufferImageHeight = bufferImageHeight;
-    region.imageSubresource = VkImageSubresourceLayers{
-        dstAspectFlags,
-        dstRegion.mipOffset,
-        dstRegion.layerOffset,
-        1,
-    };
-    region.imageOffset = VkOffset3D{
-        dstRegion.x,
-        dstRegion.y,
-        dstRegion.z,
-    };
-    region.imageExtent = VkExtent3D{
-        (dstRegion.width == WHOLE_SIZE) ? dst.GetSize(0, dstRegion.mipOffset) : dstRegion.width,
-        (dstRegion.height == WHOLE_SIZE) ? dst.GetSize(1, dstRegion.mipOffset) : dstRegion.height,
-        (dstRegion.depth == WHOLE_SIZE) ? dst.GetSize(2, dstRegion.mipOffset) : dstRegion.depth,
-    };
+    VkBufferImageCopy2 region = {};
+    FillBufferImageCopy(region, dst, dstRegion, srcDataLayout);
 
     VkCopyBufferToImageInfo2 info = {VK_STRUCTURE_TYPE_COPY_BUFFER_TO_IMAGE_INFO_2};
     info.srcBuffer = src.GetHandle();
@@ -704,56 +941,146 @@ NRI_INLINE void CommandBufferVK::UploadBufferToTexture(Texture& dstTexture, cons
 
     const auto& vk = m_Device.GetDispatchTable();
     vk.CmdCopyBufferToImage2(m_Handle, &info);
+
+    m_Stats.copyBytes += GetTextureCopySize(dst, region.imageExtent, region.imageSubresource.layerCount);
 }
 
 NRI_INLINE void CommandBufferVK::ReadbackTextureToBuffer(Buffer& dstBuffer, const TextureDataLayoutDesc& dstDataLayout, const Texture& srcTexture, const TextureRegionDesc& srcRegion) {
+    FlushBarriers();
+
     const TextureVK& src = (const TextureVK&)srcTexture;
     const BufferVK& dst = (const BufferVK&)dstBuffer;
-    const FormatProps& formatProps = GetFormatProps(src.GetDesc().format);
 
-    uint32_t rowBlockNum = dstDataLayout.rowPitch / formatProps.stride;
-    uint32_t bufferRowLength = rowBlockNum * formatProps.blockWidth;
+    VkBufferImageCopy2 region = {};
+    FillBufferImageCopy(region, src, srcRegion, dstDataLayout);
 
-    uint32_t sliceRowNum = dstDataLayout.slicePitch / dstDataLayout.rowPitch;
-    uint32_t bufferImageHeight = sliceRowNum * formatProps.blockWidth;
+    VkCopyImageToBufferInfo2 info = {VK_STRUCTURE_TYPE_COPY_IMAGE_TO_BUFFER_INFO_2};
+    info.srcImage = src.GetHandle();
+    info.srcImageLayout = IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+    info.dstBuffer = dst.GetHandle();
+    info.regionCount = 1;
+    info.pRegions = &region;
 
-    VkImageAspectFlags srcAspectFlags = GetImageAspectFlags(srcRegion.planes);
-    if (srcRegion.planes == PlaneBits::ALL)
-        srcAspectFlags = src.GetImageAspectFlags();
+    const auto& vk = m_Device.GetDispatchTable();
+    vk.CmdCopyImageToBuffer2(m_Handle, &info);
 
-    VkBufferImageCopy2 region = {VK_STRUCTURE_TYPE_BUFFER_IMAGE_COPY_2};
-    region.bufferOffset = dstDataLayout.offset;
-    region.bufferRowLength = bufferRowLength;
-    region.bufferImageHeight = bufferImageHeight;
-    region.imageSubresource = VkImageSubresourceLayers{
-        srcAspectFlags,
-        srcRegion.mipOffset,
-        srcRegion.layerOffset,
-        1,
-    };
-    region.imageOffset = VkOffset3D{
-        srcRegion.x,
-        srcRegion.y,
-        srcRegion.z,
-    };
-    region.imageExtent = VkExtent3D{
-        (srcRegion.width == WHOLE_SIZE) ? src.GetSize(0, srcRegion.mipOffset) : srcRegion.width,
-        (srcRegion.height == WHOLE_SIZE) ? src.GetSize(1, srcRegion.mipOffset) : srcRegion.height,
-        (srcRegion.depth == WHOLE_SIZE) ? src.GetSize(2, srcRegion.mipOffset) : srcRegion.depth,
-    };
+    m_Stats.copyBytes += GetTextureCopySize(src, region.imageExtent, region.imageSubresource.layerCount);
+}
+
+NRI_INLINE void CommandBufferVK::CopyBufferMulti(Buffer& dstBuffer, const Buffer& srcBuffer, const BufferCopyRegionDesc* regions, uint32_t regionNum) {
+    if (!regionNum)
+        return;
+
+    FlushBarriers();
+
+    const BufferVK& src = (const BufferVK&)srcBuffer;
+    const BufferVK& dst = (const BufferVK&)dstBuffer;
+
+    Scratch<VkBufferCopy2> regionsVK = AllocateScratch(m_Device, VkBufferCopy2, regionNum);
+    for (uint32_t i = 0; i < regionNum; i++) {
+        regionsVK[i] = {VK_STRUCTURE_TYPE_BUFFER_COPY_2};
+        regionsVK[i].srcOffset = regions[i].srcOffset;
+        regionsVK[i].dstOffset = regions[i].dstOffset;
+        regionsVK[i].size = regions[i].size == WHOLE_SIZE ? src.GetDesc().size : regions[i].size;
+
+        m_Stats.copyBytes += regionsVK[i].size;
+    }
+
+    VkCopyBufferInfo2 info = {VK_STRUCTURE_TYPE_COPY_BUFFER_INFO_2};
+    info.srcBuffer = src.GetHandle();
+    info.dstBuffer = dst.GetHandle();
+    info.regionCount = regionNum;
+    info.pRegions = regionsVK;
+
+    const auto& vk = m_Device.GetDispatchTable();
+    vk.CmdCopyBuffer2(m_Handle, &info);
+}
+
+NRI_INLINE void CommandBufferVK::CopyTextureMulti(Texture& dstTexture, const Texture& srcTexture, const TextureCopyRegionDesc* regions, uint32_t regionNum) {
+    if (!regionNum)
+        return;
+
+    FlushBarriers();
+
+    const TextureVK& src = (const TextureVK&)srcTexture;
+    const TextureVK& dst = (const TextureVK&)dstTexture;
+
+    Scratch<VkImageCopy2> regionsVK = AllocateScratch(m_Device, VkImageCopy2, regionNum);
+    for (uint32_t i = 0; i < regionNum; i++) {
+        FillImageCopy(regionsVK[i], dst, regions[i].dstRegion, src, regions[i].srcRegion);
+
+        m_Stats.copyBytes += GetTextureCopySize(dst, regionsVK[i].extent, 1);
+    }
+
+    VkCopyImageInfo2 info = {VK_STRUCTURE_TYPE_COPY_IMAGE_INFO_2};
+    info.srcImage = src.GetHandle();
+    info.srcImageLayout = IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+    info.dstImage = dst.GetHandle();
+    info.dstImageLayout = IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    info.regionCount = regionNum;
+    info.pRegions = regionsVK;
+
+    const auto& vk = m_Device.GetDispatchTable();
+    vk.CmdCopyImage2(m_Handle, &info);
+}
+
+NRI_INLINE void CommandBufferVK::UploadBufferToTextureMulti(Texture& dstTexture, const Buffer& srcBuffer, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum) {
+    if (!regionNum)
+        return;
+
+    FlushBarriers();
+
+    const BufferVK& src = (const BufferVK&)srcBuffer;
+    const TextureVK& dst = (const TextureVK&)dstTexture;
+
+    Scratch<VkBufferImageCopy2> regionsVK = AllocateScratch(m_Device, VkBufferImageCopy2, regionNum);
+    for (uint32_t i = 0; i < regionNum; i++) {
+        FillBufferImageCopy(regionsVK[i], dst, regions[i].textureRegion, regions[i].dataLayout);
+
+        m_Stats.copyBytes += GetTextureCopySize(dst, regionsVK[i].imageExtent, 1);
+    }
+
+    VkCopyBufferToImageInfo2 info = {VK_STRUCTURE_TYPE_COPY_BUFFER_TO_IMAGE_INFO_2};
+    info.srcBuffer = src.GetHandle();
+    info.dstImage = dst.GetHandle();
+    info.dstImageLayout = IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    info.regionCount = regionNum;
+    info.pRegions = regionsVK;
+
+    const auto& vk = m_Device.GetDispatchTable();
+    vk.CmdCopyBufferToImage2(m_Handle, &info);
+}
+
+NRI_INLINE void CommandBufferVK::ReadbackTextureToBufferMulti(Buffer& dstBuffer, const Texture& srcTexture, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum) {
+    if (!regionNum)
+        return;
+
+    FlushBarriers();
+
+    const TextureVK& src = (const TextureVK&)srcTexture;
+    const BufferVK& dst = (const BufferVK&)dstBuffer;
+
+    Scratch<VkBufferImageCopy2> regionsVK = AllocateScratch(m_Device, VkBufferImageCopy2, regionNum);
+    for (uint32_t i = 0; i < regionNum; i++) {
+        FillBufferImageCopy(regionsVK[i], src, regions[i].textureRegion, regions[i].dataLayout);
+
+        m_Stats.copyBytes += GetTextureCopySize(src, regionsVK[i].imageExtent, 1);
+    }
 
     VkCopyImageToBufferInfo2 info = {VK_STRUCTURE_TYPE_COPY_IMAGE_TO_BUFFER_INFO_2};
     info.srcImage = src.GetHandle();
     info.srcImageLayout = IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
     info.dstBuffer = dst.GetHandle();
-    info.regionCount = 1;
-    info.pRegions = &region;
+    info.regionCount = regionNum;
+    info.pRegions = regionsVK;
 
     const auto& vk = m_Device.GetDispatchTable();
     vk.CmdCopyImageToBuffer2(m_Handle, &info);
 }
 
 NRI_INLINE void CommandBufferVK::ZeroBuffer(Buffer& buffer, uint64_t offset, uint64_t size) {
+    FlushBarriers();
+
     BufferVK& dst = (BufferVK&)buffer;
 
     if (size == WHOLE_SIZE)
@@ -761,14 +1088,33 @@ NRI_INLINE void CommandBufferVK::ZeroBuffer(Buffer& buffer, uint64_t offset, uin
 
     const auto& vk = m_Device.GetDispatchTable();
     vk.CmdFillBuffer(m_Handle, dst.GetHandle(), offset, size, 0);
+
+    m_Stats.copyBytes += size;
+}
+
+NRI_INLINE void CommandBufferVK::UpdateBuffer(Buffer& buffer, uint64_t offset, const void* data, uint32_t size) {
+    FlushBarriers();
+
+    BufferVK& dst = (BufferVK&)buffer;
+
+    const auto& vk = m_Device.GetDispatchTable();
+    vk.CmdUpdateBuffer(m_Handle, dst.GetHandle(), offset, size, data);
+
+    m_Stats.copyBytes += size;
 }
 
 NRI_INLINE void CommandBufferVK::Dispatch(const DispatchDesc& dispatchDesc) {
+    FlushBarriers();
+    m_Stats.dispatchNum++;
+
     const auto& vk = m_Device.GetDispatchTable();
     vk.CmdDispatch(m_Handle, dispatchDesc.x, dispatchDesc.y, dispatchDesc.z);
 }
 
 NRI_INLINE void CommandBufferVK::DispatchIndirect(const Buffer& buffer, uint64_t offset) {
+    FlushBarriers();
+    m_Stats.dispatchNum++;
+
     static_assert(sizeof(DispatchDesc) == sizeof(VkDispatchIndirectCommand));
 
     const BufferVK& bufferVK = (const BufferVK&)buffer;
@@ -836,7 +1182,19 @@ static inline VkAccessFlags2 GetAccessFlags(AccessBits accessBits) {
     return flags;
 }
 
-NRI_INLINE void CommandBufferVK::Barrier(const BarrierGroupDesc& barrierGroupDesc) {
+// Conditional rendering predicates are "ARGUMENT_BUFFER"s, consumed in the "INDIRECT" stage
+static inline void AddConditionalRenderingFlags(VkPipelineStageFlags2& stageMask, VkAccessFlags2& accessMask) {
+    if (stageMask & VK_PIPELINE_STAGE_2_DRAW_INDIRECT_BIT)
+        stageMask |= VK_PIPELINE_STAGE_2_CONDITIONAL_RENDERING_BIT_EXT;
+
+    if (accessMask & VK_ACCESS_2_INDIRECT_COMMAND_READ_BIT)
+        accessMask |= VK_ACCESS_2_CONDITIONAL_RENDERING_READ_BIT_EXT;
+}
+
+NRI_INLINE void CommandBufferVK::Barrier(const BarrierGroupDesc& barrierGroupDesc, VkEvent event, bool isEventWait) {
+    if (!isEventWait) // a split barrier is counted once
+        m_Stats.barrierNum += barrierGroupDesc.globalNum + barrierGroupDesc.bufferNum + barrierGroupDesc.textureNum;
+
     // Global
     Scratch<VkMemoryBarrier2> memoryBarriers = AllocateScratch(m_Device, VkMemoryBarrier2, barrierGroupDesc.globalNum);
     for (uint32_t i = 0; i < barrierGroupDesc.globalNum; i++) {
@@ -848,6 +1206,11 @@ NRI_INLINE void CommandBufferVK::Barrier(const BarrierGroupDesc& barrierGroupDes
         out.srcAccessMask = GetAccessFlags(in.before.access);
         out.dstStageMask = GetPipelineStageFlags(in.after.stages);
         out.dstAccessMask = GetAccessFlags(in.after.access);
+
+        if (m_Device.m_IsSupported.conditionalRendering) {
+            AddConditionalRenderingFlags(out.srcStageMask, out.srcAccessMask);
+            AddConditionalRenderingFlags(out.dstStageMask, out.dstAccessMask);
+        }
     }
 
     // Buffer
@@ -862,6 +1225,12 @@ NRI_INLINE void CommandBufferVK::Barrier(const BarrierGroupDesc& barrierGroupDes
         out.srcAccessMask = GetAccessFlags(in.before.access);
         out.dstStageMask = GetPipelineStageFlags(in.after.stages);
         out.dstAccessMask = GetAccessFlags(in.after.access);
+
+        if (m_Device.m_IsSupported.conditionalRendering) {
+            AddConditionalRenderingFlags(out.srcStageMask, out.srcAccessMask);
+            AddConditionalRenderingFlags(out.dstStageMask, out.dstAccessMask);
+        }
+
         out.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED; // "VK_SHARING_MODE_CONCURRENT" is intentionally used for buffers to match D3D12 spec
         out.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
         out.buffer = bufferVK.GetHandle();
@@ -911,16 +1280,29 @@ NRI_INLINE void CommandBufferVK::Barrier(const BarrierGroupDesc& barrierGroupDes
     dependencyInfo.pImageMemoryBarriers = textureBarriers;
 
     const auto& vk = m_Device.GetDispatchTable();
-    vk.CmdPipelineBarrier2(m_Handle, &dependencyInfo);
+    if (event != VK_NULL_HANDLE) {
+        if (isEventWait) {
+            vk.CmdWaitEvents2(m_Handle, 1, &event, &dependencyInfo);
+            vk.CmdResetEvent2(m_Handle, event, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT); // ready for reuse after "Reset"
+        } else
+            vk.CmdSetEvent2(m_Handle, event, &dependencyInfo);
+    } else if (m_Device.IsBarrierBatchingEnabled())
+        DeferBarriers(dependencyInfo);
+    else
+        vk.CmdPipelineBarrier2(m_Handle, &dependencyInfo);
 }
 
 NRI_INLINE void CommandBufferVK::BeginQuery(QueryPool& queryPool, uint32_t offset) {
+    FlushBarriers();
+
     QueryPoolVK& queryPoolImpl = (QueryPoolVK&)queryPool;
     const auto& vk = m_Device.GetDispatchTable();
     vk.CmdBeginQuery(m_Handle, queryPoolImpl.GetHandle(), offset, (VkQueryControlFlagBits)0);
 }
 
 NRI_INLINE void CommandBufferVK::EndQuery(QueryPool& queryPool, uint32_t offset) {
+    FlushBarriers();
+
     QueryPoolVK& queryPoolImpl = (QueryPoolVK&)queryPool;
     const auto& vk = m_Device.GetDispatchTable();
 
@@ -933,6 +1315,8 @@ NRI_INLINE void CommandBufferVK::EndQuery(QueryPool& queryPool, uint32_t offset)
 }
 
 NRI_INLINE void CommandBufferVK::CopyQueries(const QueryPool& queryPool, uint32_t offset, uint32_t num, Buffer& dstBuffer, uint64_t dstOffset) {
+    FlushBarriers();
+
     const QueryPoolVK& queryPoolImpl = (const QueryPoolVK&)queryPool;
     const BufferVK& bufferVK = (const BufferVK&)dstBuffer;
 
@@ -944,6 +1328,8 @@ NRI_INLINE void CommandBufferVK::CopyQueries(const QueryPool& queryPool, uint32_
 }
 
 NRI_INLINE void CommandBufferVK::ResetQueries(QueryPool& queryPool, uint32_t offset, uint32_t num) {
+    FlushBarriers();
+
     QueryPoolVK& queryPoolImpl = (QueryPoolVK&)queryPool;
 
     const auto& vk = m_Device.GetDispatchTable();
@@ -983,6 +1369,8 @@ NRI_INLINE void CommandBufferVK::Annotation(const char* name, uint32_t bgra) {
 }
 
 NRI_INLINE void CommandBufferVK::BuildTopLevelAccelerationStructures(const BuildTopLevelAccelerationStructureDesc* buildTopLevelAccelerationStructureDescs, uint32_t buildTopLevelAccelerationStructureDescNum) {
+    FlushBarriers();
+
     static_assert(sizeof(VkAccelerationStructureInstanceKHR) == sizeof(TopLevelInstance), "Mismatched sizeof");
 
     Scratch<VkAccelerationStructureBuildGeometryInfoKHR> infos = AllocateScratch(m_Device, VkAccelerationStructureBuildGeometryInfoKHR, buildTopLevelAccelerationStructureDescNum);
@@ -1034,6 +1422,8 @@ NRI_INLINE void CommandBufferVK::BuildTopLevelAccelerationStructures(const Build
 }
 
 NRI_INLINE void CommandBufferVK::BuildBottomLevelAccelerationStructures(const BuildBottomLevelAccelerationStructureDesc* buildBottomLevelAccelerationStructureDescs, uint32_t buildBottomLevelAccelerationStructureDescNum) {
+    FlushBarriers();
+
     // Count
     uint32_t geometryTotalNum = 0;
     uint32_t micromapTotalNum = 0;
@@ -1103,6 +1493,8 @@ NRI_INLINE void CommandBufferVK::BuildBottomLevelAccelerationStructures(const Bu
 }
 
 NRI_INLINE void CommandBufferVK::BuildMicromaps(const BuildMicromapDesc* buildMicromapDescs, uint32_t buildMicromapDescNum) {
+    FlushBarriers();
+
     static_assert(sizeof(MicromapTriangle) == sizeof(VkMicromapTriangleEXT), "Mismatched sizeof");
 
     Scratch<VkMicromapBuildInfoEXT> infos = AllocateScratch(m_Device, VkMicromapBuildInfoEXT, buildMicromapDescNum);
@@ -1133,6 +1525,8 @@ NRI_INLINE void CommandBufferVK::BuildMicromaps(const BuildMicromapDesc* buildMi
 }
 
 NRI_INLINE void CommandBufferVK::CopyAccelerationStructure(AccelerationStructure& dst, const AccelerationStructure& src, CopyMode copyMode) {
+    FlushBarriers();
+
     VkAccelerationStructureKHR dstHandle = ((AccelerationStructureVK&)dst).GetHandle();
     VkAccelerationStructureKHR srcHandle = ((AccelerationStructureVK&)src).GetHandle();
 
@@ -1146,6 +1540,8 @@ NRI_INLINE void CommandBufferVK::CopyAccelerationStructure(AccelerationStructure
 }
 
 NRI_INLINE void CommandBufferVK::CopyMicromap(Micromap& dst, const Micromap& src, CopyMode copyMode) {
+    FlushBarriers();
+
     VkMicromapEXT dstHandle = ((MicromapVK&)dst).GetHandle();
     VkMicromapEXT srcHandle = ((MicromapVK&)src).GetHandle();
 
@@ -1159,6 +1555,8 @@ NRI_INLINE void CommandBufferVK::CopyMicromap(Micromap& dst, const Micromap& src
 }
 
 NRI_INLINE void CommandBufferVK::WriteAccelerationStructuresSizes(const AccelerationStructure* const* accelerationStructures, uint32_t accelerationStructureNum, QueryPool& queryPool, uint32_t queryPoolOffset) {
+    FlushBarriers();
+
     Scratch<VkAccelerationStructureKHR> handles = AllocateScratch(m_Device, VkAccelerationStructureKHR, accelerationStructureNum);
     for (uint32_t i = 0; i < accelerationStructureNum; i++)
         handles[i] = ((AccelerationStructureVK*)accelerationStructures[i])->GetHandle();
@@ -1170,6 +1568,8 @@ NRI_INLINE void CommandBufferVK::WriteAccelerationStructuresSizes(const Accelera
 }
 
 NRI_INLINE void CommandBufferVK::WriteMicromapsSizes(const Micromap* const* micromaps, uint32_t micromapNum, QueryPool& queryPool, uint32_t queryPoolOffset) {
+    FlushBarriers();
+
     Scratch<VkMicromapEXT> handles = AllocateScratch(m_Device, VkMicromapEXT, micromapNum);
     for (uint32_t i = 0; i < micromapNum; i++)
         handles[i] = ((MicromapVK*)micromaps[i])->GetHandle();
@@ -1181,6 +1581,9 @@ NRI_INLINE void CommandBufferVK::WriteMicromapsSizes(const Micromap* const* micr
 }
 
 NRI_INLINE void CommandBufferVK::DispatchRays(const DispatchRaysDesc& dispatchRaysDesc) {
+    FlushBarriers();
+    m_Stats.dispatchNum++;
+
     VkStridedDeviceAddressRegionKHR raygen = {};
     raygen.deviceAddress = GetBufferDeviceAddress(dispatchRaysDesc.raygenShader.buffer, dispatchRaysDesc.raygenShader.offset);
     raygen.size = dispatchRaysDesc.raygenShader.size;
@@ -1206,6 +1609,9 @@ NRI_INLINE void CommandBufferVK::DispatchRays(const DispatchRaysDesc& dispatchRa
 }
 
 NRI_INLINE void CommandBufferVK::DispatchRaysIndirect(const Buffer& buffer, uint64_t offset) {
+    FlushBarriers();
+    m_Stats.dispatchNum++;
+
     static_assert(sizeof(DispatchRaysIndirectDesc) == sizeof(VkTraceRaysIndirectCommand2KHR));
 
     VkDeviceAddress deviceAddress = GetBufferDeviceAddress(&buffer, offset);
@@ -1215,11 +1621,17 @@ NRI_INLINE void CommandBufferVK::DispatchRaysIndirect(const Buffer& buffer, uint
 }
 
 NRI_INLINE void CommandBufferVK::DrawMeshTasks(const DrawMeshTasksDesc& drawMeshTasksDesc) {
+    FlushBarriers();
+    m_Stats.drawNum++;
+
     const auto& vk = m_Device.GetDispatchTable();
     vk.CmdDrawMeshTasksEXT(m_Handle, drawMeshTasksDesc.x, drawMeshTasksDesc.y, drawMeshTasksDesc.z);
 }
 
 NRI_INLINE void CommandBufferVK::DrawMeshTasksIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
+    FlushBarriers();
+    m_Stats.drawNum++;
+
     static_assert(sizeof(DrawMeshTasksDesc) == sizeof(VkDrawMeshTasksIndirectCommandEXT));
 
     const BufferVK& bufferVK = (const BufferVK&)buffer;
@@ -1231,3 +1643,187 @@ NRI_INLINE void CommandBufferVK::DrawMeshTasksIndirect(const Buffer& buffer, uin
     } else
         vk.CmdDrawMeshTasksIndirectEXT(m_Handle, bufferVK.GetHandle(), offset, drawNum, stride);
 }
+
+NRI_INLINE void CommandBufferVK::ExecuteCommands(const CommandBuffer* const* secondaryCommandBuffers, uint32_t secondaryCommandBufferNum) {
+    if (!secondaryCommandBufferNum)
+        return;
+
+    FlushBarriers();
+
+    Scratch<VkCommandBuffer> commandBuffers = AllocateScratch(m_Device, VkCommandBuffer, secondaryCommandBufferNum);
+    for (uint32_t i = 0; i < secondaryCommandBufferNum; i++)
+        commandBuffers[i] = *(const CommandBufferVK*)secondaryCommandBuffers[i];
+
+    const auto& vk = m_Device.GetDispatchTable();
+    vk.CmdExecuteCommands(m_Handle, secondaryCommandBufferNum, commandBuffers);
+}
+
+NRI_INLINE uint32_t CommandBufferVK::BeginBarrier(const BarrierGroupDesc& barrierGroupDesc) {
+    FlushBarriers();
+
+    // No event (a wrapped command buffer or an error) means a regular barrier in "EndBarrier"
+    VkEvent event = VK_NULL_HANDLE;
+    if (m_CommandAllocator && m_CommandAllocator->AcquireEvent(event) == Result::SUCCESS)
+        Barrier(barrierGroupDesc, event, false);
+
+    m_Events.push_back(event);
+
+    return (uint32_t)m_Events.size() - 1;
+}
+
+NRI_INLINE void CommandBufferVK::EndBarrier(const BarrierGroupDesc& barrierGroupDesc, uint32_t splitBarrierIndex) {
+    FlushBarriers();
+
+    Barrier(barrierGroupDesc, m_Events[splitBarrierIndex], true);
+}
+
+constexpr VkAccessFlags2 WRITE_ACCESS_MASK = VK_ACCESS_2_SHADER_WRITE_BIT | VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT
+    | VK_ACCESS_2_TRANSFER_WRITE_BIT | VK_ACCESS_2_HOST_WRITE_BIT | VK_ACCESS_2_MEMORY_WRITE_BIT | VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT
+    | VK_ACCESS_2_ACCELERATION_STRUCTURE_WRITE_BIT_KHR | VK_ACCESS_2_MICROMAP_WRITE_BIT_EXT;
+
+// Read-only barriers with identical scopes (i.e. "before == after") don't do anything
+template <typename T>
+static inline bool IsBarrierNoOp(const T& barrier) {
+    return barrier.srcStageMask == barrier.dstStageMask && barrier.srcAccessMask == barrier.dstAccessMask && barrier.srcAccessMask != 0 && (barrier.srcAccessMask & WRITE_ACCESS_MASK) == 0;
+}
+
+static inline bool IsBarrierNoOp(const VkImageMemoryBarrier2& barrier) {
+    return barrier.oldLayout == barrier.newLayout && barrier.srcQueueFamilyIndex == barrier.dstQueueFamilyIndex && IsBarrierNoOp<VkImageMemoryBarrier2>(barrier);
+}
+
+template <typename T>
+static inline void MergeBarrierScopes(T& dst, const T& src) {
+    dst.srcStageMask |= src.srcStageMask;
+    dst.srcAccessMask |= src.srcAccessMask;
+    dst.dstStageMask |= src.dstStageMask;
+    dst.dstAccessMask |= src.dstAccessMask;
+}
+
+void CommandBufferVK::DeferBarriers(const VkDependencyInfo& dependencyInfo) {
+    // Barriers in a single "vkCmdPipelineBarrier2" are not ordered, i.e. dependency chains between global and resource barriers can't be preserved
+    bool hasResourceBarriers = dependencyInfo.bufferMemoryBarrierCount || dependencyInfo.imageMemoryBarrierCount;
+    if ((dependencyInfo.memoryBarrierCount && (!m_BufferBarriers.empty() || !m_ImageBarriers.empty())) || (hasResourceBarriers && !m_MemoryBarriers.empty()))
+        FlushBarriers();
+
+    // Global: all of them can be merged into one
+    for (uint32_t i = 0; i < dependencyInfo.memoryBarrierCount; i++) {
+        const VkMemoryBarrier2& in = dependencyInfo.pMemoryBarriers[i];
+
+        if (m_MemoryBarriers.empty())
+            m_MemoryBarriers.push_back(in);
+        else
+            MergeBarrierScopes(m_MemoryBarriers[0], in);
+    }
+
+    // Buffer: always the whole buffer, merged by handle
+    for (uint32_t i = 0; i < dependencyInfo.bufferMemoryBarrierCount; i++) {
+        const VkBufferMemoryBarrier2& in = dependencyInfo.pBufferMemoryBarriers[i];
+
+        auto it = std::find_if(m_BufferBarriers.begin(), m_BufferBarriers.end(), [&](const VkBufferMemoryBarrier2& pending) {
+            return pending.buffer == in.buffer;
+        });
+
+        if (it == m_BufferBarriers.end())
+            m_BufferBarriers.push_back(in);
+        else
+            MergeBarrierScopes(*it, in);
+    }
+
+    // Texture: merged if the same subresource range continues the pending transition, otherwise pending barriers get flushed to preserve ordering
+    for (uint32_t i = 0; i < dependencyInfo.imageMemoryBarrierCount; i++) {
+        const VkImageMemoryBarrier2& in = dependencyInfo.pImageMemoryBarriers[i];
+
+        auto it = std::find_if(m_ImageBarriers.begin(), m_ImageBarriers.end(), [&](const VkImageMemoryBarrier2& pending) {
+            return pending.image == in.image;
+        });
+
+        if (it == m_ImageBarriers.end())
+            m_ImageBarriers.push_back(in);
+        else {
+            const VkImageSubresourceRange& a = it->subresourceRange;
+            const VkImageSubresourceRange& b = in.subresourceRange;
+
+            bool isSameRange = a.aspectMask == b.aspectMask && a.baseMipLevel == b.baseMipLevel && a.levelCount == b.levelCount && a.baseArrayLayer == b.baseArrayLayer && a.layerCount == b.layerCount;
+            bool isOwnershipKept = it->srcQueueFamilyIndex == it->dstQueueFamilyIndex && in.srcQueueFamilyIndex == in.dstQueueFamilyIndex;
+
+            if (isSameRange && isOwnershipKept && it->newLayout == in.oldLayout) {
+                MergeBarrierScopes(*it, in);
+                it->newLayout = in.newLayout;
+            } else {
+                FlushBarriers();
+                m_ImageBarriers.push_back(in);
+            }
+        }
+    }
+}
+
+void CommandBufferVK::FlushBarriers() {
+    if (m_MemoryBarriers.empty() && m_BufferBarriers.empty() && m_ImageBarriers.empty())
+        return;
+
+    // Drop no-op transitions
+    m_MemoryBarriers.erase(std::remove_if(m_MemoryBarriers.begin(), m_MemoryBarriers.end(), IsBarrierNoOp<VkMemoryBarrier2>), m_MemoryBarriers.end());
+    m_BufferBarriers.erase(std::remove_if(m_BufferBarriers.begin(), m_BufferBarriers.end(), IsBarrierNoOp<VkBufferMemoryBarrier2>), m_BufferBarriers.end());
+    m_ImageBarriers.erase(std::remove_if(m_ImageBarriers.begin(), m_ImageBarriers.end(), [](const VkImageMemoryBarrier2& barrier) { return IsBarrierNoOp(barrier); }), m_ImageBarriers.end());
+
+    if (!m_MemoryBarriers.empty() || !m_BufferBarriers.empty() || !m_ImageBarriers.empty()) {
+        VkDependencyInfo dependencyInfo = {VK_STRUCTURE_TYPE_DEPENDENCY_INFO};
+        dependencyInfo.memoryBarrierCount = (uint32_t)m_MemoryBarriers.size();
+        dependencyInfo.pMemoryBarriers = m_MemoryBarriers.data();
+        dependencyInfo.bufferMemoryBarrierCount = (uint32_t)m_BufferBarriers.size();
+        dependencyInfo.pBufferMemoryBarriers = m_BufferBarriers.data();
+        dependencyInfo.imageMemoryBarrierCount = (uint32_t)m_ImageBarriers.size();
+        dependencyInfo.pImageMemoryBarriers = m_ImageBarriers.data();
+
+        const auto& vk = m_Device.GetDispatchTable();
+        vk.CmdPipelineBarrier2(m_Handle, &dependencyInfo);
+    }
+
+    m_MemoryBarriers.clear();
+    m_BufferBarriers.clear();
+    m_ImageBarriers.clear();
+}
+
+NRI_INLINE void CommandBufferVK::ExecuteGeneratedCommands(const GeneratedCommandsDesc& generatedCommandsDesc) {
+    FlushBarriers();
+
+    const IndirectCommandLayoutVK& indirectCommandLayoutVK = *(const IndirectCommandLayoutVK*)generatedCommandsDesc.indirectCommandLayout;
+    const IndirectExecutionSetVK* indirectExecutionSetVK = (const IndirectExecutionSetVK*)generatedCommandsDesc.indirectExecutionSet;
+    const BufferVK& bufferVK = *(const BufferVK*)generatedCommandsDesc.buffer;
+    const BufferVK* countBufferVK = (const BufferVK*)generatedCommandsDesc.countBuffer;
+    const BufferVK* preprocessBufferVK = (const BufferVK*)generatedCommandsDesc.preprocessBuffer;
+
+    VkGeneratedCommandsInfoEXT info = {VK_STRUCTURE_TYPE_GENERATED_COMMANDS_INFO_EXT};
+    info.shaderStages = indirectCommandLayoutVK.GetShaderStages();
+    info.indirectExecutionSet = indirectExecutionSetVK ? (VkIndirectExecutionSetEXT)*indirectExecutionSetVK : VK_NULL_HANDLE;
+    info.indirectCommandsLayout = indirectCommandLayoutVK;
+    info.indirectAddress = bufferVK.GetDeviceAddress() + generatedCommandsDesc.offset;
+    info.indirectAddressSize = bufferVK.GetDesc().size - generatedCommandsDesc.offset;
+    info.preprocessAddress = preprocessBufferVK ? preprocessBufferVK->GetDeviceAddress() : 0;
+    info.preprocessSize = preprocessBufferVK ? preprocessBufferVK->GetDesc().size : 0;
+    info.maxSequenceCount = generatedCommandsDesc.sequenceMaxNum;
+    info.sequenceCountAddress = countBufferVK ? countBufferVK->GetDeviceAddress() + generatedCommandsDesc.countBufferOffset : 0;
+
+    // Preprocessing is implicit, i.e. synchronized as an indirect command
+    const auto& vk = m_Device.GetDispatchTable();
+    vk.CmdExecuteGeneratedCommandsEXT(m_Handle, VK_FALSE, &info);
+}
+
+NRI_INLINE void CommandBufferVK::BeginConditionalRendering(const Buffer& buffer, uint64_t offset, bool inverted) {
+    FlushBarriers();
+
+    const BufferVK& bufferVK = (const BufferVK&)buffer;
+
+    VkConditionalRenderingBeginInfoEXT info = {VK_STRUCTURE_TYPE_CONDITIONAL_RENDERING_BEGIN_INFO_EXT};
+    info.buffer = bufferVK.GetHandle();
+    info.offset = offset;
+    info.flags = inverted ? VK_CONDITIONAL_RENDERING_INVERTED_BIT_EXT : 0;
+
+    const auto& vk = m_Device.GetDispatchTable();
+    vk.CmdBeginConditionalRenderingEXT(m_Handle, &info);
+}
+
+NRI_INLINE void CommandBufferVK::EndConditionalRendering() {
+    const auto& vk = m_Device.GetDispatchTable();
+    vk.CmdEndConditionalRenderingEXT(m_Handle);
+}
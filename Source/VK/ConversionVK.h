@@ -238,6 +238,37 @@ constexpr VkSamplerMipmapMode GetSamplerMipmapMode(Filter filter) {
     return g_SamplerMipmapModes[(size_t)filter];
 }
 
+constexpr std::array<VkAttachmentLoadOp, (size_t)LoadOp::MAX_NUM> g_LoadOps = {
+    VK_ATTACHMENT_LOAD_OP_LOAD,      // LOAD
+    VK_ATTACHMENT_LOAD_OP_CLEAR,     // CLEAR
+    VK_ATTACHMENT_LOAD_OP_DONT_CARE, // DONT_CARE
+};
+VALIDATE_ARRAY(g_LoadOps);
+
+constexpr VkAttachmentLoadOp GetLoadOp(LoadOp loadOp) {
+    return g_LoadOps[(size_t)loadOp];
+}
+
+constexpr std::array<VkAttachmentStoreOp, (size_t)StoreOp::MAX_NUM> g_StoreOps = {
+    VK_ATTACHMENT_STORE_OP_STORE,     // STORE
+    VK_ATTACHMENT_STORE_OP_DONT_CARE, // DONT_CARE
+};
+VALIDATE_ARRAY(g_StoreOps);
+
+constexpr VkAttachmentStoreOp GetStoreOp(StoreOp storeOp) {
+    return g_StoreOps[(size_t)storeOp];
+}
+
+constexpr std::array<VkResolveModeFlagBits, (size_t)ResolveOp::MAX_NUM> g_ResolveModes = {
+    VK_RESOLVE_MODE_AVERAGE_BIT,     // AVERAGE
+    VK_RESOLVE_MODE_SAMPLE_ZERO_BIT, // SAMPLE_ZERO
+};
+VALIDATE_ARRAY(g_ResolveModes);
+
+constexpr VkResolveModeFlagBits GetResolveMode(ResolveOp resolveOp) {
+    return g_ResolveModes[(size_t)resolveOp];
+}
+
 constexpr VkSamplerAddressMode GetSamplerAddressMode(AddressMode addressMode) {
     return (VkSamplerAddressMode)(VK_SAMPLER_ADDRESS_MODE_REPEAT + (uint32_t)addressMode);
 }
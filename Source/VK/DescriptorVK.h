@@ -25,6 +25,7 @@ struct DescriptorTexDesc {
     VkImage handle;
     const TextureVK* texture;
     VkImageLayout layout;
+    VkFormat format;
     VkImageAspectFlags aspectFlags;
     Dim_t layerOffset;
     Dim_t layerNum;
@@ -55,6 +55,7 @@ Result DescriptorVK::CreateTextureView(const T& textureViewDesc) {
     m_TextureDesc.handle = texture.GetHandle();
     m_TextureDesc.texture = &texture;
     m_TextureDesc.layout = GetImageLayoutForView(textureViewDesc.viewType);
+    m_TextureDesc.format = createInfo.format;
     m_TextureDesc.aspectFlags = GetImageAspectFlags(textureViewDesc.format);
     m_TextureDesc.layerOffset = textureViewDesc.layerOffset;
     m_TextureDesc.layerNum = (Dim_t)subresource.layerCount;
@@ -106,6 +107,7 @@ Result DescriptorVK::CreateTextureView(const Texture3DViewDesc& textureViewDesc)
     m_TextureDesc.handle = texture.GetHandle();
     m_TextureDesc.texture = &texture;
     m_TextureDesc.layout = GetImageLayoutForView(textureViewDesc.viewType);
+    m_TextureDesc.format = createInfo.format;
     m_TextureDesc.aspectFlags = GetImageAspectFlags(textureViewDesc.format);
     m_TextureDesc.layerOffset = 0;
     m_TextureDesc.layerNum = 1;
@@ -2,27 +2,40 @@
 
 #pragma once
 
+#include <mutex>
+#include <thread>
+
 namespace nri {
 
+struct FenceVK;
 struct QueueVK;
 
+struct FenceCallbackVK {
+    FenceCallbackDesc desc;
+    VkSemaphore semaphore;
+    uint64_t value;
+};
+
 struct IsSupported {
-    uint32_t descriptorIndexing     : 1;
-    uint32_t deviceAddress          : 1;
-    uint32_t swapChainMutableFormat : 1;
-    uint32_t presentId              : 1;
-    uint32_t memoryPriority         : 1;
-    uint32_t memoryBudget           : 1;
-    uint32_t maintenance4           : 1;
-    uint32_t maintenance5           : 1;
-    uint32_t maintenance6           : 1;
-    uint32_t imageSlicedView        : 1;
-    uint32_t customBorderColor      : 1;
-    uint32_t robustness             : 1;
-    uint32_t robustness2            : 1;
-    uint32_t pipelineRobustness     : 1;
-    uint32_t swapChainMaintenance1  : 1;
-    uint32_t fifoLatestReady        : 1;
+    uint32_t descriptorIndexing      : 1;
+    uint32_t deviceAddress           : 1;
+    uint32_t swapChainMutableFormat  : 1;
+    uint32_t presentId               : 1;
+    uint32_t memoryPriority          : 1;
+    uint32_t memoryBudget            : 1;
+    uint32_t maintenance4            : 1;
+    uint32_t maintenance5            : 1;
+    uint32_t maintenance6            : 1;
+    uint32_t imageSlicedView         : 1;
+    uint32_t customBorderColor       : 1;
+    uint32_t robustness              : 1;
+    uint32_t robustness2             : 1;
+    uint32_t pipelineRobustness      : 1;
+    uint32_t swapChainMaintenance1   : 1;
+    uint32_t fifoLatestReady         : 1;
+    uint32_t multiDraw               : 1;
+    uint32_t deviceGeneratedCommands : 1;
+    uint32_t conditionalRendering    : 1;
 };
 
 static_assert(sizeof(IsSupported) == sizeof(uint32_t), "4 bytes expected");
@@ -64,6 +77,22 @@ struct DeviceVK final : public DeviceBase {
         return m_Vma;
     }
 
+    inline bool IsBarrierBatchingEnabled() const {
+        return m_IsBarrierBatchingEnabled;
+    }
+
+    inline bool IsCommandBufferStatsEnabled() const {
+        return m_IsCommandBufferStatsEnabled;
+    }
+
+    inline bool IsAsyncSubmissionEnabled() const {
+        return m_IsAsyncSubmissionEnabled;
+    }
+
+    inline uint32_t GetMultiDrawMaxNum() const {
+        return m_MultiDrawMaxNum;
+    }
+
     template <typename Implementation, typename Interface, typename... Args>
     inline Result CreateImplementation(Interface*& entity, const Args&... args) {
         Implementation* impl = Allocate<Implementation>(GetAllocationCallbacks(), *this);
@@ -82,7 +111,7 @@ struct DeviceVK final : public DeviceBase {
     ~DeviceVK();
 
     Result Create(const DeviceCreationDesc& desc, const DeviceCreationVKDesc& descVK);
-    void FillCreateInfo(const BufferDesc& bufferDesc, VkBufferCreateInfo& info) const;
+    void FillCreateInfo(const BufferDesc& bufferDesc, VkBufferCreateInfo& info, VkBufferUsageFlags2CreateInfoKHR& usageFlags2) const;
     void FillCreateInfo(const TextureDesc& bufferDesc, VkImageCreateInfo& info) const;
     void GetMemoryDesc2(const BufferDesc& bufferDesc, MemoryLocation memoryLocation, MemoryDesc& memoryDesc) const;
     void GetMemoryDesc2(const TextureDesc& textureDesc, MemoryLocation memoryLocation, MemoryDesc& memoryDesc) const;
@@ -95,6 +124,7 @@ struct DeviceVK final : public DeviceBase {
     void SetDebugNameToTrivialObject(VkObjectType objectType, uint64_t handle, const char* name);
     Result CreateVma();
     void DestroyVma();
+    Result RegisterFenceCallback(const FenceVK& fence, uint64_t value, const FenceCallbackDesc& fenceCallbackDesc);
 
     //================================================================================================================
     // DebugNameBase
@@ -112,11 +142,20 @@ struct DeviceVK final : public DeviceBase {
 
     void Destruct() override;
     Result FillFunctionTable(CoreInterface& table) const override;
+    Result FillFunctionTable(CommandBufferStatsInterface& table) const override;
+    Result FillFunctionTable(ConditionalRenderingInterface& table) const override;
+    Result FillFunctionTable(DeviceGeneratedCommandsInterface& table) const override;
+    Result FillFunctionTable(FenceCallbackInterface& table) const override;
     Result FillFunctionTable(HelperInterface& table) const override;
     Result FillFunctionTable(LowLatencyInterface& table) const override;
     Result FillFunctionTable(MeshShaderInterface& table) const override;
+    Result FillFunctionTable(QueueSchedulerInterface& table) const override;
+    Result FillFunctionTable(QueueTimelineInterface& table) const override;
     Result FillFunctionTable(RayTracingInterface& table) const override;
+    Result FillFunctionTable(RenderGraphInterface& table) const override;
     Result FillFunctionTable(ResourceAllocatorInterface& table) const override;
+    Result FillFunctionTable(SecondaryCommandBufferInterface& table) const override;
+    Result FillFunctionTable(SplitBarrierInterface& table) const override;
     Result FillFunctionTable(StreamerInterface& table) const override;
     Result FillFunctionTable(SwapChainInterface& table) const override;
     Result FillFunctionTable(UpscalerInterface& table) const override;
@@ -132,6 +171,7 @@ struct DeviceVK final : public DeviceBase {
 
     Result GetQueue(QueueType queueType, uint32_t queueIndex, Queue*& queue);
     Result WaitIdle();
+    Result WaitMulti(const FenceWaitDesc* fenceWaitDescs, uint32_t fenceWaitDescNum, bool waitAny, uint32_t timeout);
     Result BindBufferMemory(const BufferMemoryBindingDesc* memoryBindingDescs, uint32_t memoryBindingDescNum);
     Result BindTextureMemory(const TextureMemoryBindingDesc* memoryBindingDescs, uint32_t memoryBindingDescNum);
     Result QueryVideoMemoryInfo(MemoryLocation memoryLocation, VideoMemoryInfo& videoMemoryInfo) const;
@@ -148,6 +188,8 @@ private:
     Result ResolvePreInstanceDispatchTable();
     Result ResolveInstanceDispatchTable(const Vector<const char*>& desiredInstanceExts);
     Result ResolveDispatchTable(const Vector<const char*>& desiredDeviceExts);
+    void FenceCallbackWorker();
+    void DestroyFenceCallbackWorker();
 
 public:
     union {
@@ -173,8 +215,20 @@ private:
     VmaAllocator_T* m_Vma = nullptr;
     uint32_t m_NumActiveFamilyIndices = 0;
     uint32_t m_MinorVersion = 0;
+    uint32_t m_MultiDrawMaxNum = 0;
     bool m_OwnsNativeObjects = true;
+    bool m_IsBarrierBatchingEnabled = false;
+    bool m_IsCommandBufferStatsEnabled = false;
+    bool m_IsAsyncSubmissionEnabled = false;
     Lock m_Lock;
+
+    // Fence callbacks (the worker is created on the first registration and woken up by signaling "m_FenceCallbackWakeup" on the host)
+    Vector<FenceCallbackVK> m_FenceCallbacks;
+    std::thread m_FenceCallbackThread;
+    std::mutex m_FenceCallbackMutex;
+    VkSemaphore m_FenceCallbackWakeup = VK_NULL_HANDLE;
+    uint64_t m_FenceCallbackWakeupValue = 0;
+    bool m_IsFenceCallbackExiting = false;
 };
 
 } // namespace nri
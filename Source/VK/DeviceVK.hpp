@@ -343,6 +343,12 @@ void DeviceVK::ProcessDeviceExtensions(Vector<const char*>& desiredDeviceExts, b
     if (IsExtensionSupported(VK_EXT_FRAGMENT_SHADER_INTERLOCK_EXTENSION_NAME, supportedExts))
         desiredDeviceExts.push_back(VK_EXT_FRAGMENT_SHADER_INTERLOCK_EXTENSION_NAME);
 
+    if (IsExtensionSupported(VK_EXT_MULTI_DRAW_EXTENSION_NAME, supportedExts))
+        desiredDeviceExts.push_back(VK_EXT_MULTI_DRAW_EXTENSION_NAME);
+
+    if (IsExtensionSupported(VK_EXT_CONDITIONAL_RENDERING_EXTENSION_NAME, supportedExts))
+        desiredDeviceExts.push_back(VK_EXT_CONDITIONAL_RENDERING_EXTENSION_NAME);
+
     // Optional
     if (IsExtensionSupported(VK_NV_LOW_LATENCY_2_EXTENSION_NAME, supportedExts))
         desiredDeviceExts.push_back(VK_NV_LOW_LATENCY_2_EXTENSION_NAME);
@@ -364,7 +370,8 @@ DeviceVK::DeviceVK(const CallbackInterface& callbacks, const AllocationCallbacks
           Vector<QueueVK*>(GetStdAllocator()),
           Vector<QueueVK*>(GetStdAllocator()),
           Vector<QueueVK*>(GetStdAllocator()),
-      } {
+      }
+    , m_FenceCallbacks(GetStdAllocator()) {
     m_AllocationCallbacks.pUserData = (void*)&GetAllocationCallbacks();
     m_AllocationCallbacks.pfnAllocation = vkAllocateHostMemory;
     m_AllocationCallbacks.pfnReallocation = vkReallocateHostMemory;
@@ -375,6 +382,7 @@ DeviceVK::DeviceVK(const CallbackInterface& callbacks, const AllocationCallbacks
 }
 
 DeviceVK::~DeviceVK() {
+    DestroyFenceCallbackWorker();
     DestroyVma();
 
     for (auto& queueFamily : m_QueueFamilies) {
@@ -404,6 +412,9 @@ Result DeviceVK::Create(const DeviceCreationDesc& desc, const DeviceCreationVKDe
     bool isWrapper = descVK.vkDevice != nullptr;
     m_OwnsNativeObjects = !isWrapper;
     m_BindingOffsets = desc.vkBindingOffsets;
+    m_IsBarrierBatchingEnabled = desc.enableVKBarrierBatching;
+    m_IsCommandBufferStatsEnabled = desc.enableVKCommandBufferStats;
+    m_IsAsyncSubmissionEnabled = desc.enableVKAsyncSubmission;
 
     if (!isWrapper && !GetAllocationCallbacks().disable3rdPartyAllocationCallbacks)
         m_AllocationCallbackPtr = &m_AllocationCallbacks;
@@ -763,6 +774,22 @@ Result DeviceVK::Create(const DeviceCreationDesc& desc, const DeviceCreationVKDe
         APPEND_EXT(fragmentShaderInterlockFeatures);
     }
 
+    VkPhysicalDeviceMultiDrawFeaturesEXT multiDrawFeatures = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTI_DRAW_FEATURES_EXT};
+    if (IsExtensionSupported(VK_EXT_MULTI_DRAW_EXTENSION_NAME, desiredDeviceExts)) {
+        APPEND_EXT(multiDrawFeatures);
+    }
+
+    VkPhysicalDeviceConditionalRenderingFeaturesEXT conditionalRenderingFeatures = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONDITIONAL_RENDERING_FEATURES_EXT};
+    if (IsExtensionSupported(VK_EXT_CONDITIONAL_RENDERING_EXTENSION_NAME, desiredDeviceExts)) {
+        APPEND_EXT(conditionalRenderingFeatures);
+    }
+
+    // Opt-in (must be requested in "VKExtensions::deviceExtensions")
+    VkPhysicalDeviceDeviceGeneratedCommandsFeaturesEXT deviceGeneratedCommandsFeatures = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_GENERATED_COMMANDS_FEATURES_EXT};
+    if (IsExtensionSupported(VK_EXT_DEVICE_GENERATED_COMMANDS_EXTENSION_NAME, desiredDeviceExts)) {
+        APPEND_EXT(deviceGeneratedCommandsFeatures);
+    }
+
     VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT swapchainMaintenance1Features = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SWAPCHAIN_MAINTENANCE_1_FEATURES_EXT};
     if (IsExtensionSupported(VK_EXT_SWAPCHAIN_MAINTENANCE_1_EXTENSION_NAME, desiredDeviceExts)) {
         APPEND_EXT(swapchainMaintenance1Features);
@@ -793,6 +820,9 @@ Result DeviceVK::Create(const DeviceCreationDesc& desc, const DeviceCreationVKDe
     m_IsSupported.pipelineRobustness = pipelineRobustnessFeatures.pipelineRobustness;
     m_IsSupported.swapChainMaintenance1 = swapchainMaintenance1Features.swapchainMaintenance1;
     m_IsSupported.fifoLatestReady = presentModeFifoLatestReadyFeaturesEXT.presentModeFifoLatestReady;
+    m_IsSupported.multiDraw = multiDrawFeatures.multiDraw;
+    m_IsSupported.conditionalRendering = conditionalRenderingFeatures.conditionalRendering;
+    m_IsSupported.deviceGeneratedCommands = deviceGeneratedCommandsFeatures.deviceGeneratedCommands && maintenance5Features.maintenance5 && features12.bufferDeviceAddress;
 
     { // Check hard requirements
         bool hasDynamicRendering = features13.dynamicRendering != 0 || (dynamicRenderingFeatures.dynamicRendering != 0 && extendedDynamicStateFeatures.extendedDynamicState != 0);
@@ -1002,6 +1032,11 @@ Result DeviceVK::Create(const DeviceCreationDesc& desc, const DeviceCreationVKDe
             APPEND_EXT(computeShaderDerivativesProps);
         }
 
+        VkPhysicalDeviceMultiDrawPropertiesEXT multiDrawProps = {VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTI_DRAW_PROPERTIES_EXT};
+        if (IsExtensionSupported(VK_EXT_MULTI_DRAW_EXTENSION_NAME, desiredDeviceExts)) {
+            APPEND_EXT(multiDrawProps);
+        }
+
         m_VK.GetPhysicalDeviceProperties2(m_PhysicalDevice, &props);
 
         // Fill desc
@@ -1187,6 +1222,8 @@ Result DeviceVK::Create(const DeviceCreationDesc& desc, const DeviceCreationVKDe
         m_Desc.other.viewMaxNum = features11.multiview ? (uint8_t)props11.maxMultiviewViewCount : 1;
         m_Desc.other.shadingRateAttachmentTileSize = (uint8_t)shadingRateProps.minFragmentShadingRateAttachmentTexelSize.width;
 
+        m_MultiDrawMaxNum = multiDrawProps.maxMultiDrawCount;
+
         if (m_Desc.tiers.conservativeRaster) {
             if (conservativeRasterProps.primitiveOverestimationSize < 1.0f / 2.0f && conservativeRasterProps.degenerateTrianglesRasterized)
                 m_Desc.tiers.conservativeRaster = 2;
@@ -1239,10 +1276,12 @@ Result DeviceVK::Create(const DeviceCreationDesc& desc, const DeviceCreationVKDe
         m_Desc.features.dynamicDepthBias = true;
         m_Desc.features.viewportOriginBottomLeft = true;
         m_Desc.features.regionResolve = true;
+        m_Desc.features.renderingResolve = true;
         m_Desc.features.layerBasedMultiview = features11.multiview;
         m_Desc.features.presentFromCompute = true;
         m_Desc.features.waitableSwapChain = presentIdFeatures.presentId != 0 && presentWaitFeatures.presentWait != 0;
         m_Desc.features.pipelineStatistics = features.features.pipelineStatisticsQuery;
+        m_Desc.features.hostFenceSignal = true;
 
         m_Desc.shaderFeatures.nativeI16 = features.features.shaderInt16;
         m_Desc.shaderFeatures.nativeF16 = features12.shaderFloat16;
@@ -1294,13 +1333,23 @@ Result DeviceVK::Create(const DeviceCreationDesc& desc, const DeviceCreationVKDe
     return FillFunctionTable(m_iCore);
 }
 
-void DeviceVK::FillCreateInfo(const BufferDesc& bufferDesc, VkBufferCreateInfo& info) const {
+void DeviceVK::FillCreateInfo(const BufferDesc& bufferDesc, VkBufferCreateInfo& info, VkBufferUsageFlags2CreateInfoKHR& usageFlags2) const {
     info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO; // should be already set
     info.size = bufferDesc.size;
     info.usage = GetBufferUsageFlags(bufferDesc.usage, bufferDesc.structureStride, m_IsSupported.deviceAddress);
+    if (m_IsSupported.conditionalRendering && (bufferDesc.usage & BufferUsageBits::ARGUMENT_BUFFER))
+        info.usage |= VK_BUFFER_USAGE_CONDITIONAL_RENDERING_BIT_EXT; // predicates live in argument buffers
     info.sharingMode = m_NumActiveFamilyIndices <= 1 ? VK_SHARING_MODE_EXCLUSIVE : VK_SHARING_MODE_CONCURRENT;
     info.queueFamilyIndexCount = m_NumActiveFamilyIndices;
     info.pQueueFamilyIndices = m_ActiveQueueFamilyIndices.data();
+
+    // "PREPROCESS" usage is expressible only via "VkBufferUsageFlags2"
+    if (bufferDesc.usage & BufferUsageBits::PREPROCESS_BUFFER) {
+        usageFlags2 = {VK_STRUCTURE_TYPE_BUFFER_USAGE_FLAGS_2_CREATE_INFO_KHR};
+        usageFlags2.usage = info.usage | VK_BUFFER_USAGE_2_PREPROCESS_BUFFER_BIT_EXT;
+
+        info.pNext = &usageFlags2;
+    }
 }
 
 void DeviceVK::FillCreateInfo(const TextureDesc& textureDesc, VkImageCreateInfo& info) const {
@@ -1339,7 +1388,8 @@ void DeviceVK::FillCreateInfo(const TextureDesc& textureDesc, VkImageCreateInfo&
 
 void DeviceVK::GetMemoryDesc2(const BufferDesc& bufferDesc, MemoryLocation memoryLocation, MemoryDesc& memoryDesc) const {
     VkBufferCreateInfo createInfo = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
-    FillCreateInfo(bufferDesc, createInfo);
+    VkBufferUsageFlags2CreateInfoKHR usageFlags2 = {};
+    FillCreateInfo(bufferDesc, createInfo, usageFlags2);
 
     VkMemoryDedicatedRequirements dedicatedRequirements = {VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS};
 
@@ -1657,6 +1707,124 @@ void DeviceVK::SetDebugNameToTrivialObject(VkObjectType objectType, uint64_t han
     RETURN_VOID_ON_BAD_VKRESULT(this, vkResult, "vkSetDebugUtilsObjectNameEXT");
 }
 
+Result DeviceVK::RegisterFenceCallback(const FenceVK& fence, uint64_t value, const FenceCallbackDesc& fenceCallbackDesc) {
+    std::lock_guard<std::mutex> lock(m_FenceCallbackMutex);
+
+    if (!m_FenceCallbackThread.joinable()) {
+        VkSemaphoreTypeCreateInfo semaphoreTypeCreateInfo = {VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO};
+        semaphoreTypeCreateInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+
+        VkSemaphoreCreateInfo semaphoreCreateInfo = {VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO};
+        semaphoreCreateInfo.pNext = &semaphoreTypeCreateInfo;
+
+        VkResult vkResult = m_VK.CreateSemaphore(m_Device, &semaphoreCreateInfo, m_AllocationCallbackPtr, &m_FenceCallbackWakeup);
+        RETURN_ON_BAD_VKRESULT(this, vkResult, "vkCreateSemaphore");
+
+        m_FenceCallbackThread = std::thread(&DeviceVK::FenceCallbackWorker, this);
+    }
+
+    FenceCallbackVK& fenceCallback = m_FenceCallbacks.emplace_back();
+    fenceCallback.desc = fenceCallbackDesc;
+    fenceCallback.semaphore = fence;
+    fenceCallback.value = value;
+
+    // Interrupt the current wait to add the new value (signaled under the lock to keep values increasing)
+    VkSemaphoreSignalInfo semaphoreSignalInfo = {VK_STRUCTURE_TYPE_SEMAPHORE_SIGNAL_INFO};
+    semaphoreSignalInfo.semaphore = m_FenceCallbackWakeup;
+    semaphoreSignalInfo.value = m_FenceCallbackWakeupValue + 1;
+
+    VkResult vkResult = m_VK.SignalSemaphore(m_Device, &semaphoreSignalInfo);
+    if (vkResult != VK_SUCCESS)
+        m_FenceCallbacks.pop_back(); // the callback must not be called, if registration failed
+
+    RETURN_ON_BAD_VKRESULT(this, vkResult, "vkSignalSemaphore");
+
+    m_FenceCallbackWakeupValue++;
+
+    return Result::SUCCESS;
+}
+
+void DeviceVK::FenceCallbackWorker() {
+    Vector<VkSemaphore> semaphores(GetStdAllocator());
+    Vector<uint64_t> values(GetStdAllocator());
+    Vector<FenceCallbackDesc> completed(GetStdAllocator());
+
+    while (true) {
+        { // Gather pending values
+            std::lock_guard<std::mutex> lock(m_FenceCallbackMutex);
+            if (m_IsFenceCallbackExiting)
+                break;
+
+            semaphores.clear();
+            values.clear();
+
+            semaphores.push_back(m_FenceCallbackWakeup);
+            values.push_back(m_FenceCallbackWakeupValue + 1);
+
+            for (const FenceCallbackVK& fenceCallback : m_FenceCallbacks) {
+                semaphores.push_back(fenceCallback.semaphore);
+                values.push_back(fenceCallback.value);
+            }
+        }
+
+        // Wait for any
+        VkSemaphoreWaitInfo semaphoreWaitInfo = {VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO};
+        semaphoreWaitInfo.flags = VK_SEMAPHORE_WAIT_ANY_BIT;
+        semaphoreWaitInfo.semaphoreCount = (uint32_t)semaphores.size();
+        semaphoreWaitInfo.pSemaphores = semaphores.data();
+        semaphoreWaitInfo.pValues = values.data();
+
+        VkResult vkResult = m_VK.WaitSemaphores(m_Device, &semaphoreWaitInfo, UINT64_MAX);
+        if (vkResult != VK_SUCCESS) {
+            REPORT_ERROR(this, "vkWaitSemaphores returned %d, fence callbacks are not served anymore", (int32_t)vkResult);
+            break;
+        }
+
+        { // Extract completed callbacks
+            std::lock_guard<std::mutex> lock(m_FenceCallbackMutex);
+
+            for (size_t i = 0; i < m_FenceCallbacks.size();) {
+                uint64_t value = 0;
+                m_VK.GetSemaphoreCounterValue(m_Device, m_FenceCallbacks[i].semaphore, &value);
+
+                if (value >= m_FenceCallbacks[i].value) {
+                    completed.push_back(m_FenceCallbacks[i].desc);
+
+                    m_FenceCallbacks[i] = m_FenceCallbacks.back();
+                    m_FenceCallbacks.pop_back();
+                } else
+                    i++;
+            }
+        }
+
+        // Call outside of the lock, callbacks can register new callbacks
+        for (const FenceCallbackDesc& fenceCallbackDesc : completed)
+            fenceCallbackDesc.Callback(fenceCallbackDesc.userArg);
+
+        completed.clear();
+    }
+}
+
+void DeviceVK::DestroyFenceCallbackWorker() {
+    if (m_FenceCallbackThread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(m_FenceCallbackMutex);
+            m_IsFenceCallbackExiting = true;
+
+            VkSemaphoreSignalInfo semaphoreSignalInfo = {VK_STRUCTURE_TYPE_SEMAPHORE_SIGNAL_INFO};
+            semaphoreSignalInfo.semaphore = m_FenceCallbackWakeup;
+            semaphoreSignalInfo.value = ++m_FenceCallbackWakeupValue;
+
+            m_VK.SignalSemaphore(m_Device, &semaphoreSignalInfo);
+        }
+
+        m_FenceCallbackThread.join();
+    }
+
+    if (m_FenceCallbackWakeup)
+        m_VK.DestroySemaphore(m_Device, m_FenceCallbackWakeup, m_AllocationCallbackPtr);
+}
+
 void DeviceVK::ReportDeviceGroupInfo() {
     String text(GetStdAllocator());
 
@@ -1819,6 +1987,7 @@ Result DeviceVK::ResolveDispatchTable(const Vector<const char*>& desiredDeviceEx
     GET_DEVICE_CORE_FUNC(CreateSampler);
     GET_DEVICE_CORE_FUNC(CreateQueryPool);
     GET_DEVICE_CORE_FUNC(CreateCommandPool);
+    GET_DEVICE_CORE_FUNC(CreateEvent);
     GET_DEVICE_CORE_FUNC(CreateSemaphore);
     GET_DEVICE_CORE_FUNC(CreateDescriptorPool);
     GET_DEVICE_CORE_FUNC(CreatePipelineLayout);
@@ -1836,6 +2005,7 @@ Result DeviceVK::ResolveDispatchTable(const Vector<const char*>& desiredDeviceEx
     GET_DEVICE_CORE_FUNC(DestroyFramebuffer);
     GET_DEVICE_CORE_FUNC(DestroyQueryPool);
     GET_DEVICE_CORE_FUNC(DestroyCommandPool);
+    GET_DEVICE_CORE_FUNC(DestroyEvent);
     GET_DEVICE_CORE_FUNC(DestroySemaphore);
     GET_DEVICE_CORE_FUNC(DestroyDescriptorPool);
     GET_DEVICE_CORE_FUNC(DestroyPipelineLayout);
@@ -1851,6 +2021,7 @@ Result DeviceVK::ResolveDispatchTable(const Vector<const char*>& desiredDeviceEx
     GET_DEVICE_CORE_FUNC(QueueSubmit2);
     GET_DEVICE_CORE_FUNC(GetSemaphoreCounterValue);
     GET_DEVICE_CORE_FUNC(WaitSemaphores);
+    GET_DEVICE_CORE_FUNC(SignalSemaphore);
     GET_DEVICE_CORE_FUNC(ResetCommandPool);
     GET_DEVICE_CORE_FUNC(ResetDescriptorPool);
     GET_DEVICE_CORE_FUNC(AllocateCommandBuffers);
@@ -1891,14 +2062,19 @@ Result DeviceVK::ResolveDispatchTable(const Vector<const char*>& desiredDeviceEx
     GET_DEVICE_CORE_FUNC(CmdCopyBufferToImage2);
     GET_DEVICE_CORE_FUNC(CmdCopyImageToBuffer2);
     GET_DEVICE_CORE_FUNC(CmdPipelineBarrier2);
+    GET_DEVICE_CORE_FUNC(CmdSetEvent2);
+    GET_DEVICE_CORE_FUNC(CmdWaitEvents2);
+    GET_DEVICE_CORE_FUNC(CmdResetEvent2);
     GET_DEVICE_CORE_FUNC(CmdBeginQuery);
     GET_DEVICE_CORE_FUNC(CmdEndQuery);
     GET_DEVICE_CORE_FUNC(CmdWriteTimestamp2);
     GET_DEVICE_CORE_FUNC(CmdCopyQueryPoolResults);
     GET_DEVICE_CORE_FUNC(CmdResetQueryPool);
     GET_DEVICE_CORE_FUNC(CmdFillBuffer);
+    GET_DEVICE_CORE_FUNC(CmdUpdateBuffer);
     GET_DEVICE_CORE_FUNC(CmdBeginRendering);
     GET_DEVICE_CORE_FUNC(CmdEndRendering);
+    GET_DEVICE_CORE_FUNC(CmdExecuteCommands);
     GET_DEVICE_CORE_FUNC(EndCommandBuffer);
 
     // IMPORTANT: { } are mandatory here!
@@ -1968,6 +2144,26 @@ Result DeviceVK::ResolveDispatchTable(const Vector<const char*>& desiredDeviceEx
         GET_DEVICE_FUNC(CmdDrawMeshTasksIndirectCountEXT);
     }
 
+    if (IsExtensionSupported(VK_EXT_MULTI_DRAW_EXTENSION_NAME, desiredDeviceExts)) {
+        GET_DEVICE_FUNC(CmdDrawMultiEXT);
+        GET_DEVICE_FUNC(CmdDrawMultiIndexedEXT);
+    }
+
+    if (IsExtensionSupported(VK_EXT_CONDITIONAL_RENDERING_EXTENSION_NAME, desiredDeviceExts)) {
+        GET_DEVICE_FUNC(CmdBeginConditionalRenderingEXT);
+        GET_DEVICE_FUNC(CmdEndConditionalRenderingEXT);
+    }
+
+    if (IsExtensionSupported(VK_EXT_DEVICE_GENERATED_COMMANDS_EXTENSION_NAME, desiredDeviceExts)) {
+        GET_DEVICE_FUNC(CreateIndirectCommandsLayoutEXT);
+        GET_DEVICE_FUNC(DestroyIndirectCommandsLayoutEXT);
+        GET_DEVICE_FUNC(CreateIndirectExecutionSetEXT);
+        GET_DEVICE_FUNC(DestroyIndirectExecutionSetEXT);
+        GET_DEVICE_FUNC(UpdateIndirectExecutionSetPipelineEXT);
+        GET_DEVICE_FUNC(GetGeneratedCommandsMemoryRequirementsEXT);
+        GET_DEVICE_FUNC(CmdExecuteGeneratedCommandsEXT);
+    }
+
     if (IsExtensionSupported(VK_NV_LOW_LATENCY_2_EXTENSION_NAME, desiredDeviceExts)) {
         GET_DEVICE_FUNC(GetLatencyTimingsNV);
         GET_DEVICE_FUNC(LatencySleepNV);
@@ -2021,6 +2217,30 @@ NRI_INLINE Result DeviceVK::GetQueue(QueueType queueType, uint32_t queueIndex, Q
     return Result::FAILURE;
 }
 
+NRI_INLINE Result DeviceVK::WaitMulti(const FenceWaitDesc* fenceWaitDescs, uint32_t fenceWaitDescNum, bool waitAny, uint32_t timeout) {
+    Scratch<VkSemaphore> semaphores = AllocateScratch(*this, VkSemaphore, fenceWaitDescNum);
+    Scratch<uint64_t> values = AllocateScratch(*this, uint64_t, fenceWaitDescNum);
+    for (uint32_t i = 0; i < fenceWaitDescNum; i++) {
+        semaphores[i] = *(FenceVK*)fenceWaitDescs[i].fence;
+        values[i] = fenceWaitDescs[i].value;
+    }
+
+    VkSemaphoreWaitInfo semaphoreWaitInfo = {VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO};
+    semaphoreWaitInfo.flags = waitAny ? VK_SEMAPHORE_WAIT_ANY_BIT : 0;
+    semaphoreWaitInfo.semaphoreCount = fenceWaitDescNum;
+    semaphoreWaitInfo.pSemaphores = semaphores;
+    semaphoreWaitInfo.pValues = values;
+
+    const auto& vk = GetDispatchTable();
+    VkResult vkResult = vk.WaitSemaphores(m_Device, &semaphoreWaitInfo, timeout == UINT32_MAX ? UINT64_MAX : MsToUs(timeout));
+    if (vkResult == VK_TIMEOUT)
+        return Result::TIMEOUT;
+
+    RETURN_ON_BAD_VKRESULT(this, vkResult, "vkWaitSemaphores");
+
+    return Result::SUCCESS;
+}
+
 NRI_INLINE Result DeviceVK::WaitIdle() {
     // Don't use "vkDeviceWaitIdle" because it requires host access synchronization to all queues, better do it one by one instead
     for (auto& queueFamily : m_QueueFamilies) {
@@ -70,6 +70,7 @@ struct DispatchTable {
     VK_FUNC(CreateSampler);                               // + | +
     VK_FUNC(CreateQueryPool);                             // + | +
     VK_FUNC(CreateCommandPool);                           // + | +
+    VK_FUNC(CreateEvent);                                 // + | +
     VK_FUNC(CreateSemaphore);                             // + | +
     VK_FUNC(CreateDescriptorPool);                        // + | +
     VK_FUNC(CreatePipelineLayout);                        // + | +
@@ -87,6 +88,7 @@ struct DispatchTable {
     VK_FUNC(DestroyFramebuffer);                          // - | +
     VK_FUNC(DestroyQueryPool);                            // - | +
     VK_FUNC(DestroyCommandPool);                          // - | +
+    VK_FUNC(DestroyEvent);                                // - | +
     VK_FUNC(DestroySemaphore);                            // - | +
     VK_FUNC(DestroyDescriptorPool);                       // - | +
     VK_FUNC(DestroyPipelineLayout);                       // - | +
@@ -102,6 +104,7 @@ struct DispatchTable {
     VK_FUNC(QueueSubmit2);                                // - | + may return "VK_ERROR_DEVICE_LOST"
     VK_FUNC(GetSemaphoreCounterValue);                    // + | + TODO: may return "VK_ERROR_DEVICE_LOST"
     VK_FUNC(WaitSemaphores);                              // + | + TODO: may return "VK_ERROR_DEVICE_LOST"
+    VK_FUNC(SignalSemaphore);                             // + | +
     VK_FUNC(ResetCommandPool);                            // - | +
     VK_FUNC(ResetDescriptorPool);                         // - | +
     VK_FUNC(AllocateCommandBuffers);                      // - | +
@@ -144,14 +147,19 @@ struct DispatchTable {
     VK_FUNC(CmdCopyBufferToImage2);                       // - | +
     VK_FUNC(CmdCopyImageToBuffer2);                       // - | +
     VK_FUNC(CmdPipelineBarrier2);                         // - | +
+    VK_FUNC(CmdSetEvent2);                                // - | +
+    VK_FUNC(CmdWaitEvents2);                              // - | +
+    VK_FUNC(CmdResetEvent2);                              // - | +
     VK_FUNC(CmdBeginQuery);                               // - | +
     VK_FUNC(CmdEndQuery);                                 // - | +
     VK_FUNC(CmdWriteTimestamp2);                          // - | +
     VK_FUNC(CmdCopyQueryPoolResults);                     // - | +
     VK_FUNC(CmdResetQueryPool);                           // - | +
     VK_FUNC(CmdFillBuffer);                               // - | +
+    VK_FUNC(CmdUpdateBuffer);                             // - | +
     VK_FUNC(CmdBeginRendering);                           // - | +
     VK_FUNC(CmdEndRendering);                             // - | +
+    VK_FUNC(CmdExecuteCommands);                          // - | +
     VK_FUNC(EndCommandBuffer);                            // - | +
                                                           // VK_KHR_maintenance5
     VK_FUNC(CmdBindIndexBuffer2KHR);                      // - | +
@@ -193,6 +201,20 @@ struct DispatchTable {
     VK_FUNC(CmdDrawMeshTasksEXT);                         // - | +
     VK_FUNC(CmdDrawMeshTasksIndirectEXT);                 // - | +
     VK_FUNC(CmdDrawMeshTasksIndirectCountEXT);            // - | +
+                                                          // VK_EXT_multi_draw
+    VK_FUNC(CmdDrawMultiEXT);                             // - | +
+    VK_FUNC(CmdDrawMultiIndexedEXT);                      // - | +
+                                                          // VK_EXT_conditional_rendering
+    VK_FUNC(CmdBeginConditionalRenderingEXT);             // - | +
+    VK_FUNC(CmdEndConditionalRenderingEXT);               // - | +
+                                                          // VK_EXT_device_generated_commands
+    VK_FUNC(CreateIndirectCommandsLayoutEXT);             // + | +
+    VK_FUNC(DestroyIndirectCommandsLayoutEXT);            // - | +
+    VK_FUNC(CreateIndirectExecutionSetEXT);               // + | +
+    VK_FUNC(DestroyIndirectExecutionSetEXT);              // - | +
+    VK_FUNC(UpdateIndirectExecutionSetPipelineEXT);       // - | +
+    VK_FUNC(GetGeneratedCommandsMemoryRequirementsEXT);   // + | +
+    VK_FUNC(CmdExecuteGeneratedCommandsEXT);              // - | +
                                                           // VK_NV_low_latency2
     VK_FUNC(GetLatencyTimingsNV);                         // + | +
     VK_FUNC(LatencySleepNV);                              // + | +
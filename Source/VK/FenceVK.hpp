@@ -43,3 +43,13 @@ NRI_INLINE void FenceVK::Wait(uint64_t value) {
     const auto& vk = m_Device.GetDispatchTable();
     vk.WaitSemaphores((VkDevice)m_Device, &semaphoreWaitInfo, MsToUs(TIMEOUT_FENCE));
 }
+
+NRI_INLINE void FenceVK::Signal(uint64_t value) {
+    VkSemaphoreSignalInfo semaphoreSignalInfo = {VK_STRUCTURE_TYPE_SEMAPHORE_SIGNAL_INFO};
+    semaphoreSignalInfo.semaphore = m_Handle;
+    semaphoreSignalInfo.value = value;
+
+    const auto& vk = m_Device.GetDispatchTable();
+    VkResult vkResult = vk.SignalSemaphore((VkDevice)m_Device, &semaphoreSignalInfo);
+    RETURN_VOID_ON_BAD_VKRESULT(&m_Device, vkResult, "vkSignalSemaphore");
+}
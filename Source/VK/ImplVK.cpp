@@ -11,6 +11,8 @@
 #include "DescriptorSetVK.h"
 #include "DescriptorVK.h"
 #include "FenceVK.h"
+#include "IndirectCommandLayoutVK.h"
+#include "IndirectExecutionSetVK.h"
 #include "MemoryVK.h"
 #include "MicromapVK.h"
 #include "PipelineLayoutVK.h"
@@ -22,6 +24,8 @@
 
 #include "HelperInterface.h"
 #include "ImguiInterface.h"
+#include "QueueSchedulerInterface.h"
+#include "RenderGraphInterface.h"
 #include "StreamerInterface.h"
 #include "UpscalerInterface.h"
 
@@ -37,6 +41,8 @@ using namespace nri;
 #include "DescriptorVK.hpp"
 #include "DeviceVK.hpp"
 #include "FenceVK.hpp"
+#include "IndirectCommandLayoutVK.hpp"
+#include "IndirectExecutionSetVK.hpp"
 #include "MemoryVK.hpp"
 #include "MicromapVK.hpp"
 #include "PipelineLayoutVK.hpp"
@@ -177,7 +183,13 @@ static void NRI_CALL DestroyCommandAllocator(CommandAllocator& commandAllocator)
 }
 
 static void NRI_CALL DestroyCommandBuffer(CommandBuffer& commandBuffer) {
-    Destroy((CommandBufferVK*)&commandBuffer);
+    CommandBufferVK& commandBufferVK = (CommandBufferVK&)commandBuffer;
+
+    CommandAllocatorVK* commandAllocator = commandBufferVK.GetCommandAllocator();
+    if (commandAllocator)
+        commandAllocator->ReleaseCommandBuffer(commandBufferVK);
+    else
+        Destroy(&commandBufferVK);
 }
 
 static void NRI_CALL DestroyDescriptorPool(DescriptorPool& descriptorPool) {
@@ -232,6 +244,10 @@ static Result NRI_CALL BeginCommandBuffer(CommandBuffer& commandBuffer, const De
     return ((CommandBufferVK&)commandBuffer).Begin(descriptorPool);
 }
 
+static Result NRI_CALL BeginReusableCommandBuffer(CommandBuffer& commandBuffer, const DescriptorPool* descriptorPool) {
+    return ((CommandBufferVK&)commandBuffer).Begin(descriptorPool, true);
+}
+
 static void NRI_CALL CmdSetDescriptorPool(CommandBuffer& commandBuffer, const DescriptorPool& descriptorPool) {
     ((CommandBufferVK&)commandBuffer).SetDescriptorPool(descriptorPool);
 }
@@ -316,6 +332,14 @@ static void NRI_CALL CmdDrawIndexed(CommandBuffer& commandBuffer, const DrawInde
     ((CommandBufferVK&)commandBuffer).DrawIndexed(drawIndexedDesc);
 }
 
+static void NRI_CALL CmdDrawMulti(CommandBuffer& commandBuffer, const DrawDesc* drawDescs, uint32_t drawNum) {
+    ((CommandBufferVK&)commandBuffer).DrawMulti(drawDescs, drawNum);
+}
+
+static void NRI_CALL CmdDrawIndexedMulti(CommandBuffer& commandBuffer, const DrawIndexedDesc* drawIndexedDescs, uint32_t drawNum) {
+    ((CommandBufferVK&)commandBuffer).DrawIndexedMulti(drawIndexedDescs, drawNum);
+}
+
 static void NRI_CALL CmdDrawIndirect(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
     ((CommandBufferVK&)commandBuffer).DrawIndirect(buffer, offset, drawNum, stride, countBuffer, countBufferOffset);
 }
@@ -352,10 +376,30 @@ static void NRI_CALL CmdReadbackTextureToBuffer(CommandBuffer& commandBuffer, Bu
     ((CommandBufferVK&)commandBuffer).ReadbackTextureToBuffer(dstBuffer, dstDataLayout, srcTexture, srcRegion);
 }
 
+static void NRI_CALL CmdCopyBufferMulti(CommandBuffer& commandBuffer, Buffer& dstBuffer, const Buffer& srcBuffer, const BufferCopyRegionDesc* regions, uint32_t regionNum) {
+    ((CommandBufferVK&)commandBuffer).CopyBufferMulti(dstBuffer, srcBuffer, regions, regionNum);
+}
+
+static void NRI_CALL CmdCopyTextureMulti(CommandBuffer& commandBuffer, Texture& dstTexture, const Texture& srcTexture, const TextureCopyRegionDesc* regions, uint32_t regionNum) {
+    ((CommandBufferVK&)commandBuffer).CopyTextureMulti(dstTexture, srcTexture, regions, regionNum);
+}
+
+static void NRI_CALL CmdUploadBufferToTextureMulti(CommandBuffer& commandBuffer, Texture& dstTexture, const Buffer& srcBuffer, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum) {
+    ((CommandBufferVK&)commandBuffer).UploadBufferToTextureMulti(dstTexture, srcBuffer, regions, regionNum);
+}
+
+static void NRI_CALL CmdReadbackTextureToBufferMulti(CommandBuffer& commandBuffer, Buffer& dstBuffer, const Texture& srcTexture, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum) {
+    ((CommandBufferVK&)commandBuffer).ReadbackTextureToBufferMulti(dstBuffer, srcTexture, regions, regionNum);
+}
+
 static void NRI_CALL CmdZeroBuffer(CommandBuffer& commandBuffer, Buffer& buffer, uint64_t offset, uint64_t size) {
     ((CommandBufferVK&)commandBuffer).ZeroBuffer(buffer, offset, size);
 }
 
+static void NRI_CALL CmdUpdateBuffer(CommandBuffer& commandBuffer, Buffer& buffer, uint64_t offset, const void* data, uint32_t size) {
+    ((CommandBufferVK&)commandBuffer).UpdateBuffer(buffer, offset, data, size);
+}
+
 static void NRI_CALL CmdResolveTexture(CommandBuffer& commandBuffer, Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion) {
     ((CommandBufferVK&)commandBuffer).ResolveTexture(dstTexture, dstRegion, srcTexture, srcRegion);
 }
@@ -434,6 +478,10 @@ static Result NRI_CALL QueueSubmit(Queue& queue, const QueueSubmitDesc& workSubm
     return ((QueueVK&)queue).Submit(workSubmissionDesc, nullptr);
 }
 
+static Result NRI_CALL QueueSubmitMulti(Queue& queue, const QueueSubmitDesc* queueSubmitDescs, uint32_t queueSubmitDescNum) {
+    return ((QueueVK&)queue).SubmitMulti(queueSubmitDescs, queueSubmitDescNum, nullptr);
+}
+
 static Result NRI_CALL DeviceWaitIdle(Device& device) {
     if (!(&device))
         return Result::SUCCESS;
@@ -452,6 +500,14 @@ static void NRI_CALL Wait(Fence& fence, uint64_t value) {
     ((FenceVK&)fence).Wait(value);
 }
 
+static void NRI_CALL Signal(Fence& fence, uint64_t value) {
+    ((FenceVK&)fence).Signal(value);
+}
+
+static Result NRI_CALL WaitMulti(Device& device, const FenceWaitDesc* fenceWaitDescs, uint32_t fenceWaitDescNum, bool waitAny, uint32_t timeout) {
+    return ((DeviceVK&)device).WaitMulti(fenceWaitDescs, fenceWaitDescNum, waitAny, timeout);
+}
+
 static void NRI_CALL UpdateDescriptorRanges(DescriptorSet& descriptorSet, uint32_t baseRange, uint32_t rangeNum, const DescriptorRangeUpdateDesc* rangeUpdateDescs) {
     ((DescriptorSetVK&)descriptorSet).UpdateDescriptorRanges(baseRange, rangeNum, rangeUpdateDescs);
 }
@@ -587,6 +643,7 @@ Result DeviceVK::FillFunctionTable(CoreInterface& table) const {
     table.BindTextureMemory = ::BindTextureMemory;
     table.FreeMemory = ::FreeMemory;
     table.BeginCommandBuffer = ::BeginCommandBuffer;
+    table.BeginReusableCommandBuffer = ::BeginReusableCommandBuffer;
     table.CmdSetDescriptorPool = ::CmdSetDescriptorPool;
     table.CmdSetDescriptorSet = ::CmdSetDescriptorSet;
     table.CmdSetPipelineLayout = ::CmdSetPipelineLayout;
@@ -608,6 +665,8 @@ Result DeviceVK::FillFunctionTable(CoreInterface& table) const {
     table.CmdClearAttachments = ::CmdClearAttachments;
     table.CmdDraw = ::CmdDraw;
     table.CmdDrawIndexed = ::CmdDrawIndexed;
+    table.CmdDrawMulti = ::CmdDrawMulti;
+    table.CmdDrawIndexedMulti = ::CmdDrawIndexedMulti;
     table.CmdDrawIndirect = ::CmdDrawIndirect;
     table.CmdDrawIndexedIndirect = ::CmdDrawIndexedIndirect;
     table.CmdEndRendering = ::CmdEndRendering;
@@ -618,6 +677,11 @@ Result DeviceVK::FillFunctionTable(CoreInterface& table) const {
     table.CmdUploadBufferToTexture = ::CmdUploadBufferToTexture;
     table.CmdReadbackTextureToBuffer = ::CmdReadbackTextureToBuffer;
     table.CmdZeroBuffer = ::CmdZeroBuffer;
+    table.CmdUpdateBuffer = ::CmdUpdateBuffer;
+    table.CmdCopyBufferMulti = ::CmdCopyBufferMulti;
+    table.CmdCopyTextureMulti = ::CmdCopyTextureMulti;
+    table.CmdUploadBufferToTextureMulti = ::CmdUploadBufferToTextureMulti;
+    table.CmdReadbackTextureToBufferMulti = ::CmdReadbackTextureToBufferMulti;
     table.CmdResolveTexture = ::CmdResolveTexture;
     table.CmdClearStorage = ::CmdClearStorage;
     table.CmdResetQueries = ::CmdResetQueries;
@@ -635,7 +699,10 @@ Result DeviceVK::FillFunctionTable(CoreInterface& table) const {
     table.DeviceWaitIdle = ::DeviceWaitIdle;
     table.QueueWaitIdle = ::QueueWaitIdle;
     table.QueueSubmit = ::QueueSubmit;
+    table.QueueSubmitMulti = ::QueueSubmitMulti;
     table.Wait = ::Wait;
+    table.WaitMulti = ::WaitMulti;
+    table.Signal = ::Signal;
     table.GetFenceValue = ::GetFenceValue;
     table.UpdateDescriptorRanges = ::UpdateDescriptorRanges;
     table.UpdateDynamicConstantBuffers = ::UpdateDynamicConstantBuffers;
@@ -658,6 +725,112 @@ Result DeviceVK::FillFunctionTable(CoreInterface& table) const {
 
 #pragma endregion
 
+//============================================================================================================================================================================================
+#pragma region[  CommandBufferStats  ]
+
+static void NRI_CALL GetCommandBufferStats(const CommandBuffer& commandBuffer, CommandBufferStats& commandBufferStats) {
+    commandBufferStats = ((CommandBufferVK&)commandBuffer).GetStats();
+}
+
+Result DeviceVK::FillFunctionTable(CommandBufferStatsInterface& table) const {
+    if (!m_IsCommandBufferStatsEnabled)
+        return Result::UNSUPPORTED;
+
+    table.GetCommandBufferStats = ::GetCommandBufferStats;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  ConditionalRendering  ]
+
+static void NRI_CALL CmdBeginConditionalRendering(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset, bool inverted) {
+    ((CommandBufferVK&)commandBuffer).BeginConditionalRendering(buffer, offset, inverted);
+}
+
+static void NRI_CALL CmdEndConditionalRendering(CommandBuffer& commandBuffer) {
+    ((CommandBufferVK&)commandBuffer).EndConditionalRendering();
+}
+
+Result DeviceVK::FillFunctionTable(ConditionalRenderingInterface& table) const {
+    if (!m_IsSupported.conditionalRendering)
+        return Result::UNSUPPORTED;
+
+    table.CmdBeginConditionalRendering = ::CmdBeginConditionalRendering;
+    table.CmdEndConditionalRendering = ::CmdEndConditionalRendering;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  DeviceGeneratedCommands  ]
+
+static Result NRI_CALL CreateIndirectCommandLayout(Device& device, const IndirectCommandLayoutDesc& indirectCommandLayoutDesc, IndirectCommandLayout*& indirectCommandLayout) {
+    return ((DeviceVK&)device).CreateImplementation<IndirectCommandLayoutVK>(indirectCommandLayout, indirectCommandLayoutDesc);
+}
+
+static Result NRI_CALL CreateIndirectExecutionSet(Device& device, const IndirectExecutionSetDesc& indirectExecutionSetDesc, IndirectExecutionSet*& indirectExecutionSet) {
+    return ((DeviceVK&)device).CreateImplementation<IndirectExecutionSetVK>(indirectExecutionSet, indirectExecutionSetDesc);
+}
+
+static uint64_t NRI_CALL GetGeneratedCommandsPreprocessBufferSize(const IndirectCommandLayout& indirectCommandLayout, const IndirectExecutionSet* indirectExecutionSet, uint32_t sequenceMaxNum) {
+    return ((IndirectCommandLayoutVK&)indirectCommandLayout).GetPreprocessBufferSize(indirectExecutionSet, sequenceMaxNum);
+}
+
+static void NRI_CALL DestroyIndirectCommandLayout(IndirectCommandLayout& indirectCommandLayout) {
+    Destroy((IndirectCommandLayoutVK*)&indirectCommandLayout);
+}
+
+static void NRI_CALL DestroyIndirectExecutionSet(IndirectExecutionSet& indirectExecutionSet) {
+    Destroy((IndirectExecutionSetVK*)&indirectExecutionSet);
+}
+
+static void NRI_CALL UpdateIndirectExecutionSet(IndirectExecutionSet& indirectExecutionSet, uint32_t basePipelineIndex, const Pipeline* const* pipelines, uint32_t pipelineNum) {
+    ((IndirectExecutionSetVK&)indirectExecutionSet).Update(basePipelineIndex, pipelines, pipelineNum);
+}
+
+static void NRI_CALL CmdExecuteGeneratedCommands(CommandBuffer& commandBuffer, const GeneratedCommandsDesc& generatedCommandsDesc) {
+    ((CommandBufferVK&)commandBuffer).ExecuteGeneratedCommands(generatedCommandsDesc);
+}
+
+Result DeviceVK::FillFunctionTable(DeviceGeneratedCommandsInterface& table) const {
+    if (!m_IsSupported.deviceGeneratedCommands)
+        return Result::UNSUPPORTED;
+
+    table.CreateIndirectCommandLayout = ::CreateIndirectCommandLayout;
+    table.CreateIndirectExecutionSet = ::CreateIndirectExecutionSet;
+    table.GetGeneratedCommandsPreprocessBufferSize = ::GetGeneratedCommandsPreprocessBufferSize;
+    table.DestroyIndirectCommandLayout = ::DestroyIndirectCommandLayout;
+    table.DestroyIndirectExecutionSet = ::DestroyIndirectExecutionSet;
+    table.UpdateIndirectExecutionSet = ::UpdateIndirectExecutionSet;
+    table.CmdExecuteGeneratedCommands = ::CmdExecuteGeneratedCommands;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  FenceCallback  ]
+
+static Result NRI_CALL RegisterFenceCallback(Fence& fence, uint64_t value, const FenceCallbackDesc& fenceCallbackDesc) {
+    FenceVK& fenceVK = (FenceVK&)fence;
+
+    return fenceVK.GetDevice().RegisterFenceCallback(fenceVK, value, fenceCallbackDesc);
+}
+
+Result DeviceVK::FillFunctionTable(FenceCallbackInterface& table) const {
+    table.RegisterFenceCallback = ::RegisterFenceCallback;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
 //============================================================================================================================================================================================
 #pragma region[  Helper  ]
 
@@ -687,11 +860,72 @@ static Result NRI_CALL QueryVideoMemoryInfo(const Device& device, MemoryLocation
     return ((DeviceVK&)device).QueryVideoMemoryInfo(memoryLocation, videoMemoryInfo);
 }
 
+static void NRI_CALL DestroyDeferred(Device& device, const DeferredDestroyDesc* deferredDestroyDescs, uint32_t deferredDestroyDescNum) {
+    DeviceVK& deviceVK = (DeviceVK&)device;
+    HelperDeferredDestroyer deferredDestroyer(deviceVK.GetCoreInterface(), device);
+
+    deferredDestroyer.DestroyDeferred(deferredDestroyDescs, deferredDestroyDescNum);
+}
+
+static void NRI_CALL ProcessDeferredDestroys(Device& device, bool all) {
+    DeviceVK& deviceVK = (DeviceVK&)device;
+    HelperDeferredDestroyer deferredDestroyer(deviceVK.GetCoreInterface(), device);
+
+    deferredDestroyer.ProcessDeferredDestroys(all);
+}
+
+static Result NRI_CALL CreateFrameContext(Device& device, const FrameContextDesc& frameContextDesc, FrameContext*& frameContext) {
+    DeviceVK& deviceVK = (DeviceVK&)device;
+    FrameContextImpl* impl = Allocate<FrameContextImpl>(deviceVK.GetAllocationCallbacks(), device, deviceVK.GetCoreInterface());
+    Result result = impl->Create(frameContextDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        frameContext = nullptr;
+    } else
+        frameContext = (FrameContext*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyFrameContext(FrameContext& frameContext) {
+    Destroy((FrameContextImpl*)&frameContext);
+}
+
+static uint32_t NRI_CALL BeginFrameContext(FrameContext& frameContext) {
+    return ((FrameContextImpl&)frameContext).BeginFrame();
+}
+
+static Result NRI_CALL EndFrameContext(FrameContext& frameContext) {
+    return ((FrameContextImpl&)frameContext).EndFrame();
+}
+
+static CommandAllocator* NRI_CALL GetFrameCommandAllocator(const FrameContext& frameContext, uint32_t threadIndex) {
+    return ((FrameContextImpl&)frameContext).GetCommandAllocator(threadIndex);
+}
+
+static CommandBuffer* NRI_CALL GetFrameCommandBuffer(const FrameContext& frameContext, uint32_t threadIndex, uint32_t commandBufferIndex) {
+    return ((FrameContextImpl&)frameContext).GetCommandBuffer(threadIndex, commandBufferIndex);
+}
+
+static DescriptorPool* NRI_CALL GetFrameDescriptorPool(const FrameContext& frameContext, uint32_t threadIndex) {
+    return ((FrameContextImpl&)frameContext).GetDescriptorPool(threadIndex);
+}
+
 Result DeviceVK::FillFunctionTable(HelperInterface& table) const {
     table.CalculateAllocationNumber = ::CalculateAllocationNumber;
     table.AllocateAndBindMemory = ::AllocateAndBindMemory;
     table.UploadData = ::UploadData;
     table.QueryVideoMemoryInfo = ::QueryVideoMemoryInfo;
+    table.DestroyDeferred = ::DestroyDeferred;
+    table.ProcessDeferredDestroys = ::ProcessDeferredDestroys;
+    table.CreateFrameContext = ::CreateFrameContext;
+    table.DestroyFrameContext = ::DestroyFrameContext;
+    table.BeginFrameContext = ::BeginFrameContext;
+    table.EndFrameContext = ::EndFrameContext;
+    table.GetFrameCommandAllocator = ::GetFrameCommandAllocator;
+    table.GetFrameCommandBuffer = ::GetFrameCommandBuffer;
+    table.GetFrameDescriptorPool = ::GetFrameDescriptorPool;
 
     return Result::SUCCESS;
 }
@@ -807,6 +1041,66 @@ Result DeviceVK::FillFunctionTable(MeshShaderInterface& table) const {
 
 #pragma endregion
 
+//============================================================================================================================================================================================
+#pragma region[  QueueScheduler  ]
+
+static Result NRI_CALL CreateQueueScheduler(Device& device, QueueScheduler*& queueScheduler) {
+    DeviceVK& deviceVK = (DeviceVK&)device;
+    QueueSchedulerImpl* impl = Allocate<QueueSchedulerImpl>(deviceVK.GetAllocationCallbacks(), device, deviceVK.GetCoreInterface());
+    Result result = impl->Create();
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        queueScheduler = nullptr;
+    } else
+        queueScheduler = (QueueScheduler*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyQueueScheduler(QueueScheduler& queueScheduler) {
+    Destroy((QueueSchedulerImpl*)&queueScheduler);
+}
+
+static Queue* NRI_CALL GetQueueSchedulerQueue(const QueueScheduler& queueScheduler, QueueType queueType) {
+    return ((QueueSchedulerImpl&)queueScheduler).GetQueue(queueType);
+}
+
+static Result NRI_CALL SubmitSchedule(QueueScheduler& queueScheduler, const ScheduleDesc& scheduleDesc) {
+    return ((QueueSchedulerImpl&)queueScheduler).Submit(scheduleDesc);
+}
+
+Result DeviceVK::FillFunctionTable(QueueSchedulerInterface& table) const {
+    table.CreateQueueScheduler = ::CreateQueueScheduler;
+    table.DestroyQueueScheduler = ::DestroyQueueScheduler;
+    table.GetQueueSchedulerQueue = ::GetQueueSchedulerQueue;
+    table.SubmitSchedule = ::SubmitSchedule;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  QueueTimeline  ]
+
+static uint64_t NRI_CALL GetQueueSubmissionId(const Queue& queue) {
+    return ((QueueVK&)queue).GetSubmissionId();
+}
+
+static uint64_t NRI_CALL GetQueueCompletedSubmissionId(const Queue& queue) {
+    return ((QueueVK&)queue).GetCompletedSubmissionId();
+}
+
+Result DeviceVK::FillFunctionTable(QueueTimelineInterface& table) const {
+    table.GetQueueSubmissionId = ::GetQueueSubmissionId;
+    table.GetQueueCompletedSubmissionId = ::GetQueueCompletedSubmissionId;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
 //============================================================================================================================================================================================
 #pragma region[  RayTracing  ]
 
@@ -971,6 +1265,54 @@ Result DeviceVK::FillFunctionTable(RayTracingInterface& table) const {
 
 #pragma endregion
 
+//============================================================================================================================================================================================
+#pragma region[  RenderGraph  ]
+
+static Result NRI_CALL CreateRenderGraph(Device& device, RenderGraph*& renderGraph) {
+    DeviceVK& deviceVK = (DeviceVK&)device;
+    renderGraph = (RenderGraph*)Allocate<RenderGraphImpl>(deviceVK.GetAllocationCallbacks(), device, deviceVK.GetCoreInterface());
+
+    return Result::SUCCESS;
+}
+
+static void NRI_CALL DestroyRenderGraph(RenderGraph& renderGraph) {
+    Destroy((RenderGraphImpl*)&renderGraph);
+}
+
+static Result NRI_CALL CompileRenderGraph(RenderGraph& renderGraph, const RenderGraphDesc& renderGraphDesc) {
+    return ((RenderGraphImpl&)renderGraph).Compile(renderGraphDesc);
+}
+
+static Texture* NRI_CALL GetRenderGraphTexture(const RenderGraph& renderGraph, uint32_t resourceIndex) {
+    return ((RenderGraphImpl&)renderGraph).GetTexture(resourceIndex);
+}
+
+static Buffer* NRI_CALL GetRenderGraphBuffer(const RenderGraph& renderGraph, uint32_t resourceIndex) {
+    return ((RenderGraphImpl&)renderGraph).GetBuffer(resourceIndex);
+}
+
+static void NRI_CALL GetRenderGraphStats(const RenderGraph& renderGraph, RenderGraphStats& renderGraphStats) {
+    ((RenderGraphImpl&)renderGraph).GetStats(renderGraphStats);
+}
+
+static void NRI_CALL CmdExecuteRenderGraph(CommandBuffer& commandBuffer, const RenderGraph& renderGraph) {
+    ((RenderGraphImpl&)renderGraph).CmdExecute(commandBuffer);
+}
+
+Result DeviceVK::FillFunctionTable(RenderGraphInterface& table) const {
+    table.CreateRenderGraph = ::CreateRenderGraph;
+    table.DestroyRenderGraph = ::DestroyRenderGraph;
+    table.CompileRenderGraph = ::CompileRenderGraph;
+    table.GetRenderGraphTexture = ::GetRenderGraphTexture;
+    table.GetRenderGraphBuffer = ::GetRenderGraphBuffer;
+    table.GetRenderGraphStats = ::GetRenderGraphStats;
+    table.CmdExecuteRenderGraph = ::CmdExecuteRenderGraph;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
 //============================================================================================================================================================================================
 #pragma region[  ResourceAllocator  ]
 
@@ -1001,6 +1343,56 @@ Result DeviceVK::FillFunctionTable(ResourceAllocatorInterface& table) const {
 
 #pragma endregion
 
+//============================================================================================================================================================================================
+#pragma region[  SecondaryCommandBuffer  ]
+
+static Result NRI_CALL CreateSecondaryCommandBuffer(CommandAllocator& commandAllocator, CommandBuffer*& commandBuffer) {
+    return ((CommandAllocatorVK&)commandAllocator).CreateCommandBuffer(commandBuffer, VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+}
+
+static Result NRI_CALL BeginSecondaryCommandBuffer(CommandBuffer& commandBuffer, const AttachmentsDesc* attachmentsDesc, const DescriptorPool* descriptorPool) {
+    return ((CommandBufferVK&)commandBuffer).BeginSecondary(attachmentsDesc, descriptorPool);
+}
+
+static void NRI_CALL CmdBeginRenderingSecondary(CommandBuffer& commandBuffer, const AttachmentsDesc& attachmentsDesc) {
+    ((CommandBufferVK&)commandBuffer).BeginRendering(attachmentsDesc, VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT);
+}
+
+static void NRI_CALL CmdExecuteCommands(CommandBuffer& commandBuffer, const CommandBuffer* const* secondaryCommandBuffers, uint32_t secondaryCommandBufferNum) {
+    ((CommandBufferVK&)commandBuffer).ExecuteCommands(secondaryCommandBuffers, secondaryCommandBufferNum);
+}
+
+Result DeviceVK::FillFunctionTable(SecondaryCommandBufferInterface& table) const {
+    table.CreateSecondaryCommandBuffer = ::CreateSecondaryCommandBuffer;
+    table.BeginSecondaryCommandBuffer = ::BeginSecondaryCommandBuffer;
+    table.CmdBeginRenderingSecondary = ::CmdBeginRenderingSecondary;
+    table.CmdExecuteCommands = ::CmdExecuteCommands;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  SplitBarrier  ]
+
+static uint32_t NRI_CALL CmdBeginBarrier(CommandBuffer& commandBuffer, const BarrierGroupDesc& barrierGroupDesc) {
+    return ((CommandBufferVK&)commandBuffer).BeginBarrier(barrierGroupDesc);
+}
+
+static void NRI_CALL CmdEndBarrier(CommandBuffer& commandBuffer, const BarrierGroupDesc& barrierGroupDesc, uint32_t splitBarrierIndex) {
+    ((CommandBufferVK&)commandBuffer).EndBarrier(barrierGroupDesc, splitBarrierIndex);
+}
+
+Result DeviceVK::FillFunctionTable(SplitBarrierInterface& table) const {
+    table.CmdBeginBarrier = ::CmdBeginBarrier;
+    table.CmdEndBarrier = ::CmdEndBarrier;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
 //============================================================================================================================================================================================
 #pragma region[  Streamer  ]
 
@@ -1244,3 +1636,242 @@ Result DeviceVK::FillFunctionTable(WrapperVKInterface& table) const {
 }
 
 #pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  Direct  ]
+
+#if NRI_ENABLE_DIRECT_CALLS
+
+#    include "NRIDirect.h"
+
+uint64_t nri::direct::GetFenceValue(Fence& fence) {
+    return ::GetFenceValue(fence);
+}
+
+void nri::direct::Signal(Fence& fence, uint64_t value) {
+    ::Signal(fence, value);
+}
+
+void nri::direct::UpdateDescriptorRanges(DescriptorSet& descriptorSet, uint32_t baseRange, uint32_t rangeNum, const DescriptorRangeUpdateDesc* rangeUpdateDescs) {
+    ::UpdateDescriptorRanges(descriptorSet, baseRange, rangeNum, rangeUpdateDescs);
+}
+
+void nri::direct::UpdateDynamicConstantBuffers(DescriptorSet& descriptorSet, uint32_t baseDynamicConstantBuffer, uint32_t dynamicConstantBufferNum, const Descriptor* const* descriptors) {
+    ::UpdateDynamicConstantBuffers(descriptorSet, baseDynamicConstantBuffer, dynamicConstantBufferNum, descriptors);
+}
+
+Result nri::direct::BeginCommandBuffer(CommandBuffer& commandBuffer, const DescriptorPool* descriptorPool) {
+    return ::BeginCommandBuffer(commandBuffer, descriptorPool);
+}
+
+void nri::direct::CmdSetDescriptorPool(CommandBuffer& commandBuffer, const DescriptorPool& descriptorPool) {
+    ::CmdSetDescriptorPool(commandBuffer, descriptorPool);
+}
+
+void nri::direct::CmdSetPipelineLayout(CommandBuffer& commandBuffer, const PipelineLayout& pipelineLayout) {
+    ::CmdSetPipelineLayout(commandBuffer, pipelineLayout);
+}
+
+void nri::direct::CmdSetPipeline(CommandBuffer& commandBuffer, const Pipeline& pipeline) {
+    ::CmdSetPipeline(commandBuffer, pipeline);
+}
+
+void nri::direct::CmdSetDescriptorSet(CommandBuffer& commandBuffer, uint32_t setIndex, const DescriptorSet& descriptorSet, const uint32_t* dynamicConstantBufferOffsets) {
+    ::CmdSetDescriptorSet(commandBuffer, setIndex, descriptorSet, dynamicConstantBufferOffsets);
+}
+
+void nri::direct::CmdSetRootConstants(CommandBuffer& commandBuffer, uint32_t rootConstantIndex, const void* data, uint32_t size) {
+    ::CmdSetRootConstants(commandBuffer, rootConstantIndex, data, size);
+}
+
+void nri::direct::CmdSetRootDescriptor(CommandBuffer& commandBuffer, uint32_t rootDescriptorIndex, Descriptor& descriptor) {
+    ::CmdSetRootDescriptor(commandBuffer, rootDescriptorIndex, descriptor);
+}
+
+void nri::direct::CmdBarrier(CommandBuffer& commandBuffer, const BarrierGroupDesc& barrierGroupDesc) {
+    ::CmdBarrier(commandBuffer, barrierGroupDesc);
+}
+
+void nri::direct::CmdSetIndexBuffer(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset, IndexType indexType) {
+    ::CmdSetIndexBuffer(commandBuffer, buffer, offset, indexType);
+}
+
+void nri::direct::CmdSetVertexBuffers(CommandBuffer& commandBuffer, uint32_t baseSlot, const VertexBufferDesc* vertexBufferDescs, uint32_t vertexBufferNum) {
+    ::CmdSetVertexBuffers(commandBuffer, baseSlot, vertexBufferDescs, vertexBufferNum);
+}
+
+void nri::direct::CmdSetViewports(CommandBuffer& commandBuffer, const Viewport* viewports, uint32_t viewportNum) {
+    ::CmdSetViewports(commandBuffer, viewports, viewportNum);
+}
+
+void nri::direct::CmdSetScissors(CommandBuffer& commandBuffer, const Rect* rects, uint32_t rectNum) {
+    ::CmdSetScissors(commandBuffer, rects, rectNum);
+}
+
+void nri::direct::CmdSetStencilReference(CommandBuffer& commandBuffer, uint8_t frontRef, uint8_t backRef) {
+    ::CmdSetStencilReference(commandBuffer, frontRef, backRef);
+}
+
+void nri::direct::CmdSetDepthBounds(CommandBuffer& commandBuffer, float boundsMin, float boundsMax) {
+    ::CmdSetDepthBounds(commandBuffer, boundsMin, boundsMax);
+}
+
+void nri::direct::CmdSetBlendConstants(CommandBuffer& commandBuffer, const Color32f& color) {
+    ::CmdSetBlendConstants(commandBuffer, color);
+}
+
+void nri::direct::CmdSetSampleLocations(CommandBuffer& commandBuffer, const SampleLocation* locations, Sample_t locationNum, Sample_t sampleNum) {
+    ::CmdSetSampleLocations(commandBuffer, locations, locationNum, sampleNum);
+}
+
+void nri::direct::CmdSetShadingRate(CommandBuffer& commandBuffer, const ShadingRateDesc& shadingRateDesc) {
+    ::CmdSetShadingRate(commandBuffer, shadingRateDesc);
+}
+
+void nri::direct::CmdSetDepthBias(CommandBuffer& commandBuffer, const DepthBiasDesc& depthBiasDesc) {
+    ::CmdSetDepthBias(commandBuffer, depthBiasDesc);
+}
+
+void nri::direct::CmdBeginRendering(CommandBuffer& commandBuffer, const AttachmentsDesc& attachmentsDesc) {
+    ::CmdBeginRendering(commandBuffer, attachmentsDesc);
+}
+
+void nri::direct::CmdClearAttachments(CommandBuffer& commandBuffer, const ClearDesc* clearDescs, uint32_t clearDescNum, const Rect* rects, uint32_t rectNum) {
+    ::CmdClearAttachments(commandBuffer, clearDescs, clearDescNum, rects, rectNum);
+}
+
+void nri::direct::CmdDraw(CommandBuffer& commandBuffer, const DrawDesc& drawDesc) {
+    ::CmdDraw(commandBuffer, drawDesc);
+}
+
+void nri::direct::CmdDrawIndexed(CommandBuffer& commandBuffer, const DrawIndexedDesc& drawIndexedDesc) {
+    ::CmdDrawIndexed(commandBuffer, drawIndexedDesc);
+}
+
+void nri::direct::CmdDrawMulti(CommandBuffer& commandBuffer, const DrawDesc* drawDescs, uint32_t drawNum) {
+    ::CmdDrawMulti(commandBuffer, drawDescs, drawNum);
+}
+
+void nri::direct::CmdDrawIndexedMulti(CommandBuffer& commandBuffer, const DrawIndexedDesc* drawIndexedDescs, uint32_t drawNum) {
+    ::CmdDrawIndexedMulti(commandBuffer, drawIndexedDescs, drawNum);
+}
+
+void nri::direct::CmdDrawIndirect(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
+    ::CmdDrawIndirect(commandBuffer, buffer, offset, drawNum, stride, countBuffer, countBufferOffset);
+}
+
+void nri::direct::CmdDrawIndexedIndirect(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
+    ::CmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawNum, stride, countBuffer, countBufferOffset);
+}
+
+void nri::direct::CmdEndRendering(CommandBuffer& commandBuffer) {
+    ::CmdEndRendering(commandBuffer);
+}
+
+void nri::direct::CmdDispatch(CommandBuffer& commandBuffer, const DispatchDesc& dispatchDesc) {
+    ::CmdDispatch(commandBuffer, dispatchDesc);
+}
+
+void nri::direct::CmdDispatchIndirect(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset) {
+    ::CmdDispatchIndirect(commandBuffer, buffer, offset);
+}
+
+void nri::direct::CmdCopyBuffer(CommandBuffer& commandBuffer, Buffer& dstBuffer, uint64_t dstOffset, const Buffer& srcBuffer, uint64_t srcOffset, uint64_t size) {
+    ::CmdCopyBuffer(commandBuffer, dstBuffer, dstOffset, srcBuffer, srcOffset, size);
+}
+
+void nri::direct::CmdCopyTexture(CommandBuffer& commandBuffer, Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion) {
+    ::CmdCopyTexture(commandBuffer, dstTexture, dstRegion, srcTexture, srcRegion);
+}
+
+void nri::direct::CmdUploadBufferToTexture(CommandBuffer& commandBuffer, Texture& dstTexture, const TextureRegionDesc& dstRegion, const Buffer& srcBuffer, const TextureDataLayoutDesc& srcDataLayout) {
+    ::CmdUploadBufferToTexture(commandBuffer, dstTexture, dstRegion, srcBuffer, srcDataLayout);
+}
+
+void nri::direct::CmdReadbackTextureToBuffer(CommandBuffer& commandBuffer, Buffer& dstBuffer, const TextureDataLayoutDesc& dstDataLayout, const Texture& srcTexture, const TextureRegionDesc& srcRegion) {
+    ::CmdReadbackTextureToBuffer(commandBuffer, dstBuffer, dstDataLayout, srcTexture, srcRegion);
+}
+
+void nri::direct::CmdZeroBuffer(CommandBuffer& commandBuffer, Buffer& buffer, uint64_t offset, uint64_t size) {
+    ::CmdZeroBuffer(commandBuffer, buffer, offset, size);
+}
+
+void nri::direct::CmdUpdateBuffer(CommandBuffer& commandBuffer, Buffer& buffer, uint64_t offset, const void* data, uint32_t size) {
+    ::CmdUpdateBuffer(commandBuffer, buffer, offset, data, size);
+}
+
+void nri::direct::CmdCopyBufferMulti(CommandBuffer& commandBuffer, Buffer& dstBuffer, const Buffer& srcBuffer, const BufferCopyRegionDesc* regions, uint32_t regionNum) {
+    ::CmdCopyBufferMulti(commandBuffer, dstBuffer, srcBuffer, regions, regionNum);
+}
+
+void nri::direct::CmdCopyTextureMulti(CommandBuffer& commandBuffer, Texture& dstTexture, const Texture& srcTexture, const TextureCopyRegionDesc* regions, uint32_t regionNum) {
+    ::CmdCopyTextureMulti(commandBuffer, dstTexture, srcTexture, regions, regionNum);
+}
+
+void nri::direct::CmdUploadBufferToTextureMulti(CommandBuffer& commandBuffer, Texture& dstTexture, const Buffer& srcBuffer, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum) {
+    ::CmdUploadBufferToTextureMulti(commandBuffer, dstTexture, srcBuffer, regions, regionNum);
+}
+
+void nri::direct::CmdReadbackTextureToBufferMulti(CommandBuffer& commandBuffer, Buffer& dstBuffer, const Texture& srcTexture, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum) {
+    ::CmdReadbackTextureToBufferMulti(commandBuffer, dstBuffer, srcTexture, regions, regionNum);
+}
+
+void nri::direct::CmdResolveTexture(CommandBuffer& commandBuffer, Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion) {
+    ::CmdResolveTexture(commandBuffer, dstTexture, dstRegion, srcTexture, srcRegion);
+}
+
+void nri::direct::CmdClearStorage(CommandBuffer& commandBuffer, const ClearStorageDesc& clearDesc) {
+    ::CmdClearStorage(commandBuffer, clearDesc);
+}
+
+void nri::direct::CmdResetQueries(CommandBuffer& commandBuffer, QueryPool& queryPool, uint32_t offset, uint32_t num) {
+    ::CmdResetQueries(commandBuffer, queryPool, offset, num);
+}
+
+void nri::direct::CmdBeginQuery(CommandBuffer& commandBuffer, QueryPool& queryPool, uint32_t offset) {
+    ::CmdBeginQuery(commandBuffer, queryPool, offset);
+}
+
+void nri::direct::CmdEndQuery(CommandBuffer& commandBuffer, QueryPool& queryPool, uint32_t offset) {
+    ::CmdEndQuery(commandBuffer, queryPool, offset);
+}
+
+void nri::direct::CmdCopyQueries(CommandBuffer& commandBuffer, const QueryPool& queryPool, uint32_t offset, uint32_t num, Buffer& dstBuffer, uint64_t dstOffset) {
+    ::CmdCopyQueries(commandBuffer, queryPool, offset, num, dstBuffer, dstOffset);
+}
+
+void nri::direct::CmdBeginAnnotation(CommandBuffer& commandBuffer, const char* name, uint32_t bgra) {
+    ::CmdBeginAnnotation(commandBuffer, name, bgra);
+}
+
+void nri::direct::CmdEndAnnotation(CommandBuffer& commandBuffer) {
+    ::CmdEndAnnotation(commandBuffer);
+}
+
+void nri::direct::CmdAnnotation(CommandBuffer& commandBuffer, const char* name, uint32_t bgra) {
+    ::CmdAnnotation(commandBuffer, name, bgra);
+}
+
+Result nri::direct::EndCommandBuffer(CommandBuffer& commandBuffer) {
+    return ::EndCommandBuffer(commandBuffer);
+}
+
+Result nri::direct::QueueSubmit(Queue& queue, const QueueSubmitDesc& queueSubmitDesc) {
+    return ::QueueSubmit(queue, queueSubmitDesc);
+}
+
+Result nri::direct::QueueSubmitMulti(Queue& queue, const QueueSubmitDesc* queueSubmitDescs, uint32_t queueSubmitDescNum) {
+    return ::QueueSubmitMulti(queue, queueSubmitDescs, queueSubmitDescNum);
+}
+
+void* nri::direct::MapBuffer(Buffer& buffer, uint64_t offset, uint64_t size) {
+    return ::MapBuffer(buffer, offset, size);
+}
+
+void nri::direct::UnmapBuffer(Buffer& buffer) {
+    ::UnmapBuffer(buffer);
+}
+
+#endif
+
+#pragma endregion
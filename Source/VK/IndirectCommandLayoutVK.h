@@ -0,0 +1,46 @@
+// © 2025 NVIDIA Corporation
+
+#pragma once
+
+namespace nri {
+
+struct IndirectCommandLayoutVK final : public DebugNameBase {
+    inline IndirectCommandLayoutVK(DeviceVK& device)
+        : m_Device(device) {
+    }
+
+    inline operator VkIndirectCommandsLayoutEXT() const {
+        return m_Handle;
+    }
+
+    inline DeviceVK& GetDevice() const {
+        return m_Device;
+    }
+
+    inline VkShaderStageFlags GetShaderStages() const {
+        return m_ShaderStages;
+    }
+
+    ~IndirectCommandLayoutVK();
+
+    Result Create(const IndirectCommandLayoutDesc& indirectCommandLayoutDesc);
+
+    //================================================================================================================
+    // DebugNameBase
+    //================================================================================================================
+
+    void SetDebugName(const char* name) DEBUG_NAME_OVERRIDE;
+
+    //================================================================================================================
+    // NRI
+    //================================================================================================================
+
+    uint64_t GetPreprocessBufferSize(const IndirectExecutionSet* indirectExecutionSet, uint32_t sequenceMaxNum) const;
+
+private:
+    DeviceVK& m_Device;
+    VkIndirectCommandsLayoutEXT m_Handle = VK_NULL_HANDLE;
+    VkShaderStageFlags m_ShaderStages = 0;
+};
+
+} // namespace nri
@@ -0,0 +1,113 @@
+// © 2025 NVIDIA Corporation
+
+IndirectCommandLayoutVK::~IndirectCommandLayoutVK() {
+    const auto& vk = m_Device.GetDispatchTable();
+    vk.DestroyIndirectCommandsLayoutEXT(m_Device, m_Handle, m_Device.GetVkAllocationCallbacks());
+}
+
+Result IndirectCommandLayoutVK::Create(const IndirectCommandLayoutDesc& indirectCommandLayoutDesc) {
+    const PipelineLayoutVK* pipelineLayoutVK = (const PipelineLayoutVK*)indirectCommandLayoutDesc.pipelineLayout;
+    m_ShaderStages = GetShaderStageFlags(indirectCommandLayoutDesc.shaderStages);
+
+    // Tokens
+    uint32_t commandNum = indirectCommandLayoutDesc.commandNum;
+    Scratch<VkIndirectCommandsLayoutTokenEXT> tokens = AllocateScratch(m_Device, VkIndirectCommandsLayoutTokenEXT, commandNum);
+    Scratch<VkIndirectCommandsPushConstantTokenEXT> pushConstantTokens = AllocateScratch(m_Device, VkIndirectCommandsPushConstantTokenEXT, commandNum);
+    Scratch<VkIndirectCommandsVertexBufferTokenEXT> vertexBufferTokens = AllocateScratch(m_Device, VkIndirectCommandsVertexBufferTokenEXT, commandNum);
+
+    VkIndirectCommandsIndexBufferTokenEXT indexBufferToken = {VK_INDIRECT_COMMANDS_INPUT_MODE_VULKAN_INDEX_BUFFER_EXT};
+    VkIndirectCommandsExecutionSetTokenEXT executionSetToken = {VK_INDIRECT_EXECUTION_SET_INFO_TYPE_PIPELINES_EXT, m_ShaderStages};
+
+    for (uint32_t i = 0; i < commandNum; i++) {
+        const IndirectCommandDesc& indirectCommandDesc = indirectCommandLayoutDesc.commands[i];
+
+        VkIndirectCommandsLayoutTokenEXT& token = tokens[i];
+        token = {VK_STRUCTURE_TYPE_INDIRECT_COMMANDS_LAYOUT_TOKEN_EXT};
+        token.offset = indirectCommandDesc.offset;
+
+        switch (indirectCommandDesc.type) {
+            case IndirectCommandType::PIPELINE:
+                token.type = VK_INDIRECT_COMMANDS_TOKEN_TYPE_EXECUTION_SET_EXT;
+                token.data.pExecutionSet = &executionSetToken;
+                break;
+
+            case IndirectCommandType::ROOT_CONSTANTS: {
+                RETURN_ON_FAILURE(&m_Device, pipelineLayoutVK, Result::INVALID_ARGUMENT, "'pipelineLayout' is required for 'ROOT_CONSTANTS'");
+
+                const auto& pushConstantBindings = pipelineLayoutVK->GetBindingInfo().pushConstantBindings;
+                RETURN_ON_FAILURE(&m_Device, indirectCommandDesc.rootConstantIndex < pushConstantBindings.size(), Result::INVALID_ARGUMENT, "'rootConstantIndex' is out of bounds");
+
+                const PushConstantBindingDesc& pushConstantBindingDesc = pushConstantBindings[indirectCommandDesc.rootConstantIndex];
+                pushConstantTokens[i].updateRange = {pushConstantBindingDesc.stages, pushConstantBindingDesc.offset, pushConstantBindingDesc.size};
+
+                token.type = VK_INDIRECT_COMMANDS_TOKEN_TYPE_PUSH_CONSTANT_EXT;
+                token.data.pPushConstant = &pushConstantTokens[i];
+            } break;
+
+            case IndirectCommandType::INDEX_BUFFER:
+                token.type = VK_INDIRECT_COMMANDS_TOKEN_TYPE_INDEX_BUFFER_EXT;
+                token.data.pIndexBuffer = &indexBufferToken;
+                break;
+
+            case IndirectCommandType::VERTEX_BUFFER:
+                vertexBufferTokens[i].vertexBindingUnit = indirectCommandDesc.vertexBufferSlot;
+
+                token.type = VK_INDIRECT_COMMANDS_TOKEN_TYPE_VERTEX_BUFFER_EXT;
+                token.data.pVertexBuffer = &vertexBufferTokens[i];
+                break;
+
+            case IndirectCommandType::DRAW:
+                token.type = VK_INDIRECT_COMMANDS_TOKEN_TYPE_DRAW_EXT;
+                break;
+
+            case IndirectCommandType::DRAW_INDEXED:
+                token.type = VK_INDIRECT_COMMANDS_TOKEN_TYPE_DRAW_INDEXED_EXT;
+                break;
+
+            case IndirectCommandType::DISPATCH:
+                token.type = VK_INDIRECT_COMMANDS_TOKEN_TYPE_DISPATCH_EXT;
+                break;
+
+            case IndirectCommandType::DRAW_MESH_TASKS:
+                token.type = VK_INDIRECT_COMMANDS_TOKEN_TYPE_DRAW_MESH_TASKS_EXT;
+                break;
+
+            default:
+                return Result::INVALID_ARGUMENT;
+        }
+    }
+
+    // Create
+    VkIndirectCommandsLayoutCreateInfoEXT createInfo = {VK_STRUCTURE_TYPE_INDIRECT_COMMANDS_LAYOUT_CREATE_INFO_EXT};
+    createInfo.shaderStages = m_ShaderStages;
+    createInfo.indirectStride = indirectCommandLayoutDesc.stride;
+    createInfo.pipelineLayout = pipelineLayoutVK ? (VkPipelineLayout)*pipelineLayoutVK : VK_NULL_HANDLE;
+    createInfo.tokenCount = commandNum;
+    createInfo.pTokens = tokens;
+
+    const auto& vk = m_Device.GetDispatchTable();
+    VkResult vkResult = vk.CreateIndirectCommandsLayoutEXT(m_Device, &createInfo, m_Device.GetVkAllocationCallbacks(), &m_Handle);
+    RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkCreateIndirectCommandsLayoutEXT");
+
+    return Result::SUCCESS;
+}
+
+NRI_INLINE void IndirectCommandLayoutVK::SetDebugName(const char* name) {
+    m_Device.SetDebugNameToTrivialObject(VK_OBJECT_TYPE_INDIRECT_COMMANDS_LAYOUT_EXT, (uint64_t)m_Handle, name);
+}
+
+NRI_INLINE uint64_t IndirectCommandLayoutVK::GetPreprocessBufferSize(const IndirectExecutionSet* indirectExecutionSet, uint32_t sequenceMaxNum) const {
+    const IndirectExecutionSetVK* indirectExecutionSetVK = (const IndirectExecutionSetVK*)indirectExecutionSet;
+
+    VkGeneratedCommandsMemoryRequirementsInfoEXT memoryRequirementsInfo = {VK_STRUCTURE_TYPE_GENERATED_COMMANDS_MEMORY_REQUIREMENTS_INFO_EXT};
+    memoryRequirementsInfo.indirectExecutionSet = indirectExecutionSetVK ? (VkIndirectExecutionSetEXT)*indirectExecutionSetVK : VK_NULL_HANDLE;
+    memoryRequirementsInfo.indirectCommandsLayout = m_Handle;
+    memoryRequirementsInfo.maxSequenceCount = sequenceMaxNum;
+
+    VkMemoryRequirements2 requirements = {VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2};
+
+    const auto& vk = m_Device.GetDispatchTable();
+    vk.GetGeneratedCommandsMemoryRequirementsEXT(m_Device, &memoryRequirementsInfo, &requirements);
+
+    return requirements.memoryRequirements.size;
+}
@@ -0,0 +1,43 @@
+// © 2025 NVIDIA Corporation
+
+IndirectExecutionSetVK::~IndirectExecutionSetVK() {
+    const auto& vk = m_Device.GetDispatchTable();
+    vk.DestroyIndirectExecutionSetEXT(m_Device, m_Handle, m_Device.GetVkAllocationCallbacks());
+}
+
+Result IndirectExecutionSetVK::Create(const IndirectExecutionSetDesc& indirectExecutionSetDesc) {
+    const PipelineVK& initialPipelineVK = *(const PipelineVK*)indirectExecutionSetDesc.initialPipeline;
+
+    VkIndirectExecutionSetPipelineInfoEXT pipelineInfo = {VK_STRUCTURE_TYPE_INDIRECT_EXECUTION_SET_PIPELINE_INFO_EXT};
+    pipelineInfo.initialPipeline = initialPipelineVK;
+    pipelineInfo.maxPipelineCount = indirectExecutionSetDesc.pipelineMaxNum;
+
+    VkIndirectExecutionSetCreateInfoEXT createInfo = {VK_STRUCTURE_TYPE_INDIRECT_EXECUTION_SET_CREATE_INFO_EXT};
+    createInfo.type = VK_INDIRECT_EXECUTION_SET_INFO_TYPE_PIPELINES_EXT;
+    createInfo.info.pPipelineInfo = &pipelineInfo;
+
+    const auto& vk = m_Device.GetDispatchTable();
+    VkResult vkResult = vk.CreateIndirectExecutionSetEXT(m_Device, &createInfo, m_Device.GetVkAllocationCallbacks(), &m_Handle);
+    RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkCreateIndirectExecutionSetEXT");
+
+    return Result::SUCCESS;
+}
+
+NRI_INLINE void IndirectExecutionSetVK::SetDebugName(const char* name) {
+    m_Device.SetDebugNameToTrivialObject(VK_OBJECT_TYPE_INDIRECT_EXECUTION_SET_EXT, (uint64_t)m_Handle, name);
+}
+
+NRI_INLINE void IndirectExecutionSetVK::Update(uint32_t basePipelineIndex, const Pipeline* const* pipelines, uint32_t pipelineNum) {
+    Scratch<VkWriteIndirectExecutionSetPipelineEXT> writes = AllocateScratch(m_Device, VkWriteIndirectExecutionSetPipelineEXT, pipelineNum);
+    for (uint32_t i = 0; i < pipelineNum; i++) {
+        const PipelineVK& pipelineVK = *(const PipelineVK*)pipelines[i];
+
+        VkWriteIndirectExecutionSetPipelineEXT& write = writes[i];
+        write = {VK_STRUCTURE_TYPE_WRITE_INDIRECT_EXECUTION_SET_PIPELINE_EXT};
+        write.index = basePipelineIndex + i;
+        write.pipeline = pipelineVK;
+    }
+
+    const auto& vk = m_Device.GetDispatchTable();
+    vk.UpdateIndirectExecutionSetPipelineEXT(m_Device, m_Handle, pipelineNum, writes);
+}
@@ -7,6 +7,7 @@ namespace nri {
 struct PushConstantBindingDesc {
     VkShaderStageFlags stages;
     uint32_t offset;
+    uint32_t size;
 };
 
 struct PushDescriptorBindingDesc {
@@ -170,7 +170,7 @@ Result PipelineLayoutVK::Create(const PipelineLayoutDesc& pipelineLayoutDesc) {
         range.size = pushConstantDesc.size;
 
         // Binding info
-        m_BindingInfo.pushConstantBindings[i] = {GetShaderStageFlags(pushConstantDesc.shaderStages), offset};
+        m_BindingInfo.pushConstantBindings[i] = {GetShaderStageFlags(pushConstantDesc.shaderStages), offset, pushConstantDesc.size};
 
         offset += pushConstantDesc.size;
     }
@@ -289,6 +289,14 @@ Result PipelineVK::Create(const GraphicsPipelineDesc& graphicsPipelineDesc) {
     if (FillPipelineRobustness(m_Device, graphicsPipelineDesc.robustness, robustnessInfo))
         pipelineRenderingCreateInfo.pNext = &robustnessInfo;
 
+    VkPipelineCreateFlags2CreateInfoKHR flags2 = {VK_STRUCTURE_TYPE_PIPELINE_CREATE_FLAGS_2_CREATE_INFO_KHR};
+    if (m_Device.m_IsSupported.deviceGeneratedCommands) {
+        flags2.pNext = info.pNext;
+        flags2.flags = flags | VK_PIPELINE_CREATE_2_INDIRECT_BINDABLE_BIT_EXT; // overrides "flags"
+
+        info.pNext = &flags2;
+    }
+
     const auto& vk = m_Device.GetDispatchTable();
     VkResult vkResult = vk.CreateGraphicsPipelines(m_Device, VK_NULL_HANDLE, 1, &info, m_Device.GetVkAllocationCallbacks(), &m_Handle);
     RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkCreateGraphicsPipelines");
@@ -341,6 +349,14 @@ Result PipelineVK::Create(const ComputePipelineDesc& computePipelineDesc) {
     if (FillPipelineRobustness(m_Device, computePipelineDesc.robustness, robustnessInfo))
         info.pNext = &robustnessInfo;
 
+    VkPipelineCreateFlags2CreateInfoKHR flags2 = {VK_STRUCTURE_TYPE_PIPELINE_CREATE_FLAGS_2_CREATE_INFO_KHR};
+    if (m_Device.m_IsSupported.deviceGeneratedCommands) {
+        flags2.pNext = info.pNext;
+        flags2.flags = VK_PIPELINE_CREATE_2_INDIRECT_BINDABLE_BIT_EXT; // overrides "flags"
+
+        info.pNext = &flags2;
+    }
+
     vkResult = vk.CreateComputePipelines(m_Device, VK_NULL_HANDLE, 1, &info, m_Device.GetVkAllocationCallbacks(), &m_Handle);
     RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkCreateComputePipelines");
 
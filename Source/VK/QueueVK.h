@@ -2,11 +2,23 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 namespace nri {
 
 struct QueueVK final : public DebugNameBase {
     inline QueueVK(DeviceVK& device)
-        : m_Device(device) {
+        : m_Device(device)
+        , m_PendingSubmits(device.GetStdAllocator())
+        , m_PendingPresentIds(device.GetStdAllocator())
+        , m_PendingSemaphores(device.GetStdAllocator())
+        , m_PendingCommandBuffers(device.GetStdAllocator())
+        , m_ExecutingSubmits(device.GetStdAllocator())
+        , m_ExecutingPresentIds(device.GetStdAllocator())
+        , m_ExecutingSemaphores(device.GetStdAllocator())
+        , m_ExecutingCommandBuffers(device.GetStdAllocator()) {
     }
 
     inline operator VkQueue() const {
@@ -29,7 +41,12 @@ struct QueueVK final : public DebugNameBase {
         return m_Lock;
     }
 
+    ~QueueVK();
+
     Result Create(QueueType type, uint32_t familyIndex, VkQueue handle);
+    Result FlushSubmissions(); // waits for the worker to pass all enqueued submissions to the driver
+    uint64_t GetSubmissionId() const;
+    uint64_t GetCompletedSubmissionId() const;
 
     //================================================================================================================
     // DebugNameBase
@@ -45,14 +62,40 @@ struct QueueVK final : public DebugNameBase {
     void EndAnnotation();
     void Annotation(const char* name, uint32_t bgra);
     Result Submit(const QueueSubmitDesc& queueSubmitDesc, const SwapChain* swapChain);
+    Result SubmitMulti(const QueueSubmitDesc* queueSubmitDescs, uint32_t queueSubmitDescNum, const SwapChain* swapChain);
     Result WaitIdle();
 
 private:
+    Result Enqueue(const QueueSubmitDesc* queueSubmitDescs, uint32_t queueSubmitDescNum, const SwapChain* swapChain);
+    Result SubmitExecuting();
+    void Worker();
+
     DeviceVK& m_Device;
     VkQueue m_Handle = VK_NULL_HANDLE;
     uint32_t m_FamilyIndex = INVALID_FAMILY_INDEX;
     QueueType m_Type = QueueType(-1);
     Lock m_Lock;
+
+    // Implicit timeline, signaled by every submission
+    VkSemaphore m_Timeline = VK_NULL_HANDLE;
+    std::atomic_uint64_t m_SubmissionId = 0;
+
+    // Async submission, if "enableVKAsyncSubmission" (pointers in "VkSubmitInfo2" are resolved by the worker)
+    Vector<VkSubmitInfo2> m_PendingSubmits;
+    Vector<VkLatencySubmissionPresentIdNV> m_PendingPresentIds; // "sType = 0" if not used
+    Vector<VkSemaphoreSubmitInfo> m_PendingSemaphores;          // waits, then signals
+    Vector<VkCommandBufferSubmitInfo> m_PendingCommandBuffers;
+    Vector<VkSubmitInfo2> m_ExecutingSubmits;
+    Vector<VkLatencySubmissionPresentIdNV> m_ExecutingPresentIds;
+    Vector<VkSemaphoreSubmitInfo> m_ExecutingSemaphores;
+    Vector<VkCommandBufferSubmitInfo> m_ExecutingCommandBuffers;
+    std::thread m_Thread;
+    std::mutex m_Mutex;
+    std::condition_variable m_WorkerCondition;
+    std::condition_variable m_IdleCondition;
+    Result m_AsyncResult = Result::SUCCESS; // the first failed async submission
+    bool m_IsBusy = false;
+    bool m_IsExiting = false;
 };
 
 } // namespace nri
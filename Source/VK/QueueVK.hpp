@@ -1,18 +1,205 @@
 // © 2021 NVIDIA Corporation
 
+QueueVK::~QueueVK() {
+    if (m_Thread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+            m_IsExiting = true;
+        }
+
+        m_WorkerCondition.notify_one();
+        m_Thread.join();
+    }
+
+    if (m_Timeline) {
+        const auto& vk = m_Device.GetDispatchTable();
+        vk.DestroySemaphore(m_Device, m_Timeline, m_Device.GetVkAllocationCallbacks());
+    }
+}
+
 Result QueueVK::Create(QueueType type, uint32_t familyIndex, VkQueue handle) {
     m_Type = type;
     m_FamilyIndex = familyIndex;
     m_Handle = handle;
 
+    VkSemaphoreTypeCreateInfo semaphoreTypeCreateInfo = {VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO};
+    semaphoreTypeCreateInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+
+    VkSemaphoreCreateInfo semaphoreCreateInfo = {VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO};
+    semaphoreCreateInfo.pNext = &semaphoreTypeCreateInfo;
+
+    const auto& vk = m_Device.GetDispatchTable();
+    VkResult vkResult = vk.CreateSemaphore(m_Device, &semaphoreCreateInfo, m_Device.GetVkAllocationCallbacks(), &m_Timeline);
+    RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "vkCreateSemaphore");
+
     return Result::SUCCESS;
 }
 
+uint64_t QueueVK::GetSubmissionId() const {
+    return m_SubmissionId.load(std::memory_order_acquire);
+}
+
+uint64_t QueueVK::GetCompletedSubmissionId() const {
+    uint64_t value = 0;
+
+    const auto& vk = m_Device.GetDispatchTable();
+    vk.GetSemaphoreCounterValue(m_Device, m_Timeline, &value);
+
+    return value;
+}
+
 NRI_INLINE void QueueVK::SetDebugName(const char* name) {
     m_Device.SetDebugNameToTrivialObject(VK_OBJECT_TYPE_QUEUE, (uint64_t)m_Handle, name);
 }
 
+Result QueueVK::FlushSubmissions() {
+    if (!m_Device.IsAsyncSubmissionEnabled())
+        return Result::SUCCESS;
+
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    m_IdleCondition.wait(lock, [this] { return m_PendingSubmits.empty() && !m_IsBusy; });
+
+    return m_AsyncResult;
+}
+
+Result QueueVK::Enqueue(const QueueSubmitDesc* queueSubmitDescs, uint32_t queueSubmitDescNum, const SwapChain* swapChain) {
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+
+        // Errors of async submissions are reported by subsequent calls
+        if (m_AsyncResult != Result::SUCCESS)
+            return m_AsyncResult;
+
+        if (!m_Thread.joinable())
+            m_Thread = std::thread(&QueueVK::Worker, this);
+
+        for (uint32_t i = 0; i < queueSubmitDescNum; i++) {
+            const QueueSubmitDesc& queueSubmitDesc = queueSubmitDescs[i];
+
+            for (uint32_t j = 0; j < queueSubmitDesc.waitFenceNum; j++) {
+                VkSemaphoreSubmitInfo& waitSemaphore = m_PendingSemaphores.emplace_back();
+                waitSemaphore = {VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO};
+                waitSemaphore.semaphore = *(FenceVK*)queueSubmitDesc.waitFences[j].fence;
+                waitSemaphore.value = queueSubmitDesc.waitFences[j].value;
+                waitSemaphore.stageMask = GetPipelineStageFlags(queueSubmitDesc.waitFences[j].stages);
+            }
+
+            for (uint32_t j = 0; j < queueSubmitDesc.signalFenceNum; j++) {
+                VkSemaphoreSubmitInfo& signalSemaphore = m_PendingSemaphores.emplace_back();
+                signalSemaphore = {VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO};
+                signalSemaphore.semaphore = *(FenceVK*)queueSubmitDesc.signalFences[j].fence;
+                signalSemaphore.value = queueSubmitDesc.signalFences[j].value;
+                signalSemaphore.stageMask = GetPipelineStageFlags(queueSubmitDesc.signalFences[j].stages);
+            }
+
+            bool isLast = i == queueSubmitDescNum - 1;
+            if (isLast) {
+                VkSemaphoreSubmitInfo& timelineSemaphore = m_PendingSemaphores.emplace_back();
+                timelineSemaphore = {VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO};
+                timelineSemaphore.semaphore = m_Timeline;
+                timelineSemaphore.value = m_SubmissionId.load(std::memory_order_relaxed) + 1;
+                timelineSemaphore.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+
+                m_SubmissionId.store(timelineSemaphore.value, std::memory_order_release);
+            }
+
+            for (uint32_t j = 0; j < queueSubmitDesc.commandBufferNum; j++) {
+                VkCommandBufferSubmitInfo& commandBuffer = m_PendingCommandBuffers.emplace_back();
+                commandBuffer = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO};
+                commandBuffer.commandBuffer = *(CommandBufferVK*)queueSubmitDesc.commandBuffers[j];
+            }
+
+            VkSubmitInfo2& submitInfo = m_PendingSubmits.emplace_back();
+            submitInfo = {VK_STRUCTURE_TYPE_SUBMIT_INFO_2};
+            submitInfo.waitSemaphoreInfoCount = queueSubmitDesc.waitFenceNum;
+            submitInfo.commandBufferInfoCount = queueSubmitDesc.commandBufferNum;
+            submitInfo.signalSemaphoreInfoCount = queueSubmitDesc.signalFenceNum + (isLast ? 1 : 0);
+
+            VkLatencySubmissionPresentIdNV& presentId = m_PendingPresentIds.emplace_back();
+            presentId = {};
+            if (swapChain && m_Device.m_IsSupported.presentId && isLast) {
+                presentId = {VK_STRUCTURE_TYPE_LATENCY_SUBMISSION_PRESENT_ID_NV};
+                presentId.presentID = ((const SwapChainVK*)swapChain)->GetPresentId();
+            }
+        }
+    }
+
+    m_WorkerCondition.notify_one();
+
+    return Result::SUCCESS;
+}
+
+Result QueueVK::SubmitExecuting() {
+    VkSemaphoreSubmitInfo* semaphores = m_ExecutingSemaphores.data();
+    VkCommandBufferSubmitInfo* commandBuffers = m_ExecutingCommandBuffers.data();
+
+    for (size_t i = 0; i < m_ExecutingSubmits.size(); i++) {
+        VkSubmitInfo2& submitInfo = m_ExecutingSubmits[i];
+
+        submitInfo.pWaitSemaphoreInfos = semaphores;
+        semaphores += submitInfo.waitSemaphoreInfoCount;
+
+        submitInfo.pSignalSemaphoreInfos = semaphores;
+        semaphores += submitInfo.signalSemaphoreInfoCount;
+
+        submitInfo.pCommandBufferInfos = commandBuffers;
+        commandBuffers += submitInfo.commandBufferInfoCount;
+
+        if (m_ExecutingPresentIds[i].sType == VK_STRUCTURE_TYPE_LATENCY_SUBMISSION_PRESENT_ID_NV)
+            submitInfo.pNext = &m_ExecutingPresentIds[i];
+    }
+
+    VkResult vkResult = VK_SUCCESS;
+    {
+        ExclusiveScope lock(m_Lock);
+
+        const auto& vk = m_Device.GetDispatchTable();
+        vkResult = vk.QueueSubmit2(m_Handle, (uint32_t)m_ExecutingSubmits.size(), m_ExecutingSubmits.data(), VK_NULL_HANDLE);
+    }
+
+    m_ExecutingSubmits.clear();
+    m_ExecutingPresentIds.clear();
+    m_ExecutingSemaphores.clear();
+    m_ExecutingCommandBuffers.clear();
+
+    RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "QueueSubmit2");
+
+    return Result::SUCCESS;
+}
+
+void QueueVK::Worker() {
+    std::unique_lock<std::mutex> lock(m_Mutex);
+
+    while (true) {
+        m_WorkerCondition.wait(lock, [this] { return m_IsExiting || !m_PendingSubmits.empty(); });
+
+        if (m_PendingSubmits.empty())
+            break; // exiting
+
+        // Everything enqueued so far goes to the driver in one call
+        std::swap(m_PendingSubmits, m_ExecutingSubmits);
+        std::swap(m_PendingPresentIds, m_ExecutingPresentIds);
+        std::swap(m_PendingSemaphores, m_ExecutingSemaphores);
+        std::swap(m_PendingCommandBuffers, m_ExecutingCommandBuffers);
+        m_IsBusy = true;
+
+        lock.unlock();
+        Result result = SubmitExecuting();
+        lock.lock();
+
+        if (m_AsyncResult == Result::SUCCESS)
+            m_AsyncResult = result;
+
+        m_IsBusy = false;
+
+        if (m_PendingSubmits.empty())
+            m_IdleCondition.notify_all();
+    }
+}
+
 NRI_INLINE void QueueVK::BeginAnnotation(const char* name, uint32_t bgra) {
+    FlushSubmissions(); // keep labels in order with async submissions
+
     VkDebugUtilsLabelEXT info = {VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT};
     info.pLabelName = name;
     info.color[0] = ((bgra >> 16) & 0xFF) / 255.0f;
@@ -26,12 +213,16 @@ NRI_INLINE void QueueVK::BeginAnnotation(const char* name, uint32_t bgra) {
 }
 
 NRI_INLINE void QueueVK::EndAnnotation() {
+    FlushSubmissions();
+
     const auto& vk = m_Device.GetDispatchTable();
     if (vk.QueueEndDebugUtilsLabelEXT)
         vk.QueueEndDebugUtilsLabelEXT(m_Handle);
 }
 
 NRI_INLINE void QueueVK::Annotation(const char* name, uint32_t bgra) {
+    FlushSubmissions();
+
     VkDebugUtilsLabelEXT info = {VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT};
     info.pLabelName = name;
     info.color[0] = ((bgra >> 16) & 0xFF) / 255.0f;
@@ -45,52 +236,105 @@ NRI_INLINE void QueueVK::Annotation(const char* name, uint32_t bgra) {
 }
 
 NRI_INLINE Result QueueVK::Submit(const QueueSubmitDesc& queueSubmitDesc, const SwapChain* swapChain) {
-    ExclusiveScope lock(m_Lock);
+    return SubmitMulti(&queueSubmitDesc, 1, swapChain);
+}
 
-    Scratch<VkSemaphoreSubmitInfo> waitSemaphores = AllocateScratch(m_Device, VkSemaphoreSubmitInfo, queueSubmitDesc.waitFenceNum);
-    for (uint32_t i = 0; i < queueSubmitDesc.waitFenceNum; i++) {
-        waitSemaphores[i] = {VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO};
-        waitSemaphores[i].semaphore = *(FenceVK*)queueSubmitDesc.waitFences[i].fence;
-        waitSemaphores[i].value = queueSubmitDesc.waitFences[i].value;
-        waitSemaphores[i].stageMask = GetPipelineStageFlags(queueSubmitDesc.waitFences[i].stages);
-    }
+NRI_INLINE Result QueueVK::SubmitMulti(const QueueSubmitDesc* queueSubmitDescs, uint32_t queueSubmitDescNum, const SwapChain* swapChain) {
+    if (m_Device.IsAsyncSubmissionEnabled())
+        return Enqueue(queueSubmitDescs, queueSubmitDescNum, swapChain);
 
-    Scratch<VkCommandBufferSubmitInfo> commandBuffers = AllocateScratch(m_Device, VkCommandBufferSubmitInfo, queueSubmitDesc.commandBufferNum);
-    for (uint32_t i = 0; i < queueSubmitDesc.commandBufferNum; i++) {
-        commandBuffers[i] = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO};
-        commandBuffers[i].commandBuffer = *(CommandBufferVK*)queueSubmitDesc.commandBuffers[i];
+    uint32_t waitFenceNum = 0;
+    uint32_t commandBufferNum = 0;
+    uint32_t signalFenceNum = 0;
+    for (uint32_t i = 0; i < queueSubmitDescNum; i++) {
+        waitFenceNum += queueSubmitDescs[i].waitFenceNum;
+        commandBufferNum += queueSubmitDescs[i].commandBufferNum;
+        signalFenceNum += queueSubmitDescs[i].signalFenceNum;
     }
 
-    Scratch<VkSemaphoreSubmitInfo> signalSemaphores = AllocateScratch(m_Device, VkSemaphoreSubmitInfo, queueSubmitDesc.signalFenceNum);
-    for (uint32_t i = 0; i < queueSubmitDesc.signalFenceNum; i++) {
-        signalSemaphores[i] = {VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO};
-        signalSemaphores[i].semaphore = *(FenceVK*)queueSubmitDesc.signalFences[i].fence;
-        signalSemaphores[i].value = queueSubmitDesc.signalFences[i].value;
-        signalSemaphores[i].stageMask = GetPipelineStageFlags(queueSubmitDesc.signalFences[i].stages);
+    // All batches share flat arrays
+    Scratch<VkSubmitInfo2> submitInfos = AllocateScratch(m_Device, VkSubmitInfo2, queueSubmitDescNum);
+    Scratch<VkSemaphoreSubmitInfo> waitSemaphores = AllocateScratch(m_Device, VkSemaphoreSubmitInfo, waitFenceNum);
+    Scratch<VkCommandBufferSubmitInfo> commandBuffers = AllocateScratch(m_Device, VkCommandBufferSubmitInfo, commandBufferNum);
+    Scratch<VkSemaphoreSubmitInfo> signalSemaphores = AllocateScratch(m_Device, VkSemaphoreSubmitInfo, signalFenceNum + 1);
+
+    VkSemaphoreSubmitInfo* waitSemaphore = waitSemaphores;
+    VkCommandBufferSubmitInfo* commandBuffer = commandBuffers;
+    VkSemaphoreSubmitInfo* signalSemaphore = signalSemaphores;
+
+    for (uint32_t i = 0; i < queueSubmitDescNum; i++) {
+        const QueueSubmitDesc& queueSubmitDesc = queueSubmitDescs[i];
+
+        VkSubmitInfo2& submitInfo = submitInfos[i];
+        submitInfo = {VK_STRUCTURE_TYPE_SUBMIT_INFO_2};
+        submitInfo.waitSemaphoreInfoCount = queueSubmitDesc.waitFenceNum;
+        submitInfo.pWaitSemaphoreInfos = waitSemaphore;
+        submitInfo.commandBufferInfoCount = queueSubmitDesc.commandBufferNum;
+        submitInfo.pCommandBufferInfos = commandBuffer;
+        submitInfo.signalSemaphoreInfoCount = queueSubmitDesc.signalFenceNum;
+        submitInfo.pSignalSemaphoreInfos = signalSemaphore;
+
+        for (uint32_t j = 0; j < queueSubmitDesc.waitFenceNum; j++) {
+            *waitSemaphore = {VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO};
+            waitSemaphore->semaphore = *(FenceVK*)queueSubmitDesc.waitFences[j].fence;
+            waitSemaphore->value = queueSubmitDesc.waitFences[j].value;
+            waitSemaphore->stageMask = GetPipelineStageFlags(queueSubmitDesc.waitFences[j].stages);
+            waitSemaphore++;
+        }
+
+        for (uint32_t j = 0; j < queueSubmitDesc.commandBufferNum; j++) {
+            *commandBuffer = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO};
+            commandBuffer->commandBuffer = *(CommandBufferVK*)queueSubmitDesc.commandBuffers[j];
+            commandBuffer++;
+        }
+
+        for (uint32_t j = 0; j < queueSubmitDesc.signalFenceNum; j++) {
+            *signalSemaphore = {VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO};
+            signalSemaphore->semaphore = *(FenceVK*)queueSubmitDesc.signalFences[j].fence;
+            signalSemaphore->value = queueSubmitDesc.signalFences[j].value;
+            signalSemaphore->stageMask = GetPipelineStageFlags(queueSubmitDesc.signalFences[j].stages);
+            signalSemaphore++;
+        }
     }
 
-    VkSubmitInfo2 submitInfo = {VK_STRUCTURE_TYPE_SUBMIT_INFO_2};
-    submitInfo.waitSemaphoreInfoCount = queueSubmitDesc.waitFenceNum;
-    submitInfo.pWaitSemaphoreInfos = waitSemaphores;
-    submitInfo.commandBufferInfoCount = queueSubmitDesc.commandBufferNum;
-    submitInfo.pCommandBufferInfos = commandBuffers;
-    submitInfo.signalSemaphoreInfoCount = queueSubmitDesc.signalFenceNum;
-    submitInfo.pSignalSemaphoreInfos = signalSemaphores;
+    // The last batch also signals the queue timeline (right after its own signals)
+    VkSemaphoreSubmitInfo* timelineSemaphore = nullptr;
+    if (queueSubmitDescNum) {
+        timelineSemaphore = signalSemaphore;
+        *timelineSemaphore = {VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO};
+        timelineSemaphore->semaphore = m_Timeline;
+        timelineSemaphore->stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+
+        submitInfos[queueSubmitDescNum - 1].signalSemaphoreInfoCount++;
+    }
 
     VkLatencySubmissionPresentIdNV presentId = {VK_STRUCTURE_TYPE_LATENCY_SUBMISSION_PRESENT_ID_NV};
-    if (swapChain && m_Device.m_IsSupported.presentId) {
+    if (swapChain && m_Device.m_IsSupported.presentId && queueSubmitDescNum) {
         presentId.presentID = ((const SwapChainVK*)swapChain)->GetPresentId();
-        submitInfo.pNext = &presentId;
+        submitInfos[queueSubmitDescNum - 1].pNext = &presentId;
     }
 
+    ExclusiveScope lock(m_Lock);
+
+    // IDs are assigned under the lock to keep timeline values increasing
+    if (timelineSemaphore)
+        timelineSemaphore->value = m_SubmissionId.load(std::memory_order_relaxed) + 1;
+
     const auto& vk = m_Device.GetDispatchTable();
-    VkResult vkResult = vk.QueueSubmit2(m_Handle, 1, &submitInfo, VK_NULL_HANDLE);
+    VkResult vkResult = vk.QueueSubmit2(m_Handle, queueSubmitDescNum, submitInfos, VK_NULL_HANDLE);
     RETURN_ON_BAD_VKRESULT(&m_Device, vkResult, "QueueSubmit2");
 
+    if (timelineSemaphore)
+        m_SubmissionId.store(timelineSemaphore->value, std::memory_order_release);
+
     return Result::SUCCESS;
 }
 
 NRI_INLINE Result QueueVK::WaitIdle() {
+    Result result = FlushSubmissions();
+    if (result != Result::SUCCESS)
+        return result;
+
     ExclusiveScope lock(m_Lock);
 
     const auto& vk = m_Device.GetDispatchTable();
@@ -77,7 +77,8 @@ Result BufferVK::Create(const AllocateBufferDesc& bufferDesc) {
 
     // Fill info
     VkBufferCreateInfo bufferCreateInfo = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
-    m_Device.FillCreateInfo(bufferDesc.desc, bufferCreateInfo);
+    VkBufferUsageFlags2CreateInfoKHR usageFlags2 = {};
+    m_Device.FillCreateInfo(bufferDesc.desc, bufferCreateInfo, usageFlags2);
 
     // Create
     VmaAllocationCreateInfo allocationCreateInfo = {};
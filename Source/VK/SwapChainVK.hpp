@@ -410,6 +410,11 @@ NRI_INLINE Result SwapChainVK::WaitForPresent() {
 }
 
 NRI_INLINE Result SwapChainVK::Present(FenceVK& releaseSemaphore) {
+    // The release semaphore can be signaled by a submission still owned by the async worker
+    Result result = m_Queue->FlushSubmissions();
+    if (result != Result::SUCCESS)
+        return result;
+
     ExclusiveScope lock(m_Queue->GetLock());
 
     // Present (wait)
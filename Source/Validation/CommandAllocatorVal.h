@@ -13,12 +13,20 @@ struct CommandAllocatorVal final : public ObjectVal {
         return (CommandAllocator*)m_Impl;
     }
 
+    inline uint32_t GetResetIndex() const {
+        return m_ResetIndex;
+    }
+
     //================================================================================================================
     // NRI
     //================================================================================================================
 
     Result CreateCommandBuffer(CommandBuffer*& commandBuffer);
+    Result CreateSecondaryCommandBuffer(CommandBuffer*& commandBuffer);
     void Reset();
+
+private:
+    uint32_t m_ResetIndex = 0;
 };
 
 } // namespace nri
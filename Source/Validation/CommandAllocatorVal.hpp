@@ -6,11 +6,24 @@ NRI_INLINE Result CommandAllocatorVal::CreateCommandBuffer(CommandBuffer*& comma
 
     commandBuffer = nullptr;
     if (result == Result::SUCCESS)
-        commandBuffer = (CommandBuffer*)Allocate<CommandBufferVal>(m_Device.GetAllocationCallbacks(), m_Device, commandBufferImpl, false);
+        commandBuffer = (CommandBuffer*)Allocate<CommandBufferVal>(m_Device.GetAllocationCallbacks(), m_Device, commandBufferImpl, this);
+
+    return result;
+}
+
+NRI_INLINE Result CommandAllocatorVal::CreateSecondaryCommandBuffer(CommandBuffer*& commandBuffer) {
+    CommandBuffer* commandBufferImpl;
+    const Result result = GetSecondaryCommandBufferInterfaceImpl().CreateSecondaryCommandBuffer(*GetImpl(), commandBufferImpl);
+
+    commandBuffer = nullptr;
+    if (result == Result::SUCCESS)
+        commandBuffer = (CommandBuffer*)Allocate<CommandBufferVal>(m_Device.GetAllocationCallbacks(), m_Device, commandBufferImpl, this, true);
 
     return result;
 }
 
 NRI_INLINE void CommandAllocatorVal::Reset() {
     GetCoreInterfaceImpl().ResetCommandAllocator(*GetImpl());
+
+    m_ResetIndex++;
 }
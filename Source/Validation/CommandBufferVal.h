@@ -4,21 +4,66 @@
 
 namespace nri {
 
+struct CommandAllocatorVal;
 struct DescriptorVal;
 struct PipelineVal;
 struct PipelineLayoutVal;
 
+constexpr uint32_t SPLIT_BARRIER_INVALID_INDEX = uint32_t(-1); // returned by "CmdBeginBarrier" on validation failure
+
+struct SplitBarrierVal {
+    uint64_t descHash;
+    bool isEnded;
+};
+
 struct CommandBufferVal final : public ObjectVal {
-    CommandBufferVal(DeviceVal& device, CommandBuffer* commandBuffer, bool isWrapped)
+    CommandBufferVal(DeviceVal& device, CommandBuffer* commandBuffer, CommandAllocatorVal* commandAllocator, bool isSecondary = false) // "commandAllocator = nullptr" for wrapped command buffers
         : ObjectVal(device, commandBuffer)
-        , m_IsRecordingStarted(isWrapped)
-        , m_IsWrapped(isWrapped) {
+        , m_CommandAllocator(commandAllocator)
+        , m_SplitBarriers(device.GetStdAllocator())
+        , m_ResetIndex(commandAllocator ? commandAllocator->GetResetIndex() : 0)
+        , m_IsRecordingStarted(commandAllocator == nullptr)
+        , m_IsWrapped(commandAllocator == nullptr)
+        , m_IsSecondary(isSecondary) {
     }
 
     inline CommandBuffer* GetImpl() const {
         return (CommandBuffer*)m_Impl;
     }
 
+    inline bool IsSecondary() const {
+        return m_IsSecondary;
+    }
+
+    inline bool IsRecordingStarted() const {
+        return m_IsRecordingStarted;
+    }
+
+    inline bool IsRenderingInherited() const {
+        return m_IsRenderingInherited;
+    }
+
+    inline bool IsWrapped() const {
+        return m_IsWrapped;
+    }
+
+    inline bool IsReusable() const {
+        return m_IsReusable;
+    }
+
+    inline bool IsSubmitted() const {
+        return m_IsSubmitted;
+    }
+
+    inline void SetSubmitted() {
+        m_IsSubmitted = !m_IsWrapped;
+    }
+
+    // Recorded commands are invalidated by "ResetCommandAllocator"
+    inline bool IsResetByCommandAllocator() const {
+        return m_CommandAllocator && m_CommandAllocator->GetResetIndex() != m_ResetIndex;
+    }
+
     inline void* GetNativeObject() const {
         return GetCoreInterfaceImpl().GetCommandBufferNativeObject(*GetImpl());
     }
@@ -35,7 +80,8 @@ struct CommandBufferVal final : public ObjectVal {
     // NRI
     //================================================================================================================
 
-    Result Begin(const DescriptorPool* descriptorPool);
+    Result Begin(const DescriptorPool* descriptorPool, bool isReusable = false);
+    Result BeginSecondary(const AttachmentsDesc* attachmentsDesc, const DescriptorPool* descriptorPool);
     Result End();
     void SetViewports(const Viewport* viewports, uint32_t viewportNum);
     void SetScissors(const Rect* rects, uint32_t rectNum);
@@ -48,6 +94,7 @@ struct CommandBufferVal final : public ObjectVal {
     void ClearAttachments(const ClearDesc* clearDescs, uint32_t clearDescNum, const Rect* rects, uint32_t rectNum);
     void ClearStorage(const ClearStorageDesc& clearDesc);
     void BeginRendering(const AttachmentsDesc& attachmentsDesc);
+    void BeginRenderingSecondary(const AttachmentsDesc& attachmentsDesc);
     void EndRendering();
     void SetVertexBuffers(uint32_t baseSlot, const VertexBufferDesc* vertexBufferDescs, uint32_t vertexBufferNum);
     void SetIndexBuffer(const Buffer& buffer, uint64_t offset, IndexType indexType);
@@ -59,13 +106,20 @@ struct CommandBufferVal final : public ObjectVal {
     void SetRootDescriptor(uint32_t rootDescriptorIndex, Descriptor& descriptor);
     void Draw(const DrawDesc& drawDesc);
     void DrawIndexed(const DrawIndexedDesc& drawIndexedDesc);
+    void DrawMulti(const DrawDesc* drawDescs, uint32_t drawNum);
+    void DrawIndexedMulti(const DrawIndexedDesc* drawIndexedDescs, uint32_t drawNum);
     void DrawIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset);
     void DrawIndexedIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset);
     void CopyBuffer(Buffer& dstBuffer, uint64_t dstOffset, const Buffer& srcBuffer, uint64_t srcOffset, uint64_t size);
     void CopyTexture(Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion);
     void UploadBufferToTexture(Texture& dstTexture, const TextureRegionDesc& dstRegion, const Buffer& srcBuffer, const TextureDataLayoutDesc& srcDataLayout);
     void ReadbackTextureToBuffer(Buffer& dstBuffer, const TextureDataLayoutDesc& dstDataLayout, const Texture& srcTexture, const TextureRegionDesc& srcRegion);
+    void CopyBufferMulti(Buffer& dstBuffer, const Buffer& srcBuffer, const BufferCopyRegionDesc* regions, uint32_t regionNum);
+    void CopyTextureMulti(Texture& dstTexture, const Texture& srcTexture, const TextureCopyRegionDesc* regions, uint32_t regionNum);
+    void UploadBufferToTextureMulti(Texture& dstTexture, const Buffer& srcBuffer, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum);
+    void ReadbackTextureToBufferMulti(Buffer& dstBuffer, const Texture& srcTexture, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum);
     void ZeroBuffer(Buffer& buffer, uint64_t offset, uint64_t size);
+    void UpdateBuffer(Buffer& buffer, uint64_t offset, const void* data, uint32_t size);
     void ResolveTexture(Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion);
     void Dispatch(const DispatchDesc& dispatchDesc);
     void DispatchIndirect(const Buffer& buffer, uint64_t offset);
@@ -88,19 +142,37 @@ struct CommandBufferVal final : public ObjectVal {
     void DispatchRaysIndirect(const Buffer& buffer, uint64_t offset);
     void DrawMeshTasks(const DrawMeshTasksDesc& drawMeshTasksDesc);
     void DrawMeshTasksIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset);
+    void ExecuteCommands(const CommandBuffer* const* secondaryCommandBuffers, uint32_t secondaryCommandBufferNum);
+    uint32_t BeginBarrier(const BarrierGroupDesc& barrierGroupDesc);
+    void EndBarrier(const BarrierGroupDesc& barrierGroupDesc, uint32_t splitBarrierIndex);
+    void ExecuteGeneratedCommands(const GeneratedCommandsDesc& generatedCommandsDesc);
+    void BeginConditionalRendering(const Buffer& buffer, uint64_t offset, bool inverted);
+    void EndConditionalRendering();
+    void GetStats(CommandBufferStats& commandBufferStats);
 
 private:
     void ValidateReadonlyDepthStencil();
+    void SetAttachments(const AttachmentsDesc& attachmentsDesc);
 
     std::array<DescriptorVal*, 16> m_RenderTargets = {};
     DescriptorVal* m_DepthStencil = nullptr;
     PipelineLayoutVal* m_PipelineLayout = nullptr;
     PipelineVal* m_Pipeline = nullptr;
+    CommandAllocatorVal* m_CommandAllocator = nullptr;
+    Vector<SplitBarrierVal> m_SplitBarriers; // indexed by "splitBarrierIndex"
+    uint32_t m_ResetIndex = 0;
     uint32_t m_RenderTargetNum = 0;
     int32_t m_AnnotationStack = 0;
     bool m_IsRecordingStarted = false;
     bool m_IsWrapped = false;
     bool m_IsRenderPass = false;
+    bool m_IsRenderPassSecondary = false;
+    bool m_IsRenderingInherited = false;
+    bool m_IsSecondary = false;
+    bool m_IsReusable = false;
+    bool m_IsSubmitted = false;
+    bool m_IsConditionalRendering = false;
+    bool m_IsConditionalRenderingInRenderPass = false;
 };
 
 } // namespace nri
@@ -28,23 +28,232 @@ static bool ValidateTextureBarrierDesc(const DeviceVal& device, uint32_t i, cons
     return true;
 }
 
-NRI_INLINE Result CommandBufferVal::Begin(const DescriptorPool* descriptorPool) {
+static bool ValidateBarrierGroupDesc(const DeviceVal& device, const BarrierGroupDesc& barrierGroupDesc) {
+    for (uint32_t i = 0; i < barrierGroupDesc.bufferNum; i++) {
+        if (!ValidateBufferBarrierDesc(device, i, barrierGroupDesc.buffers[i]))
+            return false;
+    }
+
+    for (uint32_t i = 0; i < barrierGroupDesc.textureNum; i++) {
+        if (!ValidateTextureBarrierDesc(device, i, barrierGroupDesc.textures[i]))
+            return false;
+    }
+
+    return true;
+}
+
+static BarrierGroupDesc GetBarrierGroupDescImpl(const BarrierGroupDesc& barrierGroupDesc, BufferBarrierDesc* buffers, TextureBarrierDesc* textures) {
+    memcpy(buffers, barrierGroupDesc.buffers, sizeof(BufferBarrierDesc) * barrierGroupDesc.bufferNum);
+    for (uint32_t i = 0; i < barrierGroupDesc.bufferNum; i++)
+        buffers[i].buffer = NRI_GET_IMPL(Buffer, barrierGroupDesc.buffers[i].buffer);
+
+    memcpy(textures, barrierGroupDesc.textures, sizeof(TextureBarrierDesc) * barrierGroupDesc.textureNum);
+    for (uint32_t i = 0; i < barrierGroupDesc.textureNum; i++) {
+        textures[i].texture = NRI_GET_IMPL(Texture, barrierGroupDesc.textures[i].texture);
+        textures[i].srcQueue = NRI_GET_IMPL(Queue, barrierGroupDesc.textures[i].srcQueue);
+        textures[i].dstQueue = NRI_GET_IMPL(Queue, barrierGroupDesc.textures[i].dstQueue);
+    }
+
+    BarrierGroupDesc barrierGroupDescImpl = barrierGroupDesc;
+    barrierGroupDescImpl.buffers = buffers;
+    barrierGroupDescImpl.textures = textures;
+
+    return barrierGroupDescImpl;
+}
+
+static inline void HashCombine(uint64_t& hash, uint64_t value) {
+    hash ^= value + 0x9E3779B97F4A7C15ull + (hash << 6) + (hash >> 2);
+}
+
+static inline void HashAccessStage(uint64_t& hash, const AccessStage& accessStage) {
+    HashCombine(hash, (uint64_t)accessStage.access);
+    HashCombine(hash, (uint64_t)accessStage.stages);
+}
+
+static inline void HashAccessLayoutStage(uint64_t& hash, const AccessLayoutStage& accessLayoutStage) {
+    HashCombine(hash, (uint64_t)accessLayoutStage.access);
+    HashCombine(hash, (uint64_t)accessLayoutStage.layout);
+    HashCombine(hash, (uint64_t)accessLayoutStage.stages);
+}
+
+// Field by field, since padding bytes are undefined
+static uint64_t GetBarrierGroupDescHash(const BarrierGroupDesc& barrierGroupDesc) {
+    uint64_t hash = 0;
+
+    HashCombine(hash, barrierGroupDesc.globalNum);
+    for (uint32_t i = 0; i < barrierGroupDesc.globalNum; i++) {
+        const GlobalBarrierDesc& barrier = barrierGroupDesc.globals[i];
+        HashAccessStage(hash, barrier.before);
+        HashAccessStage(hash, barrier.after);
+    }
+
+    HashCombine(hash, barrierGroupDesc.bufferNum);
+    for (uint32_t i = 0; i < barrierGroupDesc.bufferNum; i++) {
+        const BufferBarrierDesc& barrier = barrierGroupDesc.buffers[i];
+        HashCombine(hash, (uint64_t)(size_t)barrier.buffer);
+        HashAccessStage(hash, barrier.before);
+        HashAccessStage(hash, barrier.after);
+    }
+
+    HashCombine(hash, barrierGroupDesc.textureNum);
+    for (uint32_t i = 0; i < barrierGroupDesc.textureNum; i++) {
+        const TextureBarrierDesc& barrier = barrierGroupDesc.textures[i];
+        HashCombine(hash, (uint64_t)(size_t)barrier.texture);
+        HashAccessLayoutStage(hash, barrier.before);
+        HashAccessLayoutStage(hash, barrier.after);
+        HashCombine(hash, barrier.mipOffset);
+        HashCombine(hash, barrier.mipNum);
+        HashCombine(hash, barrier.layerOffset);
+        HashCombine(hash, barrier.layerNum);
+        HashCombine(hash, (uint64_t)barrier.planes);
+        HashCombine(hash, (uint64_t)(size_t)barrier.srcQueue);
+        HashCombine(hash, (uint64_t)(size_t)barrier.dstQueue);
+    }
+
+    return hash;
+}
+
+static bool ValidateAttachmentOpsDesc(const DeviceVal& device, const char* name, uint32_t i, const AttachmentOpsDesc& attachmentOpsDesc, const DescriptorVal& attachment, bool isColor) {
+    RETURN_ON_FAILURE(&device, attachmentOpsDesc.loadOp < LoadOp::MAX_NUM, false, "'%s[%u].loadOp' is invalid", name, i);
+    RETURN_ON_FAILURE(&device, attachmentOpsDesc.storeOp < StoreOp::MAX_NUM, false, "'%s[%u].storeOp' is invalid", name, i);
+
+    if (attachmentOpsDesc.resolveDst) {
+        const DescriptorVal& resolveDst = *(DescriptorVal*)attachmentOpsDesc.resolveDst;
+        bool isInteger = GetFormatProps(attachment.GetFormat()).isInteger;
+
+        RETURN_ON_FAILURE(&device, device.GetDesc().features.renderingResolve, false, "'%s[%u].resolveDst' requires 'features.renderingResolve'", name, i);
+        RETURN_ON_FAILURE(&device, attachmentOpsDesc.resolveOp < ResolveOp::MAX_NUM, false, "'%s[%u].resolveOp' is invalid", name, i);
+        RETURN_ON_FAILURE(&device, !isColor || isInteger || attachmentOpsDesc.resolveOp != ResolveOp::SAMPLE_ZERO, false, "'%s[%u].resolveOp' can't be 'SAMPLE_ZERO' for float and normalized color formats", name, i);
+        RETURN_ON_FAILURE(&device, isColor ? resolveDst.IsColorAttachment() : resolveDst.IsDepthStencilAttachment(), false, "'%s[%u].resolveDst' is not a %s attachment", name, i, isColor ? "color" : "depth-stencil");
+        RETURN_ON_FAILURE(&device, attachment.GetSampleNum() > 1, false, "'%s[%u].resolveDst' is provided, but the attachment is not multisampled", name, i);
+        RETURN_ON_FAILURE(&device, resolveDst.GetSampleNum() == 1, false, "'%s[%u].resolveDst' must be single-sampled", name, i);
+        RETURN_ON_FAILURE(&device, resolveDst.GetFormat() == attachment.GetFormat(), false, "'%s[%u].resolveDst' format doesn't match the attachment format", name, i);
+        RETURN_ON_FAILURE(&device, resolveDst.GetWidth() == attachment.GetWidth() && resolveDst.GetHeight() == attachment.GetHeight(), false,
+            "'%s[%u].resolveDst' extent (%ux%u) doesn't match the attachment extent (%ux%u)", name, i, resolveDst.GetWidth(), resolveDst.GetHeight(), attachment.GetWidth(), attachment.GetHeight());
+    }
+
+    return true;
+}
+
+static bool ValidateAttachmentsDesc(const DeviceVal& device, const AttachmentsDesc& attachmentsDesc) {
+    if (attachmentsDesc.colorOps) {
+        for (uint32_t i = 0; i < attachmentsDesc.colorNum; i++) {
+            RETURN_ON_FAILURE(&device, attachmentsDesc.colors && attachmentsDesc.colors[i], false, "'colorOps' is provided, but 'colors[%u]' is NULL", i);
+
+            if (!ValidateAttachmentOpsDesc(device, "colorOps", i, attachmentsDesc.colorOps[i], *(DescriptorVal*)attachmentsDesc.colors[i], true))
+                return false;
+        }
+    }
+
+    if (attachmentsDesc.depthStencilOps) {
+        RETURN_ON_FAILURE(&device, attachmentsDesc.depthStencil, false, "'depthStencilOps' is provided, but 'depthStencil' is NULL");
+
+        if (!ValidateAttachmentOpsDesc(device, "depthStencilOps", 0, *attachmentsDesc.depthStencilOps, *(DescriptorVal*)attachmentsDesc.depthStencil, false))
+            return false;
+    }
+
+    return true;
+}
+
+static AttachmentsDesc GetAttachmentsDescImpl(const AttachmentsDesc& attachmentsDesc, Descriptor** colors, AttachmentOpsDesc* colorOps, AttachmentOpsDesc& depthStencilOps) {
+    for (uint32_t i = 0; i < attachmentsDesc.colorNum; i++)
+        colors[i] = NRI_GET_IMPL(Descriptor, attachmentsDesc.colors[i]);
+
+    AttachmentsDesc attachmentsDescImpl = attachmentsDesc;
+    attachmentsDescImpl.depthStencil = NRI_GET_IMPL(Descriptor, attachmentsDesc.depthStencil);
+    attachmentsDescImpl.shadingRate = NRI_GET_IMPL(Descriptor, attachmentsDesc.shadingRate);
+    attachmentsDescImpl.colors = colors;
+
+    if (attachmentsDesc.colorOps) {
+        for (uint32_t i = 0; i < attachmentsDesc.colorNum; i++) {
+            colorOps[i] = attachmentsDesc.colorOps[i];
+            colorOps[i].resolveDst = NRI_GET_IMPL(Descriptor, attachmentsDesc.colorOps[i].resolveDst);
+        }
+
+        attachmentsDescImpl.colorOps = colorOps;
+    }
+
+    if (attachmentsDesc.depthStencilOps) {
+        depthStencilOps = *attachmentsDesc.depthStencilOps;
+        depthStencilOps.resolveDst = NRI_GET_IMPL(Descriptor, attachmentsDesc.depthStencilOps->resolveDst);
+
+        attachmentsDescImpl.depthStencilOps = &depthStencilOps;
+    }
+
+    return attachmentsDescImpl;
+}
+
+NRI_INLINE Result CommandBufferVal::Begin(const DescriptorPool* descriptorPool, bool isReusable) {
     RETURN_ON_FAILURE(&m_Device, !m_IsRecordingStarted, Result::FAILURE, "already in the recording state");
 
     DescriptorPool* descriptorPoolImpl = NRI_GET_IMPL(DescriptorPool, descriptorPool);
 
-    Result result = GetCoreInterfaceImpl().BeginCommandBuffer(*GetImpl(), descriptorPoolImpl);
-    if (result == Result::SUCCESS)
+    Result result;
+    if (isReusable)
+        result = GetCoreInterfaceImpl().BeginReusableCommandBuffer(*GetImpl(), descriptorPoolImpl);
+    else
+        result = GetCoreInterfaceImpl().BeginCommandBuffer(*GetImpl(), descriptorPoolImpl);
+
+    if (result == Result::SUCCESS) {
         m_IsRecordingStarted = true;
+        m_IsReusable = isReusable;
+        m_IsSubmitted = false;
+        m_ResetIndex = m_CommandAllocator ? m_CommandAllocator->GetResetIndex() : 0;
+    }
 
     m_Pipeline = nullptr;
     m_PipelineLayout = nullptr;
+    m_SplitBarriers.clear();
+    m_IsRenderingInherited = false;
+    m_IsConditionalRendering = false;
 
     ResetAttachments();
 
     return result;
 }
 
+NRI_INLINE Result CommandBufferVal::BeginSecondary(const AttachmentsDesc* attachmentsDesc, const DescriptorPool* descriptorPool) {
+    RETURN_ON_FAILURE(&m_Device, !m_IsRecordingStarted, Result::FAILURE, "already in the recording state");
+    RETURN_ON_FAILURE(&m_Device, m_IsSecondary, Result::FAILURE, "'BeginSecondaryCommandBuffer' can't be used with a primary command buffer");
+
+    DescriptorPool* descriptorPoolImpl = NRI_GET_IMPL(DescriptorPool, descriptorPool);
+
+    uint32_t colorNum = attachmentsDesc ? attachmentsDesc->colorNum : 0;
+    Scratch<Descriptor*> colors = AllocateScratch(m_Device, Descriptor*, colorNum);
+    for (uint32_t i = 0; i < colorNum; i++)
+        colors[i] = NRI_GET_IMPL(Descriptor, attachmentsDesc->colors[i]);
+
+    AttachmentsDesc attachmentsDescImpl = {};
+    if (attachmentsDesc) {
+        attachmentsDescImpl = *attachmentsDesc;
+        attachmentsDescImpl.depthStencil = NRI_GET_IMPL(Descriptor, attachmentsDesc->depthStencil);
+        attachmentsDescImpl.shadingRate = NRI_GET_IMPL(Descriptor, attachmentsDesc->shadingRate);
+        attachmentsDescImpl.colors = colors;
+        attachmentsDescImpl.colorOps = nullptr; // only formats are inherited
+        attachmentsDescImpl.depthStencilOps = nullptr;
+    }
+
+    Result result = GetSecondaryCommandBufferInterfaceImpl().BeginSecondaryCommandBuffer(*GetImpl(), attachmentsDesc ? &attachmentsDescImpl : nullptr, descriptorPoolImpl);
+    if (result == Result::SUCCESS) {
+        m_IsRecordingStarted = true;
+        m_ResetIndex = m_CommandAllocator ? m_CommandAllocator->GetResetIndex() : 0;
+    }
+
+    m_Pipeline = nullptr;
+    m_PipelineLayout = nullptr;
+    m_SplitBarriers.clear();
+    m_IsRenderingInherited = attachmentsDesc != nullptr;
+    m_IsConditionalRendering = false;
+    m_IsRenderPass = m_IsRenderingInherited;
+
+    if (attachmentsDesc)
+        SetAttachments(*attachmentsDesc);
+    else
+        ResetAttachments();
+
+    return result;
+}
+
 NRI_INLINE Result CommandBufferVal::End() {
     RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, Result::FAILURE, "not in the recording state");
 
@@ -53,10 +262,21 @@ NRI_INLINE Result CommandBufferVal::End() {
     else if (m_AnnotationStack < 0)
         REPORT_ERROR(&m_Device, "'CmdEndAnnotation' is called more times than 'CmdBeginAnnotation'");
 
+    for (size_t i = 0; i < m_SplitBarriers.size(); i++) {
+        if (!m_SplitBarriers[i].isEnded)
+            REPORT_ERROR(&m_Device, "'CmdBeginBarrier' is called without 'CmdEndBarrier' ('splitBarrierIndex=%u')", (uint32_t)i);
+    }
+
+    if (m_IsConditionalRendering)
+        REPORT_ERROR(&m_Device, "'CmdBeginConditionalRendering' is called without 'CmdEndConditionalRendering'");
+
     Result result = GetCoreInterfaceImpl().EndCommandBuffer(*GetImpl());
     if (result == Result::SUCCESS)
         m_IsRecordingStarted = m_IsWrapped;
 
+    if (m_IsRenderingInherited)
+        m_IsRenderPass = false;
+
     return result;
 }
 
@@ -130,6 +350,7 @@ NRI_INLINE void CommandBufferVal::SetDepthBias(const DepthBiasDesc& depthBiasDes
 NRI_INLINE void CommandBufferVal::ClearAttachments(const ClearDesc* clearDescs, uint32_t clearDescNum, const Rect* rects, uint32_t rectNum) {
     RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     RETURN_ON_FAILURE(&m_Device, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
+    RETURN_ON_FAILURE(&m_Device, !m_IsRenderPassSecondary, ReturnVoid(), "can't be called inside 'CmdBeginRenderingSecondary/CmdEndRendering', only 'CmdExecuteCommands' is allowed");
 
     const DeviceDesc& deviceDesc = m_Device.GetDesc();
     for (uint32_t i = 0; i < clearDescNum; i++) {
@@ -172,40 +393,56 @@ NRI_INLINE void CommandBufferVal::BeginRendering(const AttachmentsDesc& attachme
     if (attachmentsDesc.shadingRate)
         RETURN_ON_FAILURE(&m_Device, deviceDesc.tiers.shadingRate, ReturnVoid(), "'tiers.shadingRate >= 2' required");
 
-    Scratch<Descriptor*> colors = AllocateScratch(m_Device, Descriptor*, attachmentsDesc.colorNum);
-    for (uint32_t i = 0; i < attachmentsDesc.colorNum; i++)
-        colors[i] = NRI_GET_IMPL(Descriptor, attachmentsDesc.colors[i]);
+    if (!ValidateAttachmentsDesc(m_Device, attachmentsDesc))
+        return;
 
-    auto attachmentsDescImpl = attachmentsDesc;
-    attachmentsDescImpl.depthStencil = NRI_GET_IMPL(Descriptor, attachmentsDesc.depthStencil);
-    attachmentsDescImpl.shadingRate = NRI_GET_IMPL(Descriptor, attachmentsDesc.shadingRate);
-    attachmentsDescImpl.colors = colors;
-    attachmentsDescImpl.colorNum = attachmentsDesc.colorNum;
+    Scratch<Descriptor*> colors = AllocateScratch(m_Device, Descriptor*, attachmentsDesc.colorNum);
+    Scratch<AttachmentOpsDesc> colorOps = AllocateScratch(m_Device, AttachmentOpsDesc, attachmentsDesc.colorOps ? attachmentsDesc.colorNum : 0);
+    AttachmentOpsDesc depthStencilOps = {};
+    AttachmentsDesc attachmentsDescImpl = GetAttachmentsDescImpl(attachmentsDesc, colors, colorOps, depthStencilOps);
 
     m_IsRenderPass = true;
-    m_RenderTargetNum = attachmentsDesc.colors ? attachmentsDesc.colorNum : 0;
-
-    size_t i = 0;
-    for (; i < m_RenderTargetNum; i++)
-        m_RenderTargets[i] = (DescriptorVal*)attachmentsDesc.colors[i];
-    for (; i < m_RenderTargets.size(); i++)
-        m_RenderTargets[i] = nullptr;
-
-    if (attachmentsDesc.depthStencil)
-        m_DepthStencil = (DescriptorVal*)attachmentsDesc.depthStencil;
-    else
-        m_DepthStencil = nullptr;
+    m_IsRenderPassSecondary = false;
 
+    SetAttachments(attachmentsDesc);
     ValidateReadonlyDepthStencil();
 
     GetCoreInterfaceImpl().CmdBeginRendering(*GetImpl(), attachmentsDescImpl);
 }
 
+NRI_INLINE void CommandBufferVal::BeginRenderingSecondary(const AttachmentsDesc& attachmentsDesc) {
+    RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "'CmdBeginRendering' has been already called");
+    RETURN_ON_FAILURE(&m_Device, !m_IsSecondary, ReturnVoid(), "can't be called in a secondary command buffer");
+
+    const DeviceDesc& deviceDesc = m_Device.GetDesc();
+    if (attachmentsDesc.shadingRate)
+        RETURN_ON_FAILURE(&m_Device, deviceDesc.tiers.shadingRate, ReturnVoid(), "'tiers.shadingRate >= 2' required");
+
+    if (!ValidateAttachmentsDesc(m_Device, attachmentsDesc))
+        return;
+
+    Scratch<Descriptor*> colors = AllocateScratch(m_Device, Descriptor*, attachmentsDesc.colorNum);
+    Scratch<AttachmentOpsDesc> colorOps = AllocateScratch(m_Device, AttachmentOpsDesc, attachmentsDesc.colorOps ? attachmentsDesc.colorNum : 0);
+    AttachmentOpsDesc depthStencilOps = {};
+    AttachmentsDesc attachmentsDescImpl = GetAttachmentsDescImpl(attachmentsDesc, colors, colorOps, depthStencilOps);
+
+    m_IsRenderPass = true;
+    m_IsRenderPassSecondary = true;
+
+    SetAttachments(attachmentsDesc);
+
+    GetSecondaryCommandBufferInterfaceImpl().CmdBeginRenderingSecondary(*GetImpl(), attachmentsDescImpl);
+}
+
 NRI_INLINE void CommandBufferVal::EndRendering() {
     RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     RETURN_ON_FAILURE(&m_Device, m_IsRenderPass, ReturnVoid(), "'CmdBeginRendering' has not been called");
+    RETURN_ON_FAILURE(&m_Device, !m_IsRenderingInherited, ReturnVoid(), "rendering is inherited and can't be ended in a secondary command buffer");
+    RETURN_ON_FAILURE(&m_Device, !m_IsConditionalRendering || !m_IsConditionalRenderingInRenderPass, ReturnVoid(), "conditional rendering, begun inside 'CmdBeginRendering/CmdEndRendering', must be ended before 'CmdEndRendering'");
 
     m_IsRenderPass = false;
+    m_IsRenderPassSecondary = false;
 
     ResetAttachments();
 
@@ -297,6 +534,7 @@ NRI_INLINE void CommandBufferVal::SetRootDescriptor(uint32_t rootDescriptorIndex
 NRI_INLINE void CommandBufferVal::Draw(const DrawDesc& drawDesc) {
     RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     RETURN_ON_FAILURE(&m_Device, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
+    RETURN_ON_FAILURE(&m_Device, !m_IsRenderPassSecondary, ReturnVoid(), "can't be called inside 'CmdBeginRenderingSecondary/CmdEndRendering', only 'CmdExecuteCommands' is allowed");
 
     GetCoreInterfaceImpl().CmdDraw(*GetImpl(), drawDesc);
 }
@@ -304,15 +542,35 @@ NRI_INLINE void CommandBufferVal::Draw(const DrawDesc& drawDesc) {
 NRI_INLINE void CommandBufferVal::DrawIndexed(const DrawIndexedDesc& drawIndexedDesc) {
     RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     RETURN_ON_FAILURE(&m_Device, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
+    RETURN_ON_FAILURE(&m_Device, !m_IsRenderPassSecondary, ReturnVoid(), "can't be called inside 'CmdBeginRenderingSecondary/CmdEndRendering', only 'CmdExecuteCommands' is allowed");
 
     GetCoreInterfaceImpl().CmdDrawIndexed(*GetImpl(), drawIndexedDesc);
 }
 
+NRI_INLINE void CommandBufferVal::DrawMulti(const DrawDesc* drawDescs, uint32_t drawNum) {
+    RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    RETURN_ON_FAILURE(&m_Device, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
+    RETURN_ON_FAILURE(&m_Device, !m_IsRenderPassSecondary, ReturnVoid(), "can't be called inside 'CmdBeginRenderingSecondary/CmdEndRendering', only 'CmdExecuteCommands' is allowed");
+    RETURN_ON_FAILURE(&m_Device, drawDescs || !drawNum, ReturnVoid(), "'drawDescs' is NULL");
+
+    GetCoreInterfaceImpl().CmdDrawMulti(*GetImpl(), drawDescs, drawNum);
+}
+
+NRI_INLINE void CommandBufferVal::DrawIndexedMulti(const DrawIndexedDesc* drawIndexedDescs, uint32_t drawNum) {
+    RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    RETURN_ON_FAILURE(&m_Device, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
+    RETURN_ON_FAILURE(&m_Device, !m_IsRenderPassSecondary, ReturnVoid(), "can't be called inside 'CmdBeginRenderingSecondary/CmdEndRendering', only 'CmdExecuteCommands' is allowed");
+    RETURN_ON_FAILURE(&m_Device, drawIndexedDescs || !drawNum, ReturnVoid(), "'drawIndexedDescs' is NULL");
+
+    GetCoreInterfaceImpl().CmdDrawIndexedMulti(*GetImpl(), drawIndexedDescs, drawNum);
+}
+
 NRI_INLINE void CommandBufferVal::DrawIndirect(const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
     const DeviceDesc& deviceDesc = m_Device.GetDesc();
 
     RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     RETURN_ON_FAILURE(&m_Device, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
+    RETURN_ON_FAILURE(&m_Device, !m_IsRenderPassSecondary, ReturnVoid(), "can't be called inside 'CmdBeginRenderingSecondary/CmdEndRendering', only 'CmdExecuteCommands' is allowed");
     RETURN_ON_FAILURE(&m_Device, !countBuffer || deviceDesc.features.drawIndirectCount, ReturnVoid(), "'countBuffer' is not supported");
 
     Buffer* bufferImpl = NRI_GET_IMPL(Buffer, &buffer);
@@ -326,6 +584,7 @@ NRI_INLINE void CommandBufferVal::DrawIndexedIndirect(const Buffer& buffer, uint
 
     RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     RETURN_ON_FAILURE(&m_Device, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
+    RETURN_ON_FAILURE(&m_Device, !m_IsRenderPassSecondary, ReturnVoid(), "can't be called inside 'CmdBeginRenderingSecondary/CmdEndRendering', only 'CmdExecuteCommands' is allowed");
     RETURN_ON_FAILURE(&m_Device, !countBuffer || deviceDesc.features.drawIndirectCount, ReturnVoid(), "'countBuffer' is not supported");
 
     Buffer* bufferImpl = NRI_GET_IMPL(Buffer, &buffer);
@@ -395,6 +654,65 @@ NRI_INLINE void CommandBufferVal::ReadbackTextureToBuffer(Buffer& dstBuffer, con
     GetCoreInterfaceImpl().CmdReadbackTextureToBuffer(*GetImpl(), *dstBufferImpl, dstDataLayout, *srcTextureImpl, srcRegion);
 }
 
+NRI_INLINE void CommandBufferVal::CopyBufferMulti(Buffer& dstBuffer, const Buffer& srcBuffer, const BufferCopyRegionDesc* regions, uint32_t regionNum) {
+    const BufferDesc& dstDesc = ((BufferVal&)dstBuffer).GetDesc();
+    const BufferDesc& srcDesc = ((BufferVal&)srcBuffer).GetDesc();
+
+    RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
+    RETURN_ON_FAILURE(&m_Device, regions || !regionNum, ReturnVoid(), "'regions' is NULL");
+
+    for (uint32_t i = 0; i < regionNum; i++) {
+        const BufferCopyRegionDesc& region = regions[i];
+
+        if (region.size == WHOLE_SIZE) {
+            RETURN_ON_FAILURE(&m_Device, region.dstOffset == 0 && region.srcOffset == 0, ReturnVoid(), "'regions[%u].size' is 'WHOLE_SIZE', but offsets are not 0", i);
+            RETURN_ON_FAILURE(&m_Device, dstDesc.size == srcDesc.size, ReturnVoid(), "'regions[%u].size' is 'WHOLE_SIZE', but 'dstBuffer' and 'srcBuffer' have different sizes", i);
+        } else {
+            RETURN_ON_FAILURE(&m_Device, region.srcOffset + region.size <= srcDesc.size, ReturnVoid(), "'regions[%u].srcOffset + size' > srcBuffer.size", i);
+            RETURN_ON_FAILURE(&m_Device, region.dstOffset + region.size <= dstDesc.size, ReturnVoid(), "'regions[%u].dstOffset + size' > dstBuffer.size", i);
+        }
+    }
+
+    Buffer* dstBufferImpl = NRI_GET_IMPL(Buffer, &dstBuffer);
+    Buffer* srcBufferImpl = NRI_GET_IMPL(Buffer, &srcBuffer);
+
+    GetCoreInterfaceImpl().CmdCopyBufferMulti(*GetImpl(), *dstBufferImpl, *srcBufferImpl, regions, regionNum);
+}
+
+NRI_INLINE void CommandBufferVal::CopyTextureMulti(Texture& dstTexture, const Texture& srcTexture, const TextureCopyRegionDesc* regions, uint32_t regionNum) {
+    RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
+    RETURN_ON_FAILURE(&m_Device, regions || !regionNum, ReturnVoid(), "'regions' is NULL");
+
+    Texture* dstTextureImpl = NRI_GET_IMPL(Texture, &dstTexture);
+    Texture* srcTextureImpl = NRI_GET_IMPL(Texture, &srcTexture);
+
+    GetCoreInterfaceImpl().CmdCopyTextureMulti(*GetImpl(), *dstTextureImpl, *srcTextureImpl, regions, regionNum);
+}
+
+NRI_INLINE void CommandBufferVal::UploadBufferToTextureMulti(Texture& dstTexture, const Buffer& srcBuffer, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum) {
+    RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
+    RETURN_ON_FAILURE(&m_Device, regions || !regionNum, ReturnVoid(), "'regions' is NULL");
+
+    Texture* dstTextureImpl = NRI_GET_IMPL(Texture, &dstTexture);
+    Buffer* srcBufferImpl = NRI_GET_IMPL(Buffer, &srcBuffer);
+
+    GetCoreInterfaceImpl().CmdUploadBufferToTextureMulti(*GetImpl(), *dstTextureImpl, *srcBufferImpl, regions, regionNum);
+}
+
+NRI_INLINE void CommandBufferVal::ReadbackTextureToBufferMulti(Buffer& dstBuffer, const Texture& srcTexture, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum) {
+    RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
+    RETURN_ON_FAILURE(&m_Device, regions || !regionNum, ReturnVoid(), "'regions' is NULL");
+
+    Buffer* dstBufferImpl = NRI_GET_IMPL(Buffer, &dstBuffer);
+    Texture* srcTextureImpl = NRI_GET_IMPL(Texture, &srcTexture);
+
+    GetCoreInterfaceImpl().CmdReadbackTextureToBufferMulti(*GetImpl(), *dstBufferImpl, *srcTextureImpl, regions, regionNum);
+}
+
 NRI_INLINE void CommandBufferVal::ZeroBuffer(Buffer& buffer, uint64_t offset, uint64_t size) {
     RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     if (size == WHOLE_SIZE) {
@@ -411,6 +729,21 @@ NRI_INLINE void CommandBufferVal::ZeroBuffer(Buffer& buffer, uint64_t offset, ui
     GetCoreInterfaceImpl().CmdZeroBuffer(*GetImpl(), *bufferImpl, offset, size);
 }
 
+NRI_INLINE void CommandBufferVal::UpdateBuffer(Buffer& buffer, uint64_t offset, const void* data, uint32_t size) {
+    const BufferDesc& bufferDesc = ((BufferVal&)buffer).GetDesc();
+
+    RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
+    RETURN_ON_FAILURE(&m_Device, data, ReturnVoid(), "'data' is NULL");
+    RETURN_ON_FAILURE(&m_Device, size != 0 && size <= 65536, ReturnVoid(), "'size=%u' must be in range [4; 65536]", size);
+    RETURN_ON_FAILURE(&m_Device, (offset % 4) == 0 && (size % 4) == 0, ReturnVoid(), "'offset' and 'size' must be multiples of 4");
+    RETURN_ON_FAILURE(&m_Device, offset + size <= bufferDesc.size, ReturnVoid(), "'offset + size' > buffer.size");
+
+    Buffer* bufferImpl = NRI_GET_IMPL(Buffer, &buffer);
+
+    GetCoreInterfaceImpl().CmdUpdateBuffer(*GetImpl(), *bufferImpl, offset, data, size);
+}
+
 NRI_INLINE void CommandBufferVal::Dispatch(const DispatchDesc& dispatchDesc) {
     RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
@@ -432,32 +765,12 @@ NRI_INLINE void CommandBufferVal::DispatchIndirect(const Buffer& buffer, uint64_
 NRI_INLINE void CommandBufferVal::Barrier(const BarrierGroupDesc& barrierGroupDesc) {
     RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
 
-    for (uint32_t i = 0; i < barrierGroupDesc.bufferNum; i++) {
-        if (!ValidateBufferBarrierDesc(m_Device, i, barrierGroupDesc.buffers[i]))
-            return;
-    }
-
-    for (uint32_t i = 0; i < barrierGroupDesc.textureNum; i++) {
-        if (!ValidateTextureBarrierDesc(m_Device, i, barrierGroupDesc.textures[i]))
-            return;
-    }
+    if (!ValidateBarrierGroupDesc(m_Device, barrierGroupDesc))
+        return;
 
     Scratch<BufferBarrierDesc> buffers = AllocateScratch(m_Device, BufferBarrierDesc, barrierGroupDesc.bufferNum);
-    memcpy(buffers, barrierGroupDesc.buffers, sizeof(BufferBarrierDesc) * barrierGroupDesc.bufferNum);
-    for (uint32_t i = 0; i < barrierGroupDesc.bufferNum; i++)
-        buffers[i].buffer = NRI_GET_IMPL(Buffer, barrierGroupDesc.buffers[i].buffer);
-
     Scratch<TextureBarrierDesc> textures = AllocateScratch(m_Device, TextureBarrierDesc, barrierGroupDesc.textureNum);
-    memcpy(textures, barrierGroupDesc.textures, sizeof(TextureBarrierDesc) * barrierGroupDesc.textureNum);
-    for (uint32_t i = 0; i < barrierGroupDesc.textureNum; i++) {
-        textures[i].texture = NRI_GET_IMPL(Texture, barrierGroupDesc.textures[i].texture);
-        textures[i].srcQueue = NRI_GET_IMPL(Queue, barrierGroupDesc.textures[i].srcQueue);
-        textures[i].dstQueue = NRI_GET_IMPL(Queue, barrierGroupDesc.textures[i].dstQueue);
-    }
-
-    auto barrierGroupDescImpl = barrierGroupDesc;
-    barrierGroupDescImpl.buffers = buffers;
-    barrierGroupDescImpl.textures = textures;
+    BarrierGroupDesc barrierGroupDescImpl = GetBarrierGroupDescImpl(barrierGroupDesc, buffers, textures);
 
     GetCoreInterfaceImpl().CmdBarrier(*GetImpl(), barrierGroupDescImpl);
 }
@@ -744,6 +1057,7 @@ NRI_INLINE void CommandBufferVal::DrawMeshTasks(const DrawMeshTasksDesc& drawMes
 
     RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     RETURN_ON_FAILURE(&m_Device, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
+    RETURN_ON_FAILURE(&m_Device, !m_IsRenderPassSecondary, ReturnVoid(), "can't be called inside 'CmdBeginRenderingSecondary/CmdEndRendering', only 'CmdExecuteCommands' is allowed");
     RETURN_ON_FAILURE(&m_Device, deviceDesc.features.meshShader, ReturnVoid(), "'features.meshShader' is false");
 
     GetMeshShaderInterfaceImpl().CmdDrawMeshTasks(*GetImpl(), drawMeshTasksDesc);
@@ -755,6 +1069,7 @@ NRI_INLINE void CommandBufferVal::DrawMeshTasksIndirect(const Buffer& buffer, ui
 
     RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
     RETURN_ON_FAILURE(&m_Device, m_IsRenderPass, ReturnVoid(), "must be called inside 'CmdBeginRendering/CmdEndRendering'");
+    RETURN_ON_FAILURE(&m_Device, !m_IsRenderPassSecondary, ReturnVoid(), "can't be called inside 'CmdBeginRenderingSecondary/CmdEndRendering', only 'CmdExecuteCommands' is allowed");
     RETURN_ON_FAILURE(&m_Device, deviceDesc.features.meshShader, ReturnVoid(), "'features.meshShader' is false");
     RETURN_ON_FAILURE(&m_Device, !countBuffer || deviceDesc.features.drawIndirectCount, ReturnVoid(), "'countBuffer' is not supported");
     RETURN_ON_FAILURE(&m_Device, offset < bufferDesc.size, ReturnVoid(), "'offset' is greater than the buffer size");
@@ -774,3 +1089,147 @@ NRI_INLINE void CommandBufferVal::ValidateReadonlyDepthStencil() {
             REPORT_WARNING(&m_Device, "Stencil is read-only, but the pipeline writes to stencil. Writing happens only in VK!");
     }
 }
+
+NRI_INLINE void CommandBufferVal::ExecuteCommands(const CommandBuffer* const* secondaryCommandBuffers, uint32_t secondaryCommandBufferNum) {
+    RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    RETURN_ON_FAILURE(&m_Device, !m_IsSecondary, ReturnVoid(), "can't be called in a secondary command buffer");
+    RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass || m_IsRenderPassSecondary, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering' or inside 'CmdBeginRenderingSecondary/CmdEndRendering'");
+    RETURN_ON_FAILURE(&m_Device, !m_IsConditionalRendering, ReturnVoid(), "can't be called inside 'CmdBeginConditionalRendering/CmdEndConditionalRendering'");
+    RETURN_ON_FAILURE(&m_Device, secondaryCommandBuffers, ReturnVoid(), "'secondaryCommandBuffers' is NULL");
+    RETURN_ON_FAILURE(&m_Device, secondaryCommandBufferNum, ReturnVoid(), "'secondaryCommandBufferNum' is 0");
+
+    Scratch<CommandBuffer*> secondaryCommandBuffersImpl = AllocateScratch(m_Device, CommandBuffer*, secondaryCommandBufferNum);
+    for (uint32_t i = 0; i < secondaryCommandBufferNum; i++) {
+        const CommandBufferVal* commandBufferVal = (CommandBufferVal*)secondaryCommandBuffers[i];
+
+        RETURN_ON_FAILURE(&m_Device, commandBufferVal, ReturnVoid(), "'secondaryCommandBuffers[%u]' is NULL", i);
+        RETURN_ON_FAILURE(&m_Device, commandBufferVal->IsSecondary(), ReturnVoid(), "'secondaryCommandBuffers[%u]' is not a secondary command buffer", i);
+        RETURN_ON_FAILURE(&m_Device, !commandBufferVal->IsRecordingStarted(), ReturnVoid(), "'secondaryCommandBuffers[%u]' is in the recording state", i);
+        RETURN_ON_FAILURE(&m_Device, !commandBufferVal->IsResetByCommandAllocator(), ReturnVoid(), "'secondaryCommandBuffers[%u]' must be re-recorded after 'ResetCommandAllocator'", i);
+        RETURN_ON_FAILURE(&m_Device, commandBufferVal->IsRenderingInherited() == m_IsRenderPass, ReturnVoid(), "'secondaryCommandBuffers[%u]' must be begun %s 'attachmentsDesc'", i, m_IsRenderPass ? "with" : "without");
+
+        secondaryCommandBuffersImpl[i] = commandBufferVal->GetImpl();
+    }
+
+    GetSecondaryCommandBufferInterfaceImpl().CmdExecuteCommands(*GetImpl(), secondaryCommandBuffersImpl, secondaryCommandBufferNum);
+}
+
+NRI_INLINE void CommandBufferVal::SetAttachments(const AttachmentsDesc& attachmentsDesc) {
+    m_RenderTargetNum = attachmentsDesc.colors ? attachmentsDesc.colorNum : 0;
+
+    size_t i = 0;
+    for (; i < m_RenderTargetNum; i++)
+        m_RenderTargets[i] = (DescriptorVal*)attachmentsDesc.colors[i];
+    for (; i < m_RenderTargets.size(); i++)
+        m_RenderTargets[i] = nullptr;
+
+    if (attachmentsDesc.depthStencil)
+        m_DepthStencil = (DescriptorVal*)attachmentsDesc.depthStencil;
+    else
+        m_DepthStencil = nullptr;
+}
+
+NRI_INLINE uint32_t CommandBufferVal::BeginBarrier(const BarrierGroupDesc& barrierGroupDesc) {
+    RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, SPLIT_BARRIER_INVALID_INDEX, "the command buffer must be in the recording state");
+    RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, SPLIT_BARRIER_INVALID_INDEX, "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
+
+    if (!ValidateBarrierGroupDesc(m_Device, barrierGroupDesc))
+        return SPLIT_BARRIER_INVALID_INDEX;
+
+    Scratch<BufferBarrierDesc> buffers = AllocateScratch(m_Device, BufferBarrierDesc, barrierGroupDesc.bufferNum);
+    Scratch<TextureBarrierDesc> textures = AllocateScratch(m_Device, TextureBarrierDesc, barrierGroupDesc.textureNum);
+    BarrierGroupDesc barrierGroupDescImpl = GetBarrierGroupDescImpl(barrierGroupDesc, buffers, textures);
+
+    uint32_t splitBarrierIndex = GetSplitBarrierInterfaceImpl().CmdBeginBarrier(*GetImpl(), barrierGroupDescImpl);
+    if (splitBarrierIndex >= m_SplitBarriers.size())
+        m_SplitBarriers.resize(splitBarrierIndex + 1, {0, true});
+
+    m_SplitBarriers[splitBarrierIndex] = {GetBarrierGroupDescHash(barrierGroupDesc), false};
+
+    return splitBarrierIndex;
+}
+
+NRI_INLINE void CommandBufferVal::EndBarrier(const BarrierGroupDesc& barrierGroupDesc, uint32_t splitBarrierIndex) {
+    RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    RETURN_ON_FAILURE(&m_Device, !m_IsRenderPass, ReturnVoid(), "must be called outside of 'CmdBeginRendering/CmdEndRendering'");
+    RETURN_ON_FAILURE(&m_Device, splitBarrierIndex < m_SplitBarriers.size(), ReturnVoid(), "'splitBarrierIndex=%u' is not returned by 'CmdBeginBarrier' in this command buffer", splitBarrierIndex);
+
+    SplitBarrierVal& splitBarrier = m_SplitBarriers[splitBarrierIndex];
+    RETURN_ON_FAILURE(&m_Device, !splitBarrier.isEnded, ReturnVoid(), "'splitBarrierIndex=%u' is already ended", splitBarrierIndex);
+    RETURN_ON_FAILURE(&m_Device, splitBarrier.descHash == GetBarrierGroupDescHash(barrierGroupDesc), ReturnVoid(), "'barrierGroupDesc' doesn't match the one passed to 'CmdBeginBarrier' ('splitBarrierIndex=%u')", splitBarrierIndex);
+
+    if (!ValidateBarrierGroupDesc(m_Device, barrierGroupDesc))
+        return;
+
+    Scratch<BufferBarrierDesc> buffers = AllocateScratch(m_Device, BufferBarrierDesc, barrierGroupDesc.bufferNum);
+    Scratch<TextureBarrierDesc> textures = AllocateScratch(m_Device, TextureBarrierDesc, barrierGroupDesc.textureNum);
+    BarrierGroupDesc barrierGroupDescImpl = GetBarrierGroupDescImpl(barrierGroupDesc, buffers, textures);
+
+    GetSplitBarrierInterfaceImpl().CmdEndBarrier(*GetImpl(), barrierGroupDescImpl, splitBarrierIndex);
+    splitBarrier.isEnded = true;
+}
+
+NRI_INLINE void CommandBufferVal::ExecuteGeneratedCommands(const GeneratedCommandsDesc& generatedCommandsDesc) {
+    RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    RETURN_ON_FAILURE(&m_Device, generatedCommandsDesc.indirectCommandLayout, ReturnVoid(), "'indirectCommandLayout' is NULL");
+    RETURN_ON_FAILURE(&m_Device, generatedCommandsDesc.buffer, ReturnVoid(), "'buffer' is NULL");
+
+    const IndirectCommandLayoutVal& indirectCommandLayoutVal = *(IndirectCommandLayoutVal*)generatedCommandsDesc.indirectCommandLayout;
+    const BufferDesc& bufferDesc = ((BufferVal*)generatedCommandsDesc.buffer)->GetDesc();
+
+    RETURN_ON_FAILURE(&m_Device, !indirectCommandLayoutVal.IsDispatch() || !m_IsRenderPass, ReturnVoid(), "dispatches must be executed outside of 'CmdBeginRendering/CmdEndRendering'");
+    RETURN_ON_FAILURE(&m_Device, indirectCommandLayoutVal.IsDispatch() || m_IsRenderPass, ReturnVoid(), "draws must be executed inside 'CmdBeginRendering/CmdEndRendering'");
+    RETURN_ON_FAILURE(&m_Device, !m_IsRenderPassSecondary, ReturnVoid(), "can't be called inside 'CmdBeginRenderingSecondary/CmdEndRendering', only 'CmdExecuteCommands' is allowed");
+    RETURN_ON_FAILURE(&m_Device, !indirectCommandLayoutVal.HasPipelineCommand() || generatedCommandsDesc.indirectExecutionSet, ReturnVoid(), "'indirectExecutionSet' is NULL, but the layout has a 'PIPELINE' command");
+    RETURN_ON_FAILURE(&m_Device, generatedCommandsDesc.offset < bufferDesc.size, ReturnVoid(), "'offset' is greater than the buffer size");
+    RETURN_ON_FAILURE(&m_Device, bufferDesc.usage & BufferUsageBits::ARGUMENT_BUFFER, ReturnVoid(), "'buffer' is not an 'ARGUMENT_BUFFER'");
+
+    if (generatedCommandsDesc.preprocessBuffer) {
+        const BufferDesc& preprocessBufferDesc = ((BufferVal*)generatedCommandsDesc.preprocessBuffer)->GetDesc();
+        RETURN_ON_FAILURE(&m_Device, preprocessBufferDesc.usage & BufferUsageBits::PREPROCESS_BUFFER, ReturnVoid(), "'preprocessBuffer' is not a 'PREPROCESS_BUFFER'");
+    }
+
+    auto generatedCommandsDescImpl = generatedCommandsDesc;
+    generatedCommandsDescImpl.indirectCommandLayout = NRI_GET_IMPL(IndirectCommandLayout, generatedCommandsDesc.indirectCommandLayout);
+    generatedCommandsDescImpl.indirectExecutionSet = NRI_GET_IMPL(IndirectExecutionSet, generatedCommandsDesc.indirectExecutionSet);
+    generatedCommandsDescImpl.buffer = NRI_GET_IMPL(Buffer, generatedCommandsDesc.buffer);
+    generatedCommandsDescImpl.countBuffer = NRI_GET_IMPL(Buffer, generatedCommandsDesc.countBuffer);
+    generatedCommandsDescImpl.preprocessBuffer = NRI_GET_IMPL(Buffer, generatedCommandsDesc.preprocessBuffer);
+
+    GetDeviceGeneratedCommandsInterfaceImpl().CmdExecuteGeneratedCommands(*GetImpl(), generatedCommandsDescImpl);
+}
+
+NRI_INLINE void CommandBufferVal::BeginConditionalRendering(const Buffer& buffer, uint64_t offset, bool inverted) {
+    const BufferDesc& bufferDesc = ((BufferVal&)buffer).GetDesc();
+
+    RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    RETURN_ON_FAILURE(&m_Device, !m_IsConditionalRendering, ReturnVoid(), "'CmdBeginConditionalRendering' has been already called");
+    RETURN_ON_FAILURE(&m_Device, offset % 4 == 0, ReturnVoid(), "'offset' must be a multiple of 4");
+    RETURN_ON_FAILURE(&m_Device, offset + sizeof(uint32_t) <= bufferDesc.size, ReturnVoid(), "'offset' is out of bounds");
+    RETURN_ON_FAILURE(&m_Device, bufferDesc.usage & BufferUsageBits::ARGUMENT_BUFFER, ReturnVoid(), "'buffer' is not an 'ARGUMENT_BUFFER'");
+
+    Buffer* bufferImpl = NRI_GET_IMPL(Buffer, &buffer);
+
+    m_IsConditionalRendering = true;
+    m_IsConditionalRenderingInRenderPass = m_IsRenderPass;
+
+    GetConditionalRenderingInterfaceImpl().CmdBeginConditionalRendering(*GetImpl(), *bufferImpl, offset, inverted);
+}
+
+NRI_INLINE void CommandBufferVal::EndConditionalRendering() {
+    RETURN_ON_FAILURE(&m_Device, m_IsRecordingStarted, ReturnVoid(), "the command buffer must be in the recording state");
+    RETURN_ON_FAILURE(&m_Device, m_IsConditionalRendering, ReturnVoid(), "'CmdBeginConditionalRendering' has not been called");
+    RETURN_ON_FAILURE(&m_Device, m_IsRenderPass == m_IsConditionalRenderingInRenderPass, ReturnVoid(), "must be called %s 'CmdBeginRendering/CmdEndRendering', like 'CmdBeginConditionalRendering'", m_IsConditionalRenderingInRenderPass ? "inside" : "outside of");
+
+    m_IsConditionalRendering = false;
+
+    GetConditionalRenderingInterfaceImpl().CmdEndConditionalRendering(*GetImpl());
+}
+
+NRI_INLINE void CommandBufferVal::GetStats(CommandBufferStats& commandBufferStats) {
+    commandBufferStats = {};
+
+    RETURN_ON_FAILURE(&m_Device, !m_IsRecordingStarted, ReturnVoid(), "the command buffer must not be in the recording state");
+
+    GetCommandBufferStatsInterfaceImpl().GetCommandBufferStats(*GetImpl(), commandBufferStats);
+}
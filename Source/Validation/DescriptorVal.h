@@ -82,9 +82,32 @@ struct DescriptorVal final : public ObjectVal {
         return m_IsStencilReadonly;
     }
 
+    // Texture views only
+    inline Format GetFormat() const {
+        return m_Format;
+    }
+
+    inline Dim_t GetWidth() const {
+        return m_Width;
+    }
+
+    inline Dim_t GetHeight() const {
+        return m_Height;
+    }
+
+    inline Sample_t GetSampleNum() const {
+        return m_SampleNum;
+    }
+
 private:
+    void SetTextureProps(const Texture* texture, Format format, Dim_t mipOffset);
+
     ResourceType m_ResourceType = ResourceType::NONE;
     ResourceViewType m_ResourceViewType = ResourceViewType::NONE;
+    Format m_Format = Format::UNKNOWN;
+    Dim_t m_Width = 0; // at "mipOffset"
+    Dim_t m_Height = 0;
+    Sample_t m_SampleNum = 0;
     bool m_IsDepthReadonly = false;
     bool m_IsStencilReadonly = false;
 };
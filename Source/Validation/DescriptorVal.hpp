@@ -27,6 +27,8 @@ DescriptorVal::DescriptorVal(DeviceVal& device, Descriptor* descriptor, const Bu
 DescriptorVal::DescriptorVal(DeviceVal& device, Descriptor* descriptor, const Texture1DViewDesc& textureViewDesc)
     : ObjectVal(device, descriptor)
     , m_ResourceType(ResourceType::TEXTURE) {
+    SetTextureProps(textureViewDesc.texture, textureViewDesc.format, textureViewDesc.mipOffset);
+
     switch (textureViewDesc.viewType) {
         case Texture1DViewType::SHADER_RESOURCE_1D:
         case Texture1DViewType::SHADER_RESOURCE_1D_ARRAY:
@@ -56,6 +58,8 @@ DescriptorVal::DescriptorVal(DeviceVal& device, Descriptor* descriptor, const Te
 DescriptorVal::DescriptorVal(DeviceVal& device, Descriptor* descriptor, const Texture2DViewDesc& textureViewDesc)
     : ObjectVal(device, descriptor)
     , m_ResourceType(ResourceType::TEXTURE) {
+    SetTextureProps(textureViewDesc.texture, textureViewDesc.format, textureViewDesc.mipOffset);
+
     switch (textureViewDesc.viewType) {
         case Texture2DViewType::SHADER_RESOURCE_2D:
         case Texture2DViewType::SHADER_RESOURCE_2D_ARRAY:
@@ -90,6 +94,8 @@ DescriptorVal::DescriptorVal(DeviceVal& device, Descriptor* descriptor, const Te
 DescriptorVal::DescriptorVal(DeviceVal& device, Descriptor* descriptor, const Texture3DViewDesc& textureViewDesc)
     : ObjectVal(device, descriptor)
     , m_ResourceType(ResourceType::TEXTURE) {
+    SetTextureProps(textureViewDesc.texture, textureViewDesc.format, textureViewDesc.mipOffset);
+
     switch (textureViewDesc.viewType) {
         case Texture3DViewType::SHADER_RESOURCE_3D:
             m_ResourceViewType = ResourceViewType::SHADER_RESOURCE;
@@ -110,3 +116,13 @@ DescriptorVal::DescriptorVal(DeviceVal& device, Descriptor* descriptor)
     : ObjectVal(device, descriptor)
     , m_ResourceType(ResourceType::SAMPLER) {
 }
+
+void DescriptorVal::SetTextureProps(const Texture* texture, Format format, Dim_t mipOffset) {
+    const TextureDesc& textureDesc = ((const TextureVal*)texture)->GetDesc();
+    GraphicsAPI graphicsAPI = m_Device.GetDesc().graphicsAPI;
+
+    m_Format = format;
+    m_Width = GetDimension(graphicsAPI, textureDesc, 0, mipOffset);
+    m_Height = GetDimension(graphicsAPI, textureDesc, 1, mipOffset);
+    m_SampleNum = std::max(textureDesc.sampleNum, (Sample_t)1);
+}
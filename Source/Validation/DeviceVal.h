@@ -7,13 +7,20 @@ namespace nri {
 struct QueueVal;
 
 struct IsExtSupported {
-    uint32_t lowLatency   : 1;
-    uint32_t meshShader   : 1;
-    uint32_t rayTracing   : 1;
-    uint32_t swapChain    : 1;
-    uint32_t wrapperD3D11 : 1;
-    uint32_t wrapperD3D12 : 1;
-    uint32_t wrapperVK    : 1;
+    uint32_t commandBufferStats      : 1;
+    uint32_t conditionalRendering    : 1;
+    uint32_t deviceGeneratedCommands : 1;
+    uint32_t fenceCallback           : 1;
+    uint32_t lowLatency              : 1;
+    uint32_t meshShader              : 1;
+    uint32_t queueTimeline           : 1;
+    uint32_t rayTracing              : 1;
+    uint32_t secondaryCommandBuffer  : 1;
+    uint32_t splitBarrier            : 1;
+    uint32_t swapChain               : 1;
+    uint32_t wrapperD3D11            : 1;
+    uint32_t wrapperD3D12            : 1;
+    uint32_t wrapperVK               : 1;
 };
 
 struct DeviceVal final : public DeviceBase {
@@ -32,6 +39,22 @@ struct DeviceVal final : public DeviceBase {
         return m_iCoreImpl;
     }
 
+    inline const CommandBufferStatsInterface& GetCommandBufferStatsInterfaceImpl() const {
+        return m_iCommandBufferStatsImpl;
+    }
+
+    inline const ConditionalRenderingInterface& GetConditionalRenderingInterfaceImpl() const {
+        return m_iConditionalRenderingImpl;
+    }
+
+    inline const DeviceGeneratedCommandsInterface& GetDeviceGeneratedCommandsInterfaceImpl() const {
+        return m_iDeviceGeneratedCommandsImpl;
+    }
+
+    inline const FenceCallbackInterface& GetFenceCallbackInterfaceImpl() const {
+        return m_iFenceCallbackImpl;
+    }
+
     inline const HelperInterface& GetHelperInterfaceImpl() const {
         return m_iHelperImpl;
     }
@@ -44,10 +67,22 @@ struct DeviceVal final : public DeviceBase {
         return m_iMeshShaderImpl;
     }
 
+    inline const QueueTimelineInterface& GetQueueTimelineInterfaceImpl() const {
+        return m_iQueueTimelineImpl;
+    }
+
     inline const RayTracingInterface& GetRayTracingInterfaceImpl() const {
         return m_iRayTracingImpl;
     }
 
+    inline const SecondaryCommandBufferInterface& GetSecondaryCommandBufferInterfaceImpl() const {
+        return m_iSecondaryCommandBufferImpl;
+    }
+
+    inline const SplitBarrierInterface& GetSplitBarrierInterfaceImpl() const {
+        return m_iSplitBarrierImpl;
+    }
+
     inline const SwapChainInterface& GetSwapChainInterfaceImpl() const {
         return m_iSwapChainImpl;
     }
@@ -101,11 +136,20 @@ struct DeviceVal final : public DeviceBase {
 
     void Destruct() override;
     Result FillFunctionTable(CoreInterface& table) const override;
+    Result FillFunctionTable(CommandBufferStatsInterface& table) const override;
+    Result FillFunctionTable(ConditionalRenderingInterface& table) const override;
+    Result FillFunctionTable(DeviceGeneratedCommandsInterface& table) const override;
+    Result FillFunctionTable(FenceCallbackInterface& table) const override;
     Result FillFunctionTable(HelperInterface& table) const override;
     Result FillFunctionTable(LowLatencyInterface& table) const override;
     Result FillFunctionTable(MeshShaderInterface& table) const override;
+    Result FillFunctionTable(QueueSchedulerInterface& table) const override;
+    Result FillFunctionTable(QueueTimelineInterface& table) const override;
     Result FillFunctionTable(RayTracingInterface& table) const override;
+    Result FillFunctionTable(RenderGraphInterface& table) const override;
     Result FillFunctionTable(ResourceAllocatorInterface& table) const override;
+    Result FillFunctionTable(SecondaryCommandBufferInterface& table) const override;
+    Result FillFunctionTable(SplitBarrierInterface& table) const override;
     Result FillFunctionTable(StreamerInterface& table) const override;
     Result FillFunctionTable(SwapChainInterface& table) const override;
     Result FillFunctionTable(UpscalerInterface& table) const override;
@@ -136,6 +180,8 @@ struct DeviceVal final : public DeviceBase {
     Result CreatePipeline(const ComputePipelineDesc& computePipelineDesc, Pipeline*& pipeline);
     Result CreatePipeline(const RayTracingPipelineDesc& pipelineDesc, Pipeline*& pipeline);
     Result CreateMicromap(const MicromapDesc& micromapDesc, Micromap*& micromap);
+    Result CreateIndirectCommandLayout(const IndirectCommandLayoutDesc& indirectCommandLayoutDesc, IndirectCommandLayout*& indirectCommandLayout);
+    Result CreateIndirectExecutionSet(const IndirectExecutionSetDesc& indirectExecutionSetDesc, IndirectExecutionSet*& indirectExecutionSet);
     Result AllocateMemory(const AllocateMemoryDesc& allocateMemoryDesc, Memory*& memory);
     Result AllocateBuffer(const AllocateBufferDesc& bufferDesc, Buffer*& buffer);
     Result AllocateTexture(const AllocateTextureDesc& textureDesc, Texture*& texture);
@@ -177,10 +223,13 @@ struct DeviceVal final : public DeviceBase {
     void DestroyCommandBuffer(CommandBuffer& commandBuffer);
     void DestroyCommandAllocator(CommandAllocator& commandAllocator);
     void DestroyAccelerationStructure(AccelerationStructure& accelerationStructure);
+    void DestroyIndirectCommandLayout(IndirectCommandLayout& indirectCommandLayout);
+    void DestroyIndirectExecutionSet(IndirectExecutionSet& indirectExecutionSet);
 
     void FreeMemory(Memory& memory);
     Result GetQueue(QueueType queueType, uint32_t queueIndex, Queue*& queue);
     Result WaitIdle();
+    Result WaitMulti(const FenceWaitDesc* fenceWaitDescs, uint32_t fenceWaitDescNum, bool waitAny, uint32_t timeout);
     Result BindBufferMemory(const BufferMemoryBindingDesc* memoryBindingDescs, uint32_t memoryBindingDescNum);
     Result BindTextureMemory(const TextureMemoryBindingDesc* memoryBindingDescs, uint32_t memoryBindingDescNum);
     Result BindMicromapMemory(const MicromapMemoryBindingDesc* memoryBindingDescs, uint32_t memoryBindingDescNum);
@@ -199,11 +248,18 @@ private:
 
     // Implementation
     CoreInterface m_iCoreImpl = {};
+    CommandBufferStatsInterface m_iCommandBufferStatsImpl = {};
+    ConditionalRenderingInterface m_iConditionalRenderingImpl = {};
+    DeviceGeneratedCommandsInterface m_iDeviceGeneratedCommandsImpl = {};
+    FenceCallbackInterface m_iFenceCallbackImpl = {};
     HelperInterface m_iHelperImpl = {};
     LowLatencyInterface m_iLowLatencyImpl = {};
     MeshShaderInterface m_iMeshShaderImpl = {};
+    QueueTimelineInterface m_iQueueTimelineImpl = {};
     RayTracingInterface m_iRayTracingImpl = {};
     ResourceAllocatorInterface m_iResourceAllocatorImpl = {};
+    SecondaryCommandBufferInterface m_iSecondaryCommandBufferImpl = {};
+    SplitBarrierInterface m_iSplitBarrierImpl = {};
     SwapChainInterface m_iSwapChainImpl = {};
     WrapperD3D11Interface m_iWrapperD3D11Impl = {};
     WrapperD3D12Interface m_iWrapperD3D12Impl = {};
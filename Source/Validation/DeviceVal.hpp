@@ -64,9 +64,16 @@ bool DeviceVal::Create() {
     result = deviceBaseImpl.FillFunctionTable(m_iResourceAllocatorImpl);
     RETURN_ON_FAILURE(this, result == Result::SUCCESS, false, "Failed to get 'ResourceAllocatorInterface' interface");
 
+    m_IsExtSupported.commandBufferStats = deviceBaseImpl.FillFunctionTable(m_iCommandBufferStatsImpl) == Result::SUCCESS;
+    m_IsExtSupported.conditionalRendering = deviceBaseImpl.FillFunctionTable(m_iConditionalRenderingImpl) == Result::SUCCESS;
+    m_IsExtSupported.deviceGeneratedCommands = deviceBaseImpl.FillFunctionTable(m_iDeviceGeneratedCommandsImpl) == Result::SUCCESS;
+    m_IsExtSupported.fenceCallback = deviceBaseImpl.FillFunctionTable(m_iFenceCallbackImpl) == Result::SUCCESS;
     m_IsExtSupported.lowLatency = deviceBaseImpl.FillFunctionTable(m_iLowLatencyImpl) == Result::SUCCESS;
     m_IsExtSupported.meshShader = deviceBaseImpl.FillFunctionTable(m_iMeshShaderImpl) == Result::SUCCESS;
+    m_IsExtSupported.queueTimeline = deviceBaseImpl.FillFunctionTable(m_iQueueTimelineImpl) == Result::SUCCESS;
     m_IsExtSupported.rayTracing = deviceBaseImpl.FillFunctionTable(m_iRayTracingImpl) == Result::SUCCESS;
+    m_IsExtSupported.secondaryCommandBuffer = deviceBaseImpl.FillFunctionTable(m_iSecondaryCommandBufferImpl) == Result::SUCCESS;
+    m_IsExtSupported.splitBarrier = deviceBaseImpl.FillFunctionTable(m_iSplitBarrierImpl) == Result::SUCCESS;
     m_IsExtSupported.swapChain = deviceBaseImpl.FillFunctionTable(m_iSwapChainImpl) == Result::SUCCESS;
     m_IsExtSupported.wrapperD3D11 = deviceBaseImpl.FillFunctionTable(m_iWrapperD3D11Impl) == Result::SUCCESS;
     m_IsExtSupported.wrapperD3D12 = deviceBaseImpl.FillFunctionTable(m_iWrapperD3D12Impl) == Result::SUCCESS;
@@ -134,6 +141,21 @@ NRI_INLINE Result DeviceVal::WaitIdle() {
     return GetCoreInterfaceImpl().DeviceWaitIdle(m_Impl);
 }
 
+NRI_INLINE Result DeviceVal::WaitMulti(const FenceWaitDesc* fenceWaitDescs, uint32_t fenceWaitDescNum, bool waitAny, uint32_t timeout) {
+    RETURN_ON_FAILURE(this, fenceWaitDescs || !fenceWaitDescNum, Result::INVALID_ARGUMENT, "'fenceWaitDescs' is NULL");
+
+    Scratch<FenceWaitDesc> fenceWaitDescsImpl = AllocateScratch(*this, FenceWaitDesc, fenceWaitDescNum);
+    for (uint32_t i = 0; i < fenceWaitDescNum; i++) {
+        RETURN_ON_FAILURE(this, fenceWaitDescs[i].fence, Result::INVALID_ARGUMENT, "'fenceWaitDescs[%u].fence' is NULL", i);
+        RETURN_ON_FAILURE(this, !((FenceVal*)fenceWaitDescs[i].fence)->IsBinary(), Result::INVALID_ARGUMENT, "'fenceWaitDescs[%u].fence' is a swapchain semaphore", i);
+
+        fenceWaitDescsImpl[i] = fenceWaitDescs[i];
+        fenceWaitDescsImpl[i].fence = NRI_GET_IMPL(Fence, fenceWaitDescs[i].fence);
+    }
+
+    return GetCoreInterfaceImpl().WaitMulti(m_Impl, fenceWaitDescsImpl, fenceWaitDescNum, waitAny, timeout);
+}
+
 NRI_INLINE Result DeviceVal::CreateCommandAllocator(const Queue& queue, CommandAllocator*& commandAllocator) {
     auto queueImpl = NRI_GET_IMPL(Queue, &queue);
 
@@ -539,7 +561,7 @@ NRI_INLINE Result DeviceVal::CreateFence(uint64_t initialValue, Fence*& fence) {
 
     fence = nullptr;
     if (result == Result::SUCCESS)
-        fence = (Fence*)Allocate<FenceVal>(GetAllocationCallbacks(), *this, fenceImpl);
+        fence = (Fence*)Allocate<FenceVal>(GetAllocationCallbacks(), *this, fenceImpl, initialValue == SWAPCHAIN_SEMAPHORE);
 
     return result;
 }
@@ -748,7 +770,7 @@ NRI_INLINE Result DeviceVal::CreateCommandBuffer(const CommandBufferVKDesc& comm
 
     commandBuffer = nullptr;
     if (result == Result::SUCCESS)
-        commandBuffer = (CommandBuffer*)Allocate<CommandBufferVal>(GetAllocationCallbacks(), *this, commandBufferImpl, true);
+        commandBuffer = (CommandBuffer*)Allocate<CommandBufferVal>(GetAllocationCallbacks(), *this, commandBufferImpl, nullptr);
 
     return result;
 }
@@ -879,7 +901,7 @@ NRI_INLINE Result DeviceVal::CreateCommandBuffer(const CommandBufferD3D11Desc& c
     Result result = m_iWrapperD3D11Impl.CreateCommandBufferD3D11(m_Impl, commandBufferDesc, commandBufferImpl);
 
     if (result == Result::SUCCESS)
-        commandBuffer = (CommandBuffer*)Allocate<CommandBufferVal>(GetAllocationCallbacks(), *this, commandBufferImpl, true);
+        commandBuffer = (CommandBuffer*)Allocate<CommandBufferVal>(GetAllocationCallbacks(), *this, commandBufferImpl, nullptr);
 
     return result;
 }
@@ -922,7 +944,7 @@ NRI_INLINE Result DeviceVal::CreateCommandBuffer(const CommandBufferD3D12Desc& c
 
     commandBuffer = nullptr;
     if (result == Result::SUCCESS)
-        commandBuffer = (CommandBuffer*)Allocate<CommandBufferVal>(GetAllocationCallbacks(), *this, commandBufferImpl, true);
+        commandBuffer = (CommandBuffer*)Allocate<CommandBufferVal>(GetAllocationCallbacks(), *this, commandBufferImpl, nullptr);
 
     return result;
 }
@@ -1045,6 +1067,56 @@ NRI_INLINE Result DeviceVal::CreateMicromap(const MicromapDesc& micromapDesc, Mi
     return result;
 }
 
+NRI_INLINE Result DeviceVal::CreateIndirectCommandLayout(const IndirectCommandLayoutDesc& indirectCommandLayoutDesc, IndirectCommandLayout*& indirectCommandLayout) {
+    RETURN_ON_FAILURE(this, indirectCommandLayoutDesc.commands != nullptr, Result::INVALID_ARGUMENT, "'commands' is NULL");
+    RETURN_ON_FAILURE(this, indirectCommandLayoutDesc.commandNum != 0, Result::INVALID_ARGUMENT, "'commandNum' is 0");
+    RETURN_ON_FAILURE(this, indirectCommandLayoutDesc.stride % 4 == 0, Result::INVALID_ARGUMENT, "'stride' must be a multiple of 4");
+    RETURN_ON_FAILURE(this, indirectCommandLayoutDesc.shaderStages != StageBits::NONE, Result::INVALID_ARGUMENT, "'shaderStages' can't be 'NONE'");
+
+    for (uint32_t i = 0; i < indirectCommandLayoutDesc.commandNum; i++) {
+        const IndirectCommandDesc& command = indirectCommandLayoutDesc.commands[i];
+        bool isAction = command.type >= IndirectCommandType::DRAW;
+        bool isLast = i == indirectCommandLayoutDesc.commandNum - 1;
+
+        RETURN_ON_FAILURE(this, command.type < IndirectCommandType::MAX_NUM, Result::INVALID_ARGUMENT, "'commands[%u].type' is invalid", i);
+        RETURN_ON_FAILURE(this, command.offset < indirectCommandLayoutDesc.stride, Result::INVALID_ARGUMENT, "'commands[%u].offset' is greater than 'stride'", i);
+        RETURN_ON_FAILURE(this, isAction == isLast, Result::INVALID_ARGUMENT, "'commands[%u]' is %s", i, isAction ? "an action command, but not the last one" : "the last command, but not an action command");
+        RETURN_ON_FAILURE(this, command.type != IndirectCommandType::PIPELINE || i == 0, Result::INVALID_ARGUMENT, "'commands[%u]' is 'PIPELINE', but not the first one", i);
+        RETURN_ON_FAILURE(this, command.type != IndirectCommandType::ROOT_CONSTANTS || indirectCommandLayoutDesc.pipelineLayout, Result::INVALID_ARGUMENT, "'commands[%u]' is 'ROOT_CONSTANTS', but 'pipelineLayout' is NULL", i);
+        RETURN_ON_FAILURE(this, command.type != IndirectCommandType::ROOT_CONSTANTS || command.rootConstantIndex < ((PipelineLayoutVal*)indirectCommandLayoutDesc.pipelineLayout)->GetPipelineLayoutDesc().rootConstantNum, Result::INVALID_ARGUMENT, "'commands[%u].rootConstantIndex' is out of bounds", i);
+        RETURN_ON_FAILURE(this, command.type != IndirectCommandType::DRAW_MESH_TASKS || m_Desc.features.meshShader, Result::INVALID_ARGUMENT, "'commands[%u]' is 'DRAW_MESH_TASKS', but 'features.meshShader' is false", i);
+    }
+
+    auto indirectCommandLayoutDescImpl = indirectCommandLayoutDesc;
+    indirectCommandLayoutDescImpl.pipelineLayout = NRI_GET_IMPL(PipelineLayout, indirectCommandLayoutDesc.pipelineLayout);
+
+    IndirectCommandLayout* indirectCommandLayoutImpl = nullptr;
+    Result result = m_iDeviceGeneratedCommandsImpl.CreateIndirectCommandLayout(m_Impl, indirectCommandLayoutDescImpl, indirectCommandLayoutImpl);
+
+    indirectCommandLayout = nullptr;
+    if (result == Result::SUCCESS)
+        indirectCommandLayout = (IndirectCommandLayout*)Allocate<IndirectCommandLayoutVal>(GetAllocationCallbacks(), *this, indirectCommandLayoutImpl, indirectCommandLayoutDesc);
+
+    return result;
+}
+
+NRI_INLINE Result DeviceVal::CreateIndirectExecutionSet(const IndirectExecutionSetDesc& indirectExecutionSetDesc, IndirectExecutionSet*& indirectExecutionSet) {
+    RETURN_ON_FAILURE(this, indirectExecutionSetDesc.initialPipeline != nullptr, Result::INVALID_ARGUMENT, "'initialPipeline' is NULL");
+    RETURN_ON_FAILURE(this, indirectExecutionSetDesc.pipelineMaxNum != 0, Result::INVALID_ARGUMENT, "'pipelineMaxNum' is 0");
+
+    auto indirectExecutionSetDescImpl = indirectExecutionSetDesc;
+    indirectExecutionSetDescImpl.initialPipeline = NRI_GET_IMPL(Pipeline, indirectExecutionSetDesc.initialPipeline);
+
+    IndirectExecutionSet* indirectExecutionSetImpl = nullptr;
+    Result result = m_iDeviceGeneratedCommandsImpl.CreateIndirectExecutionSet(m_Impl, indirectExecutionSetDescImpl, indirectExecutionSetImpl);
+
+    indirectExecutionSet = nullptr;
+    if (result == Result::SUCCESS)
+        indirectExecutionSet = (IndirectExecutionSet*)Allocate<IndirectExecutionSetVal>(GetAllocationCallbacks(), *this, indirectExecutionSetImpl, indirectExecutionSetDesc.pipelineMaxNum);
+
+    return result;
+}
+
 NRI_INLINE Result DeviceVal::CreateAccelerationStructure(const AccelerationStructureDesc& accelerationStructureDesc, AccelerationStructure*& accelerationStructure) {
     RETURN_ON_FAILURE(this, accelerationStructureDesc.geometryOrInstanceNum != 0, Result::INVALID_ARGUMENT, "'geometryOrInstanceNum' is 0");
 
@@ -1245,3 +1317,13 @@ NRI_INLINE void DeviceVal::DestroyMicromap(Micromap& micromap) {
     m_iRayTracingImpl.DestroyMicromap(*NRI_GET_IMPL(Micromap, &micromap));
     Destroy((MicromapVal*)&micromap);
 }
+
+NRI_INLINE void DeviceVal::DestroyIndirectCommandLayout(IndirectCommandLayout& indirectCommandLayout) {
+    m_iDeviceGeneratedCommandsImpl.DestroyIndirectCommandLayout(*NRI_GET_IMPL(IndirectCommandLayout, &indirectCommandLayout));
+    Destroy((IndirectCommandLayoutVal*)&indirectCommandLayout);
+}
+
+NRI_INLINE void DeviceVal::DestroyIndirectExecutionSet(IndirectExecutionSet& indirectExecutionSet) {
+    m_iDeviceGeneratedCommandsImpl.DestroyIndirectExecutionSet(*NRI_GET_IMPL(IndirectExecutionSet, &indirectExecutionSet));
+    Destroy((IndirectExecutionSetVal*)&indirectExecutionSet);
+}
@@ -5,8 +5,9 @@
 namespace nri {
 
 struct FenceVal final : public ObjectVal {
-    inline FenceVal(DeviceVal& device, Fence* fence)
-        : ObjectVal(device, fence) {
+    inline FenceVal(DeviceVal& device, Fence* fence, bool isBinary)
+        : ObjectVal(device, fence)
+        , m_IsBinary(isBinary) {
     }
 
     inline ~FenceVal() {
@@ -16,12 +17,21 @@ struct FenceVal final : public ObjectVal {
         return (Fence*)m_Impl;
     }
 
+    inline bool IsBinary() const {
+        return m_IsBinary;
+    }
+
     //================================================================================================================
     // NRI
     //================================================================================================================
 
     uint64_t GetFenceValue() const;
     void Wait(uint64_t value);
+    void Signal(uint64_t value);
+    Result RegisterCallback(uint64_t value, const FenceCallbackDesc& fenceCallbackDesc);
+
+private:
+    bool m_IsBinary = false; // created with "SWAPCHAIN_SEMAPHORE"
 };
 
 } // namespace nri
@@ -7,3 +7,18 @@ NRI_INLINE uint64_t FenceVal::GetFenceValue() const {
 NRI_INLINE void FenceVal::Wait(uint64_t value) {
     GetCoreInterfaceImpl().Wait(*GetImpl(), value);
 }
+
+NRI_INLINE void FenceVal::Signal(uint64_t value) {
+    RETURN_ON_FAILURE(&m_Device, m_Device.GetDesc().features.hostFenceSignal, ReturnVoid(), "'features.hostFenceSignal' is false");
+    RETURN_ON_FAILURE(&m_Device, !m_IsBinary, ReturnVoid(), "a swapchain semaphore can't be signaled from the host");
+    RETURN_ON_FAILURE(&m_Device, value > GetFenceValue(), ReturnVoid(), "'value' must be greater than the current fence value");
+
+    GetCoreInterfaceImpl().Signal(*GetImpl(), value);
+}
+
+NRI_INLINE Result FenceVal::RegisterCallback(uint64_t value, const FenceCallbackDesc& fenceCallbackDesc) {
+    RETURN_ON_FAILURE(&m_Device, fenceCallbackDesc.Callback, Result::INVALID_ARGUMENT, "'fenceCallbackDesc.Callback' is NULL");
+    RETURN_ON_FAILURE(&m_Device, !m_IsBinary, Result::INVALID_ARGUMENT, "a swapchain semaphore has no value to wait for");
+
+    return GetFenceCallbackInterfaceImpl().RegisterFenceCallback(*GetImpl(), value, fenceCallbackDesc);
+}
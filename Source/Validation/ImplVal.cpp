@@ -11,6 +11,8 @@
 #include "DescriptorVal.h"
 #include "DeviceVal.h"
 #include "FenceVal.h"
+#include "IndirectCommandLayoutVal.h"
+#include "IndirectExecutionSetVal.h"
 #include "MemoryVal.h"
 #include "MicromapVal.h"
 #include "PipelineLayoutVal.h"
@@ -22,6 +24,8 @@
 
 #include "HelperInterface.h"
 #include "ImguiInterface.h"
+#include "QueueSchedulerInterface.h"
+#include "RenderGraphInterface.h"
 #include "StreamerInterface.h"
 #include "UpscalerInterface.h"
 
@@ -37,6 +41,8 @@ using namespace nri;
 #include "DescriptorVal.hpp"
 #include "DeviceVal.hpp"
 #include "FenceVal.hpp"
+#include "IndirectCommandLayoutVal.hpp"
+#include "IndirectExecutionSetVal.hpp"
 #include "MemoryVal.hpp"
 #include "MicromapVal.hpp"
 #include "PipelineLayoutVal.hpp"
@@ -277,6 +283,10 @@ static Result NRI_CALL BeginCommandBuffer(CommandBuffer& commandBuffer, const De
     return ((CommandBufferVal&)commandBuffer).Begin(descriptorPool);
 }
 
+static Result NRI_CALL BeginReusableCommandBuffer(CommandBuffer& commandBuffer, const DescriptorPool* descriptorPool) {
+    return ((CommandBufferVal&)commandBuffer).Begin(descriptorPool, true);
+}
+
 static void NRI_CALL CmdSetDescriptorPool(CommandBuffer& commandBuffer, const DescriptorPool& descriptorPool) {
     ((CommandBufferVal&)commandBuffer).SetDescriptorPool(descriptorPool);
 }
@@ -361,6 +371,14 @@ static void NRI_CALL CmdDrawIndexed(CommandBuffer& commandBuffer, const DrawInde
     ((CommandBufferVal&)commandBuffer).DrawIndexed(drawIndexedDesc);
 }
 
+static void NRI_CALL CmdDrawMulti(CommandBuffer& commandBuffer, const DrawDesc* drawDescs, uint32_t drawNum) {
+    ((CommandBufferVal&)commandBuffer).DrawMulti(drawDescs, drawNum);
+}
+
+static void NRI_CALL CmdDrawIndexedMulti(CommandBuffer& commandBuffer, const DrawIndexedDesc* drawIndexedDescs, uint32_t drawNum) {
+    ((CommandBufferVal&)commandBuffer).DrawIndexedMulti(drawIndexedDescs, drawNum);
+}
+
 static void NRI_CALL CmdDrawIndirect(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset, uint32_t drawNum, uint32_t stride, const Buffer* countBuffer, uint64_t countBufferOffset) {
     ((CommandBufferVal&)commandBuffer).DrawIndirect(buffer, offset, drawNum, stride, countBuffer, countBufferOffset);
 }
@@ -397,10 +415,30 @@ static void NRI_CALL CmdReadbackTextureToBuffer(CommandBuffer& commandBuffer, Bu
     ((CommandBufferVal&)commandBuffer).ReadbackTextureToBuffer(dstBuffer, dstDataLayout, srcTexture, srcRegion);
 }
 
+static void NRI_CALL CmdCopyBufferMulti(CommandBuffer& commandBuffer, Buffer& dstBuffer, const Buffer& srcBuffer, const BufferCopyRegionDesc* regions, uint32_t regionNum) {
+    ((CommandBufferVal&)commandBuffer).CopyBufferMulti(dstBuffer, srcBuffer, regions, regionNum);
+}
+
+static void NRI_CALL CmdCopyTextureMulti(CommandBuffer& commandBuffer, Texture& dstTexture, const Texture& srcTexture, const TextureCopyRegionDesc* regions, uint32_t regionNum) {
+    ((CommandBufferVal&)commandBuffer).CopyTextureMulti(dstTexture, srcTexture, regions, regionNum);
+}
+
+static void NRI_CALL CmdUploadBufferToTextureMulti(CommandBuffer& commandBuffer, Texture& dstTexture, const Buffer& srcBuffer, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum) {
+    ((CommandBufferVal&)commandBuffer).UploadBufferToTextureMulti(dstTexture, srcBuffer, regions, regionNum);
+}
+
+static void NRI_CALL CmdReadbackTextureToBufferMulti(CommandBuffer& commandBuffer, Buffer& dstBuffer, const Texture& srcTexture, const TextureBufferCopyRegionDesc* regions, uint32_t regionNum) {
+    ((CommandBufferVal&)commandBuffer).ReadbackTextureToBufferMulti(dstBuffer, srcTexture, regions, regionNum);
+}
+
 static void NRI_CALL CmdZeroBuffer(CommandBuffer& commandBuffer, Buffer& buffer, uint64_t offset, uint64_t size) {
     ((CommandBufferVal&)commandBuffer).ZeroBuffer(buffer, offset, size);
 }
 
+static void NRI_CALL CmdUpdateBuffer(CommandBuffer& commandBuffer, Buffer& buffer, uint64_t offset, const void* data, uint32_t size) {
+    ((CommandBufferVal&)commandBuffer).UpdateBuffer(buffer, offset, data, size);
+}
+
 static void NRI_CALL CmdResolveTexture(CommandBuffer& commandBuffer, Texture& dstTexture, const TextureRegionDesc* dstRegion, const Texture& srcTexture, const TextureRegionDesc* srcRegion) {
     ((CommandBufferVal&)commandBuffer).ResolveTexture(dstTexture, dstRegion, srcTexture, srcRegion);
 }
@@ -461,6 +499,10 @@ static Result NRI_CALL QueueSubmit(Queue& queue, const QueueSubmitDesc& queueSub
     return ((QueueVal&)queue).Submit(queueSubmitDesc, nullptr);
 }
 
+static Result NRI_CALL QueueSubmitMulti(Queue& queue, const QueueSubmitDesc* queueSubmitDescs, uint32_t queueSubmitDescNum) {
+    return ((QueueVal&)queue).SubmitMulti(queueSubmitDescs, queueSubmitDescNum);
+}
+
 static Result NRI_CALL DeviceWaitIdle(Device& device) {
     if (!(&device))
         return Result::SUCCESS;
@@ -479,6 +521,14 @@ static void NRI_CALL Wait(Fence& fence, uint64_t value) {
     ((FenceVal&)fence).Wait(value);
 }
 
+static void NRI_CALL Signal(Fence& fence, uint64_t value) {
+    ((FenceVal&)fence).Signal(value);
+}
+
+static Result NRI_CALL WaitMulti(Device& device, const FenceWaitDesc* fenceWaitDescs, uint32_t fenceWaitDescNum, bool waitAny, uint32_t timeout) {
+    return ((DeviceVal&)device).WaitMulti(fenceWaitDescs, fenceWaitDescNum, waitAny, timeout);
+}
+
 static void NRI_CALL UpdateDescriptorRanges(DescriptorSet& descriptorSet, uint32_t baseRange, uint32_t rangeNum, const DescriptorRangeUpdateDesc* rangeUpdateDescs) {
     ((DescriptorSetVal&)descriptorSet).UpdateDescriptorRanges(baseRange, rangeNum, rangeUpdateDescs);
 }
@@ -601,6 +651,7 @@ Result DeviceVal::FillFunctionTable(CoreInterface& table) const {
     table.BindTextureMemory = ::BindTextureMemory;
     table.FreeMemory = ::FreeMemory;
     table.BeginCommandBuffer = ::BeginCommandBuffer;
+    table.BeginReusableCommandBuffer = ::BeginReusableCommandBuffer;
     table.CmdSetDescriptorPool = ::CmdSetDescriptorPool;
     table.CmdSetDescriptorSet = ::CmdSetDescriptorSet;
     table.CmdSetPipelineLayout = ::CmdSetPipelineLayout;
@@ -622,6 +673,8 @@ Result DeviceVal::FillFunctionTable(CoreInterface& table) const {
     table.CmdClearAttachments = ::CmdClearAttachments;
     table.CmdDraw = ::CmdDraw;
     table.CmdDrawIndexed = ::CmdDrawIndexed;
+    table.CmdDrawMulti = ::CmdDrawMulti;
+    table.CmdDrawIndexedMulti = ::CmdDrawIndexedMulti;
     table.CmdDrawIndirect = ::CmdDrawIndirect;
     table.CmdDrawIndexedIndirect = ::CmdDrawIndexedIndirect;
     table.CmdEndRendering = ::CmdEndRendering;
@@ -632,6 +685,11 @@ Result DeviceVal::FillFunctionTable(CoreInterface& table) const {
     table.CmdUploadBufferToTexture = ::CmdUploadBufferToTexture;
     table.CmdReadbackTextureToBuffer = ::CmdReadbackTextureToBuffer;
     table.CmdZeroBuffer = ::CmdZeroBuffer;
+    table.CmdUpdateBuffer = ::CmdUpdateBuffer;
+    table.CmdCopyBufferMulti = ::CmdCopyBufferMulti;
+    table.CmdCopyTextureMulti = ::CmdCopyTextureMulti;
+    table.CmdUploadBufferToTextureMulti = ::CmdUploadBufferToTextureMulti;
+    table.CmdReadbackTextureToBufferMulti = ::CmdReadbackTextureToBufferMulti;
     table.CmdResolveTexture = ::CmdResolveTexture;
     table.CmdClearStorage = ::CmdClearStorage;
     table.CmdResetQueries = ::CmdResetQueries;
@@ -649,7 +707,10 @@ Result DeviceVal::FillFunctionTable(CoreInterface& table) const {
     table.DeviceWaitIdle = ::DeviceWaitIdle;
     table.QueueWaitIdle = ::QueueWaitIdle;
     table.QueueSubmit = ::QueueSubmit;
+    table.QueueSubmitMulti = ::QueueSubmitMulti;
     table.Wait = ::Wait;
+    table.WaitMulti = ::WaitMulti;
+    table.Signal = ::Signal;
     table.GetFenceValue = ::GetFenceValue;
     table.UpdateDescriptorRanges = ::UpdateDescriptorRanges;
     table.UpdateDynamicConstantBuffers = ::UpdateDynamicConstantBuffers;
@@ -672,6 +733,119 @@ Result DeviceVal::FillFunctionTable(CoreInterface& table) const {
 
 #pragma endregion
 
+//============================================================================================================================================================================================
+#pragma region[  CommandBufferStats  ]
+
+static void NRI_CALL GetCommandBufferStats(const CommandBuffer& commandBuffer, CommandBufferStats& commandBufferStats) {
+    ((CommandBufferVal&)commandBuffer).GetStats(commandBufferStats);
+}
+
+Result DeviceVal::FillFunctionTable(CommandBufferStatsInterface& table) const {
+    if (!m_IsExtSupported.commandBufferStats)
+        return Result::UNSUPPORTED;
+
+    table.GetCommandBufferStats = ::GetCommandBufferStats;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  ConditionalRendering  ]
+
+static void NRI_CALL CmdBeginConditionalRendering(CommandBuffer& commandBuffer, const Buffer& buffer, uint64_t offset, bool inverted) {
+    ((CommandBufferVal&)commandBuffer).BeginConditionalRendering(buffer, offset, inverted);
+}
+
+static void NRI_CALL CmdEndConditionalRendering(CommandBuffer& commandBuffer) {
+    ((CommandBufferVal&)commandBuffer).EndConditionalRendering();
+}
+
+Result DeviceVal::FillFunctionTable(ConditionalRenderingInterface& table) const {
+    if (!m_IsExtSupported.conditionalRendering)
+        return Result::UNSUPPORTED;
+
+    table.CmdBeginConditionalRendering = ::CmdBeginConditionalRendering;
+    table.CmdEndConditionalRendering = ::CmdEndConditionalRendering;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  DeviceGeneratedCommands  ]
+
+static Result NRI_CALL CreateIndirectCommandLayout(Device& device, const IndirectCommandLayoutDesc& indirectCommandLayoutDesc, IndirectCommandLayout*& indirectCommandLayout) {
+    return ((DeviceVal&)device).CreateIndirectCommandLayout(indirectCommandLayoutDesc, indirectCommandLayout);
+}
+
+static Result NRI_CALL CreateIndirectExecutionSet(Device& device, const IndirectExecutionSetDesc& indirectExecutionSetDesc, IndirectExecutionSet*& indirectExecutionSet) {
+    return ((DeviceVal&)device).CreateIndirectExecutionSet(indirectExecutionSetDesc, indirectExecutionSet);
+}
+
+static uint64_t NRI_CALL GetGeneratedCommandsPreprocessBufferSize(const IndirectCommandLayout& indirectCommandLayout, const IndirectExecutionSet* indirectExecutionSet, uint32_t sequenceMaxNum) {
+    return ((IndirectCommandLayoutVal&)indirectCommandLayout).GetPreprocessBufferSize(indirectExecutionSet, sequenceMaxNum);
+}
+
+static void NRI_CALL DestroyIndirectCommandLayout(IndirectCommandLayout& indirectCommandLayout) {
+    if (!(&indirectCommandLayout))
+        return;
+
+    GetDeviceVal(indirectCommandLayout).DestroyIndirectCommandLayout(indirectCommandLayout);
+}
+
+static void NRI_CALL DestroyIndirectExecutionSet(IndirectExecutionSet& indirectExecutionSet) {
+    if (!(&indirectExecutionSet))
+        return;
+
+    GetDeviceVal(indirectExecutionSet).DestroyIndirectExecutionSet(indirectExecutionSet);
+}
+
+static void NRI_CALL UpdateIndirectExecutionSet(IndirectExecutionSet& indirectExecutionSet, uint32_t basePipelineIndex, const Pipeline* const* pipelines, uint32_t pipelineNum) {
+    ((IndirectExecutionSetVal&)indirectExecutionSet).Update(basePipelineIndex, pipelines, pipelineNum);
+}
+
+static void NRI_CALL CmdExecuteGeneratedCommands(CommandBuffer& commandBuffer, const GeneratedCommandsDesc& generatedCommandsDesc) {
+    ((CommandBufferVal&)commandBuffer).ExecuteGeneratedCommands(generatedCommandsDesc);
+}
+
+Result DeviceVal::FillFunctionTable(DeviceGeneratedCommandsInterface& table) const {
+    if (!m_IsExtSupported.deviceGeneratedCommands)
+        return Result::UNSUPPORTED;
+
+    table.CreateIndirectCommandLayout = ::CreateIndirectCommandLayout;
+    table.CreateIndirectExecutionSet = ::CreateIndirectExecutionSet;
+    table.GetGeneratedCommandsPreprocessBufferSize = ::GetGeneratedCommandsPreprocessBufferSize;
+    table.DestroyIndirectCommandLayout = ::DestroyIndirectCommandLayout;
+    table.DestroyIndirectExecutionSet = ::DestroyIndirectExecutionSet;
+    table.UpdateIndirectExecutionSet = ::UpdateIndirectExecutionSet;
+    table.CmdExecuteGeneratedCommands = ::CmdExecuteGeneratedCommands;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  FenceCallback  ]
+
+static Result NRI_CALL RegisterFenceCallback(Fence& fence, uint64_t value, const FenceCallbackDesc& fenceCallbackDesc) {
+    return ((FenceVal&)fence).RegisterCallback(value, fenceCallbackDesc);
+}
+
+Result DeviceVal::FillFunctionTable(FenceCallbackInterface& table) const {
+    if (!m_IsExtSupported.fenceCallback)
+        return Result::UNSUPPORTED;
+
+    table.RegisterFenceCallback = ::RegisterFenceCallback;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
 //============================================================================================================================================================================================
 #pragma region[  Helper  ]
 
@@ -781,11 +955,106 @@ static Result NRI_CALL QueryVideoMemoryInfo(const Device& device, MemoryLocation
     return deviceVal.GetHelperInterfaceImpl().QueryVideoMemoryInfo(deviceVal.GetImpl(), memoryLocation, videoMemoryInfo);
 }
 
+static void NRI_CALL DestroyDeferred(Device& device, const DeferredDestroyDesc* deferredDestroyDescs, uint32_t deferredDestroyDescNum) {
+    DeviceVal& deviceVal = (DeviceVal&)device;
+
+    RETURN_ON_FAILURE(&deviceVal, deferredDestroyDescNum == 0 || deferredDestroyDescs != nullptr, ReturnVoid(), "'deferredDestroyDescs' is NULL");
+
+    for (uint32_t i = 0; i < deferredDestroyDescNum; i++) {
+        const DeferredDestroyDesc& deferredDestroyDesc = deferredDestroyDescs[i];
+
+        RETURN_ON_FAILURE(&deviceVal, deferredDestroyDesc.object != nullptr, ReturnVoid(), "'deferredDestroyDescs[%u].object' is NULL", i);
+        RETURN_ON_FAILURE(&deviceVal, deferredDestroyDesc.type < DeferredDestroyType::MAX_NUM, ReturnVoid(), "'deferredDestroyDescs[%u].type' is invalid", i);
+        RETURN_ON_FAILURE(&deviceVal, deferredDestroyDesc.fence != nullptr, ReturnVoid(), "'deferredDestroyDescs[%u].fence' is NULL", i);
+    }
+
+    HelperDeferredDestroyer deferredDestroyer(deviceVal.GetCoreInterface(), device);
+
+    deferredDestroyer.DestroyDeferred(deferredDestroyDescs, deferredDestroyDescNum);
+}
+
+static void NRI_CALL ProcessDeferredDestroys(Device& device, bool all) {
+    DeviceVal& deviceVal = (DeviceVal&)device;
+    HelperDeferredDestroyer deferredDestroyer(deviceVal.GetCoreInterface(), device);
+
+    deferredDestroyer.ProcessDeferredDestroys(all);
+}
+
+static Result NRI_CALL CreateFrameContext(Device& device, const FrameContextDesc& frameContextDesc, FrameContext*& frameContext) {
+    DeviceVal& deviceVal = (DeviceVal&)device;
+
+    RETURN_ON_FAILURE(&deviceVal, frameContextDesc.queue != nullptr, Result::INVALID_ARGUMENT, "'queue' is NULL");
+    RETURN_ON_FAILURE(&deviceVal, frameContextDesc.frameNum != 0, Result::INVALID_ARGUMENT, "'frameNum' is 0");
+
+    FrameContextImpl* impl = Allocate<FrameContextImpl>(deviceVal.GetAllocationCallbacks(), device, deviceVal.GetCoreInterface());
+    Result result = impl->Create(frameContextDesc);
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        frameContext = nullptr;
+    } else
+        frameContext = (FrameContext*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyFrameContext(FrameContext& frameContext) {
+    if (!(&frameContext))
+        return;
+
+    Destroy((FrameContextImpl*)&frameContext);
+}
+
+static uint32_t NRI_CALL BeginFrameContext(FrameContext& frameContext) {
+    return ((FrameContextImpl&)frameContext).BeginFrame();
+}
+
+static Result NRI_CALL EndFrameContext(FrameContext& frameContext) {
+    return ((FrameContextImpl&)frameContext).EndFrame();
+}
+
+static CommandAllocator* NRI_CALL GetFrameCommandAllocator(const FrameContext& frameContext, uint32_t threadIndex) {
+    const FrameContextImpl& frameContextImpl = (FrameContextImpl&)frameContext;
+    DeviceVal& deviceVal = (DeviceVal&)frameContextImpl.GetDevice();
+
+    RETURN_ON_FAILURE(&deviceVal, threadIndex < frameContextImpl.GetThreadNum(), nullptr, "'threadIndex' is out of bounds");
+
+    return frameContextImpl.GetCommandAllocator(threadIndex);
+}
+
+static CommandBuffer* NRI_CALL GetFrameCommandBuffer(const FrameContext& frameContext, uint32_t threadIndex, uint32_t commandBufferIndex) {
+    const FrameContextImpl& frameContextImpl = (FrameContextImpl&)frameContext;
+    DeviceVal& deviceVal = (DeviceVal&)frameContextImpl.GetDevice();
+
+    RETURN_ON_FAILURE(&deviceVal, threadIndex < frameContextImpl.GetThreadNum(), nullptr, "'threadIndex' is out of bounds");
+    RETURN_ON_FAILURE(&deviceVal, commandBufferIndex < frameContextImpl.GetCommandBufferNum(), nullptr, "'commandBufferIndex' is out of bounds");
+
+    return frameContextImpl.GetCommandBuffer(threadIndex, commandBufferIndex);
+}
+
+static DescriptorPool* NRI_CALL GetFrameDescriptorPool(const FrameContext& frameContext, uint32_t threadIndex) {
+    const FrameContextImpl& frameContextImpl = (FrameContextImpl&)frameContext;
+    DeviceVal& deviceVal = (DeviceVal&)frameContextImpl.GetDevice();
+
+    RETURN_ON_FAILURE(&deviceVal, threadIndex < frameContextImpl.GetThreadNum(), nullptr, "'threadIndex' is out of bounds");
+
+    return frameContextImpl.GetDescriptorPool(threadIndex);
+}
+
 Result DeviceVal::FillFunctionTable(HelperInterface& table) const {
     table.CalculateAllocationNumber = ::CalculateAllocationNumber;
     table.AllocateAndBindMemory = ::AllocateAndBindMemory;
     table.UploadData = ::UploadData;
     table.QueryVideoMemoryInfo = ::QueryVideoMemoryInfo;
+    table.DestroyDeferred = ::DestroyDeferred;
+    table.ProcessDeferredDestroys = ::ProcessDeferredDestroys;
+    table.CreateFrameContext = ::CreateFrameContext;
+    table.DestroyFrameContext = ::DestroyFrameContext;
+    table.BeginFrameContext = ::BeginFrameContext;
+    table.EndFrameContext = ::EndFrameContext;
+    table.GetFrameCommandAllocator = ::GetFrameCommandAllocator;
+    table.GetFrameCommandBuffer = ::GetFrameCommandBuffer;
+    table.GetFrameDescriptorPool = ::GetFrameDescriptorPool;
 
     return Result::SUCCESS;
 }
@@ -921,6 +1190,99 @@ Result DeviceVal::FillFunctionTable(MeshShaderInterface& table) const {
 
 #pragma endregion
 
+//============================================================================================================================================================================================
+#pragma region[  QueueScheduler  ]
+
+static Result NRI_CALL CreateQueueScheduler(Device& device, QueueScheduler*& queueScheduler) {
+    DeviceVal& deviceVal = (DeviceVal&)device;
+
+    QueueSchedulerImpl* impl = Allocate<QueueSchedulerImpl>(deviceVal.GetAllocationCallbacks(), device, deviceVal.GetCoreInterface());
+    Result result = impl->Create();
+
+    if (result != Result::SUCCESS) {
+        Destroy(impl);
+        queueScheduler = nullptr;
+    } else
+        queueScheduler = (QueueScheduler*)impl;
+
+    return result;
+}
+
+static void NRI_CALL DestroyQueueScheduler(QueueScheduler& queueScheduler) {
+    if (!(&queueScheduler))
+        return;
+
+    Destroy((QueueSchedulerImpl*)&queueScheduler);
+}
+
+static Queue* NRI_CALL GetQueueSchedulerQueue(const QueueScheduler& queueScheduler, QueueType queueType) {
+    const QueueSchedulerImpl& queueSchedulerImpl = (QueueSchedulerImpl&)queueScheduler;
+    DeviceVal& deviceVal = (DeviceVal&)queueSchedulerImpl.GetDevice();
+    RETURN_ON_FAILURE(&deviceVal, queueType < QueueType::MAX_NUM, nullptr, "'queueType' is invalid");
+
+    return queueSchedulerImpl.GetQueue(queueType);
+}
+
+static Result NRI_CALL SubmitSchedule(QueueScheduler& queueScheduler, const ScheduleDesc& scheduleDesc) {
+    QueueSchedulerImpl& queueSchedulerImpl = (QueueSchedulerImpl&)queueScheduler;
+    DeviceVal& deviceVal = (DeviceVal&)queueSchedulerImpl.GetDevice();
+
+    RETURN_ON_FAILURE(&deviceVal, scheduleDesc.nodes || !scheduleDesc.nodeNum, Result::INVALID_ARGUMENT, "'nodes' is NULL");
+    RETURN_ON_FAILURE(&deviceVal, scheduleDesc.waitFences || !scheduleDesc.waitFenceNum, Result::INVALID_ARGUMENT, "'waitFences' is NULL");
+    RETURN_ON_FAILURE(&deviceVal, scheduleDesc.signalFences || !scheduleDesc.signalFenceNum, Result::INVALID_ARGUMENT, "'signalFences' is NULL");
+
+    for (uint32_t i = 0; i < scheduleDesc.nodeNum; i++) {
+        const ScheduleNodeDesc& node = scheduleDesc.nodes[i];
+
+        RETURN_ON_FAILURE(&deviceVal, node.queueType < QueueType::MAX_NUM, Result::INVALID_ARGUMENT, "'nodes[%u].queueType' is invalid", i);
+        RETURN_ON_FAILURE(&deviceVal, node.commandBuffers || !node.commandBufferNum, Result::INVALID_ARGUMENT, "'nodes[%u].commandBuffers' is NULL", i);
+        RETURN_ON_FAILURE(&deviceVal, node.resources || !node.resourceNum, Result::INVALID_ARGUMENT, "'nodes[%u].resources' is NULL", i);
+
+        for (uint32_t j = 0; j < node.resourceNum; j++)
+            RETURN_ON_FAILURE(&deviceVal, node.resources[j].resource, Result::INVALID_ARGUMENT, "'nodes[%u].resources[%u].resource' is NULL", i, j);
+    }
+
+    return queueSchedulerImpl.Submit(scheduleDesc);
+}
+
+Result DeviceVal::FillFunctionTable(QueueSchedulerInterface& table) const {
+    table.CreateQueueScheduler = ::CreateQueueScheduler;
+    table.DestroyQueueScheduler = ::DestroyQueueScheduler;
+    table.GetQueueSchedulerQueue = ::GetQueueSchedulerQueue;
+    table.SubmitSchedule = ::SubmitSchedule;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  QueueTimeline  ]
+
+static uint64_t NRI_CALL GetQueueSubmissionId(const Queue& queue) {
+    const QueueVal& queueVal = (QueueVal&)queue;
+
+    return queueVal.GetQueueTimelineInterfaceImpl().GetQueueSubmissionId(*queueVal.GetImpl());
+}
+
+static uint64_t NRI_CALL GetQueueCompletedSubmissionId(const Queue& queue) {
+    const QueueVal& queueVal = (QueueVal&)queue;
+
+    return queueVal.GetQueueTimelineInterfaceImpl().GetQueueCompletedSubmissionId(*queueVal.GetImpl());
+}
+
+Result DeviceVal::FillFunctionTable(QueueTimelineInterface& table) const {
+    if (!m_IsExtSupported.queueTimeline)
+        return Result::UNSUPPORTED;
+
+    table.GetQueueSubmissionId = ::GetQueueSubmissionId;
+    table.GetQueueCompletedSubmissionId = ::GetQueueCompletedSubmissionId;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
 //============================================================================================================================================================================================
 #pragma region[  RayTracing  ]
 
@@ -1134,6 +1496,106 @@ Result DeviceVal::FillFunctionTable(RayTracingInterface& table) const {
 
 #pragma endregion
 
+//============================================================================================================================================================================================
+#pragma region[  RenderGraph  ]
+
+static Result NRI_CALL CreateRenderGraph(Device& device, RenderGraph*& renderGraph) {
+    DeviceVal& deviceVal = (DeviceVal&)device;
+    renderGraph = (RenderGraph*)Allocate<RenderGraphImpl>(deviceVal.GetAllocationCallbacks(), device, deviceVal.GetCoreInterface());
+
+    return Result::SUCCESS;
+}
+
+static void NRI_CALL DestroyRenderGraph(RenderGraph& renderGraph) {
+    if (!(&renderGraph))
+        return;
+
+    Destroy((RenderGraphImpl*)&renderGraph);
+}
+
+static Result NRI_CALL CompileRenderGraph(RenderGraph& renderGraph, const RenderGraphDesc& renderGraphDesc) {
+    RenderGraphImpl& renderGraphImpl = (RenderGraphImpl&)renderGraph;
+    DeviceVal& deviceVal = (DeviceVal&)renderGraphImpl.GetDevice();
+
+    RETURN_ON_FAILURE(&deviceVal, renderGraphDesc.resources || !renderGraphDesc.resourceNum, Result::INVALID_ARGUMENT, "'resources' is NULL");
+    RETURN_ON_FAILURE(&deviceVal, renderGraphDesc.passes || !renderGraphDesc.passNum, Result::INVALID_ARGUMENT, "'passes' is NULL");
+
+    for (uint32_t i = 0; i < renderGraphDesc.resourceNum; i++) {
+        const RenderGraphResourceDesc& resourceDesc = renderGraphDesc.resources[i];
+        bool isTexture = resourceDesc.type == RenderGraphResourceType::TEXTURE;
+
+        RETURN_ON_FAILURE(&deviceVal, resourceDesc.type < RenderGraphResourceType::MAX_NUM, Result::INVALID_ARGUMENT, "'resources[%u].type' is invalid", i);
+        RETURN_ON_FAILURE(&deviceVal, !resourceDesc.texture || !resourceDesc.buffer, Result::INVALID_ARGUMENT, "'resources[%u]' can't be both a texture and a buffer", i);
+        RETURN_ON_FAILURE(&deviceVal, isTexture ? !resourceDesc.buffer : !resourceDesc.texture, Result::INVALID_ARGUMENT, "'resources[%u]' doesn't match 'type'", i);
+
+        if (!resourceDesc.texture && !resourceDesc.buffer) {
+            bool isValid = isTexture ? resourceDesc.textureDesc.width != 0 : resourceDesc.bufferDesc.size != 0;
+            RETURN_ON_FAILURE(&deviceVal, isValid, Result::INVALID_ARGUMENT, "'resources[%u]' has zero-sized transient desc", i);
+        }
+    }
+
+    for (uint32_t i = 0; i < renderGraphDesc.passNum; i++) {
+        const RenderGraphPassDesc& passDesc = renderGraphDesc.passes[i];
+
+        RETURN_ON_FAILURE(&deviceVal, passDesc.reads || !passDesc.readNum, Result::INVALID_ARGUMENT, "'passes[%u].reads' is NULL", i);
+        RETURN_ON_FAILURE(&deviceVal, passDesc.writes || !passDesc.writeNum, Result::INVALID_ARGUMENT, "'passes[%u].writes' is NULL", i);
+
+        for (uint32_t j = 0; j < passDesc.readNum + passDesc.writeNum; j++) {
+            bool isWrite = j >= passDesc.readNum;
+            const RenderGraphAccessDesc& accessDesc = isWrite ? passDesc.writes[j - passDesc.readNum] : passDesc.reads[j];
+            const char* accessName = isWrite ? "writes" : "reads";
+            uint32_t accessIndex = isWrite ? j - passDesc.readNum : j;
+
+            RETURN_ON_FAILURE(&deviceVal, accessDesc.resourceIndex < renderGraphDesc.resourceNum, Result::INVALID_ARGUMENT, "'passes[%u].%s[%u].resourceIndex' is out of bounds", i, accessName, accessIndex);
+
+            // All accesses of a texture in a pass must use the same layout
+            if (renderGraphDesc.resources[accessDesc.resourceIndex].type != RenderGraphResourceType::TEXTURE)
+                continue;
+
+            for (uint32_t k = 0; k < j; k++) {
+                const RenderGraphAccessDesc& prevAccessDesc = k >= passDesc.readNum ? passDesc.writes[k - passDesc.readNum] : passDesc.reads[k];
+                if (prevAccessDesc.resourceIndex == accessDesc.resourceIndex)
+                    RETURN_ON_FAILURE(&deviceVal, prevAccessDesc.state.layout == accessDesc.state.layout, Result::INVALID_ARGUMENT, "'passes[%u].%s[%u]' uses a texture in different layouts within the pass", i, accessName, accessIndex);
+            }
+        }
+    }
+
+    return renderGraphImpl.Compile(renderGraphDesc);
+}
+
+static Texture* NRI_CALL GetRenderGraphTexture(const RenderGraph& renderGraph, uint32_t resourceIndex) {
+    return ((RenderGraphImpl&)renderGraph).GetTexture(resourceIndex);
+}
+
+static Buffer* NRI_CALL GetRenderGraphBuffer(const RenderGraph& renderGraph, uint32_t resourceIndex) {
+    return ((RenderGraphImpl&)renderGraph).GetBuffer(resourceIndex);
+}
+
+static void NRI_CALL GetRenderGraphStats(const RenderGraph& renderGraph, RenderGraphStats& renderGraphStats) {
+    ((RenderGraphImpl&)renderGraph).GetStats(renderGraphStats);
+}
+
+static void NRI_CALL CmdExecuteRenderGraph(CommandBuffer& commandBuffer, const RenderGraph& renderGraph) {
+    CommandBufferVal& commandBufferVal = (CommandBufferVal&)commandBuffer;
+    RETURN_ON_FAILURE(&commandBufferVal.GetDevice(), commandBufferVal.IsRecordingStarted(), ReturnVoid(), "the command buffer must be in the recording state");
+
+    ((RenderGraphImpl&)renderGraph).CmdExecute(commandBuffer);
+}
+
+Result DeviceVal::FillFunctionTable(RenderGraphInterface& table) const {
+    table.CreateRenderGraph = ::CreateRenderGraph;
+    table.DestroyRenderGraph = ::DestroyRenderGraph;
+    table.CompileRenderGraph = ::CompileRenderGraph;
+    table.GetRenderGraphTexture = ::GetRenderGraphTexture;
+    table.GetRenderGraphBuffer = ::GetRenderGraphBuffer;
+    table.GetRenderGraphStats = ::GetRenderGraphStats;
+    table.CmdExecuteRenderGraph = ::CmdExecuteRenderGraph;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
 //============================================================================================================================================================================================
 #pragma region[  ResourceAllocator  ]
 
@@ -1164,6 +1626,62 @@ Result DeviceVal::FillFunctionTable(ResourceAllocatorInterface& table) const {
 
 #pragma endregion
 
+//============================================================================================================================================================================================
+#pragma region[  SecondaryCommandBuffer  ]
+
+static Result NRI_CALL CreateSecondaryCommandBuffer(CommandAllocator& commandAllocator, CommandBuffer*& commandBuffer) {
+    return ((CommandAllocatorVal&)commandAllocator).CreateSecondaryCommandBuffer(commandBuffer);
+}
+
+static Result NRI_CALL BeginSecondaryCommandBuffer(CommandBuffer& commandBuffer, const AttachmentsDesc* attachmentsDesc, const DescriptorPool* descriptorPool) {
+    return ((CommandBufferVal&)commandBuffer).BeginSecondary(attachmentsDesc, descriptorPool);
+}
+
+static void NRI_CALL CmdBeginRenderingSecondary(CommandBuffer& commandBuffer, const AttachmentsDesc& attachmentsDesc) {
+    ((CommandBufferVal&)commandBuffer).BeginRenderingSecondary(attachmentsDesc);
+}
+
+static void NRI_CALL CmdExecuteCommands(CommandBuffer& commandBuffer, const CommandBuffer* const* secondaryCommandBuffers, uint32_t secondaryCommandBufferNum) {
+    ((CommandBufferVal&)commandBuffer).ExecuteCommands(secondaryCommandBuffers, secondaryCommandBufferNum);
+}
+
+Result DeviceVal::FillFunctionTable(SecondaryCommandBufferInterface& table) const {
+    if (!m_IsExtSupported.secondaryCommandBuffer)
+        return Result::UNSUPPORTED;
+
+    table.CreateSecondaryCommandBuffer = ::CreateSecondaryCommandBuffer;
+    table.BeginSecondaryCommandBuffer = ::BeginSecondaryCommandBuffer;
+    table.CmdBeginRenderingSecondary = ::CmdBeginRenderingSecondary;
+    table.CmdExecuteCommands = ::CmdExecuteCommands;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
+//============================================================================================================================================================================================
+#pragma region[  SplitBarrier  ]
+
+static uint32_t NRI_CALL CmdBeginBarrier(CommandBuffer& commandBuffer, const BarrierGroupDesc& barrierGroupDesc) {
+    return ((CommandBufferVal&)commandBuffer).BeginBarrier(barrierGroupDesc);
+}
+
+static void NRI_CALL CmdEndBarrier(CommandBuffer& commandBuffer, const BarrierGroupDesc& barrierGroupDesc, uint32_t splitBarrierIndex) {
+    ((CommandBufferVal&)commandBuffer).EndBarrier(barrierGroupDesc, splitBarrierIndex);
+}
+
+Result DeviceVal::FillFunctionTable(SplitBarrierInterface& table) const {
+    if (!m_IsExtSupported.splitBarrier)
+        return Result::UNSUPPORTED;
+
+    table.CmdBeginBarrier = ::CmdBeginBarrier;
+    table.CmdEndBarrier = ::CmdEndBarrier;
+
+    return Result::SUCCESS;
+}
+
+#pragma endregion
+
 //============================================================================================================================================================================================
 #pragma region[  Streamer  ]
 
@@ -0,0 +1,46 @@
+// © 2025 NVIDIA Corporation
+
+#pragma once
+
+namespace nri {
+
+struct IndirectCommandLayoutVal final : public ObjectVal {
+    inline IndirectCommandLayoutVal(DeviceVal& device, IndirectCommandLayout* indirectCommandLayout, const IndirectCommandLayoutDesc& indirectCommandLayoutDesc)
+        : ObjectVal(device, indirectCommandLayout) {
+        for (uint32_t i = 0; i < indirectCommandLayoutDesc.commandNum; i++) {
+            IndirectCommandType type = indirectCommandLayoutDesc.commands[i].type;
+
+            if (type == IndirectCommandType::PIPELINE)
+                m_HasPipelineCommand = true;
+            else if (type == IndirectCommandType::DISPATCH)
+                m_IsDispatch = true;
+        }
+    }
+
+    inline ~IndirectCommandLayoutVal() {
+    }
+
+    inline IndirectCommandLayout* GetImpl() const {
+        return (IndirectCommandLayout*)m_Impl;
+    }
+
+    inline bool HasPipelineCommand() const {
+        return m_HasPipelineCommand;
+    }
+
+    inline bool IsDispatch() const {
+        return m_IsDispatch;
+    }
+
+    //================================================================================================================
+    // NRI
+    //================================================================================================================
+
+    uint64_t GetPreprocessBufferSize(const IndirectExecutionSet* indirectExecutionSet, uint32_t sequenceMaxNum) const;
+
+private:
+    bool m_HasPipelineCommand = false;
+    bool m_IsDispatch = false;
+};
+
+} // namespace nri
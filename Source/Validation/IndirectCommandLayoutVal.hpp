@@ -0,0 +1,9 @@
+// © 2025 NVIDIA Corporation
+
+NRI_INLINE uint64_t IndirectCommandLayoutVal::GetPreprocessBufferSize(const IndirectExecutionSet* indirectExecutionSet, uint32_t sequenceMaxNum) const {
+    RETURN_ON_FAILURE(&m_Device, !m_HasPipelineCommand || indirectExecutionSet, 0, "'indirectExecutionSet' is NULL, but the layout has a 'PIPELINE' command");
+
+    IndirectExecutionSet* indirectExecutionSetImpl = NRI_GET_IMPL(IndirectExecutionSet, indirectExecutionSet);
+
+    return GetDeviceGeneratedCommandsInterfaceImpl().GetGeneratedCommandsPreprocessBufferSize(*GetImpl(), indirectExecutionSetImpl, sequenceMaxNum);
+}
@@ -0,0 +1,30 @@
+// © 2025 NVIDIA Corporation
+
+#pragma once
+
+namespace nri {
+
+struct IndirectExecutionSetVal final : public ObjectVal {
+    inline IndirectExecutionSetVal(DeviceVal& device, IndirectExecutionSet* indirectExecutionSet, uint32_t pipelineMaxNum)
+        : ObjectVal(device, indirectExecutionSet)
+        , m_PipelineMaxNum(pipelineMaxNum) {
+    }
+
+    inline ~IndirectExecutionSetVal() {
+    }
+
+    inline IndirectExecutionSet* GetImpl() const {
+        return (IndirectExecutionSet*)m_Impl;
+    }
+
+    //================================================================================================================
+    // NRI
+    //================================================================================================================
+
+    void Update(uint32_t basePipelineIndex, const Pipeline* const* pipelines, uint32_t pipelineNum);
+
+private:
+    uint32_t m_PipelineMaxNum = 0;
+};
+
+} // namespace nri
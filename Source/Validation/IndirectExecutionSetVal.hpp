@@ -0,0 +1,15 @@
+// © 2025 NVIDIA Corporation
+
+NRI_INLINE void IndirectExecutionSetVal::Update(uint32_t basePipelineIndex, const Pipeline* const* pipelines, uint32_t pipelineNum) {
+    RETURN_ON_FAILURE(&m_Device, pipelines, ReturnVoid(), "'pipelines' is NULL");
+    RETURN_ON_FAILURE(&m_Device, basePipelineIndex + pipelineNum <= m_PipelineMaxNum, ReturnVoid(), "'basePipelineIndex + pipelineNum' is greater than 'pipelineMaxNum=%u'", m_PipelineMaxNum);
+
+    Scratch<Pipeline*> pipelinesImpl = AllocateScratch(m_Device, Pipeline*, pipelineNum);
+    for (uint32_t i = 0; i < pipelineNum; i++) {
+        RETURN_ON_FAILURE(&m_Device, pipelines[i], ReturnVoid(), "'pipelines[%u]' is NULL", i);
+
+        pipelinesImpl[i] = NRI_GET_IMPL(Pipeline, pipelines[i]);
+    }
+
+    GetDeviceGeneratedCommandsInterfaceImpl().UpdateIndirectExecutionSet(*GetImpl(), basePipelineIndex, pipelinesImpl, pipelineNum);
+}
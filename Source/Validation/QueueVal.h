@@ -25,6 +25,7 @@ struct QueueVal final : public ObjectVal {
     void EndAnnotation();
     void Annotation(const char* name, uint32_t bgra);
     Result Submit(const QueueSubmitDesc& queueSubmitDesc, const SwapChain* swapChain);
+    Result SubmitMulti(const QueueSubmitDesc* queueSubmitDescs, uint32_t queueSubmitDescNum);
     Result WaitIdle();
 };
 
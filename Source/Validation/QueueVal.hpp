@@ -12,34 +12,107 @@ NRI_INLINE void QueueVal::Annotation(const char* name, uint32_t bgra) {
     GetCoreInterfaceImpl().QueueAnnotation(*GetImpl(), name, bgra);
 }
 
-NRI_INLINE Result QueueVal::Submit(const QueueSubmitDesc& queueSubmitDesc, const SwapChain* swapChain) {
-    auto queueSubmitDescImpl = queueSubmitDesc;
+static bool ValidateQueueSubmitDesc(const DeviceVal& device, const QueueSubmitDesc& queueSubmitDesc) {
+    for (uint32_t i = 0; i < queueSubmitDesc.commandBufferNum; i++) {
+        const CommandBufferVal* commandBufferVal = (CommandBufferVal*)queueSubmitDesc.commandBuffers[i];
+        RETURN_ON_FAILURE(&device, !commandBufferVal->IsSecondary(), false, "'commandBuffers[%u]' is a secondary command buffer", i);
+        RETURN_ON_FAILURE(&device, !commandBufferVal->IsRecordingStarted() || commandBufferVal->IsWrapped(), false, "'commandBuffers[%u]' is in the recording state", i);
+        RETURN_ON_FAILURE(&device, !commandBufferVal->IsSubmitted() || commandBufferVal->IsReusable(), false, "'commandBuffers[%u]' has already been submitted, but it's not begun with 'BeginReusableCommandBuffer'", i);
+        RETURN_ON_FAILURE(&device, !commandBufferVal->IsResetByCommandAllocator(), false, "'commandBuffers[%u]' must be re-recorded after 'ResetCommandAllocator'", i);
+    }
 
-    Scratch<FenceSubmitDesc> waitFences = AllocateScratch(m_Device, FenceSubmitDesc, queueSubmitDesc.waitFenceNum);
+    return true;
+}
+
+static QueueSubmitDesc GetQueueSubmitDescImpl(const QueueSubmitDesc& queueSubmitDesc, FenceSubmitDesc* waitFences, CommandBuffer** commandBuffers, FenceSubmitDesc* signalFences) {
     for (uint32_t i = 0; i < queueSubmitDesc.waitFenceNum; i++) {
         waitFences[i] = queueSubmitDesc.waitFences[i];
         waitFences[i].fence = NRI_GET_IMPL(Fence, waitFences[i].fence);
     }
-    queueSubmitDescImpl.waitFences = waitFences;
 
-    Scratch<CommandBuffer*> commandBuffers = AllocateScratch(m_Device, CommandBuffer*, queueSubmitDesc.commandBufferNum);
     for (uint32_t i = 0; i < queueSubmitDesc.commandBufferNum; i++)
         commandBuffers[i] = NRI_GET_IMPL(CommandBuffer, queueSubmitDesc.commandBuffers[i]);
-    queueSubmitDescImpl.commandBuffers = commandBuffers;
 
-    Scratch<FenceSubmitDesc> signalFences = AllocateScratch(m_Device, FenceSubmitDesc, queueSubmitDesc.signalFenceNum);
     for (uint32_t i = 0; i < queueSubmitDesc.signalFenceNum; i++) {
         signalFences[i] = queueSubmitDesc.signalFences[i];
         signalFences[i].fence = NRI_GET_IMPL(Fence, signalFences[i].fence);
     }
+
+    QueueSubmitDesc queueSubmitDescImpl = queueSubmitDesc;
+    queueSubmitDescImpl.waitFences = waitFences;
+    queueSubmitDescImpl.commandBuffers = commandBuffers;
     queueSubmitDescImpl.signalFences = signalFences;
 
+    return queueSubmitDescImpl;
+}
+
+NRI_INLINE Result QueueVal::Submit(const QueueSubmitDesc& queueSubmitDesc, const SwapChain* swapChain) {
+    if (!ValidateQueueSubmitDesc(m_Device, queueSubmitDesc))
+        return Result::INVALID_ARGUMENT;
+
+    Scratch<FenceSubmitDesc> waitFences = AllocateScratch(m_Device, FenceSubmitDesc, queueSubmitDesc.waitFenceNum);
+    Scratch<CommandBuffer*> commandBuffers = AllocateScratch(m_Device, CommandBuffer*, queueSubmitDesc.commandBufferNum);
+    Scratch<FenceSubmitDesc> signalFences = AllocateScratch(m_Device, FenceSubmitDesc, queueSubmitDesc.signalFenceNum);
+    QueueSubmitDesc queueSubmitDescImpl = GetQueueSubmitDescImpl(queueSubmitDesc, waitFences, commandBuffers, signalFences);
+
+    Result result;
     if (swapChain) {
         SwapChain* swapChainImpl = NRI_GET_IMPL(SwapChain, swapChain);
 
-        return m_Device.GetLowLatencyInterfaceImpl().QueueSubmitTrackable(*GetImpl(), queueSubmitDescImpl, *swapChainImpl);
+        result = m_Device.GetLowLatencyInterfaceImpl().QueueSubmitTrackable(*GetImpl(), queueSubmitDescImpl, *swapChainImpl);
     } else
-        return GetCoreInterfaceImpl().QueueSubmit(*GetImpl(), queueSubmitDescImpl);
+        result = GetCoreInterfaceImpl().QueueSubmit(*GetImpl(), queueSubmitDescImpl);
+
+    if (result == Result::SUCCESS) {
+        for (uint32_t i = 0; i < queueSubmitDesc.commandBufferNum; i++)
+            ((CommandBufferVal*)queueSubmitDesc.commandBuffers[i])->SetSubmitted();
+    }
+
+    return result;
+}
+
+NRI_INLINE Result QueueVal::SubmitMulti(const QueueSubmitDesc* queueSubmitDescs, uint32_t queueSubmitDescNum) {
+    RETURN_ON_FAILURE(&m_Device, queueSubmitDescs || !queueSubmitDescNum, Result::INVALID_ARGUMENT, "'queueSubmitDescs' is NULL");
+
+    uint32_t waitFenceNum = 0;
+    uint32_t commandBufferNum = 0;
+    uint32_t signalFenceNum = 0;
+    for (uint32_t i = 0; i < queueSubmitDescNum; i++) {
+        if (!ValidateQueueSubmitDesc(m_Device, queueSubmitDescs[i]))
+            return Result::INVALID_ARGUMENT;
+
+        waitFenceNum += queueSubmitDescs[i].waitFenceNum;
+        commandBufferNum += queueSubmitDescs[i].commandBufferNum;
+        signalFenceNum += queueSubmitDescs[i].signalFenceNum;
+    }
+
+    Scratch<QueueSubmitDesc> queueSubmitDescsImpl = AllocateScratch(m_Device, QueueSubmitDesc, queueSubmitDescNum);
+    Scratch<FenceSubmitDesc> waitFences = AllocateScratch(m_Device, FenceSubmitDesc, waitFenceNum);
+    Scratch<CommandBuffer*> commandBuffers = AllocateScratch(m_Device, CommandBuffer*, commandBufferNum);
+    Scratch<FenceSubmitDesc> signalFences = AllocateScratch(m_Device, FenceSubmitDesc, signalFenceNum);
+
+    waitFenceNum = 0;
+    commandBufferNum = 0;
+    signalFenceNum = 0;
+    for (uint32_t i = 0; i < queueSubmitDescNum; i++) {
+        const QueueSubmitDesc& queueSubmitDesc = queueSubmitDescs[i];
+        queueSubmitDescsImpl[i] = GetQueueSubmitDescImpl(queueSubmitDesc, waitFences + waitFenceNum, commandBuffers + commandBufferNum, signalFences + signalFenceNum);
+
+        waitFenceNum += queueSubmitDesc.waitFenceNum;
+        commandBufferNum += queueSubmitDesc.commandBufferNum;
+        signalFenceNum += queueSubmitDesc.signalFenceNum;
+    }
+
+    Result result = GetCoreInterfaceImpl().QueueSubmitMulti(*GetImpl(), queueSubmitDescsImpl, queueSubmitDescNum);
+
+    if (result == Result::SUCCESS) {
+        for (uint32_t i = 0; i < queueSubmitDescNum; i++) {
+            for (uint32_t j = 0; j < queueSubmitDescs[i].commandBufferNum; j++)
+                ((CommandBufferVal*)queueSubmitDescs[i].commandBuffers[j])->SetSubmitted();
+        }
+    }
+
+    return result;
 }
 
 NRI_INLINE Result QueueVal::WaitIdle() {
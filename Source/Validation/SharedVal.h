@@ -35,6 +35,22 @@ struct ObjectVal : public DebugNameBaseVal {
         return m_Device.GetCoreInterfaceImpl();
     }
 
+    inline const CommandBufferStatsInterface& GetCommandBufferStatsInterfaceImpl() const {
+        return m_Device.GetCommandBufferStatsInterfaceImpl();
+    }
+
+    inline const ConditionalRenderingInterface& GetConditionalRenderingInterfaceImpl() const {
+        return m_Device.GetConditionalRenderingInterfaceImpl();
+    }
+
+    inline const DeviceGeneratedCommandsInterface& GetDeviceGeneratedCommandsInterfaceImpl() const {
+        return m_Device.GetDeviceGeneratedCommandsInterfaceImpl();
+    }
+
+    inline const FenceCallbackInterface& GetFenceCallbackInterfaceImpl() const {
+        return m_Device.GetFenceCallbackInterfaceImpl();
+    }
+
     inline const HelperInterface& GetHelperInterfaceImpl() const {
         return m_Device.GetHelperInterfaceImpl();
     }
@@ -47,10 +63,22 @@ struct ObjectVal : public DebugNameBaseVal {
         return m_Device.GetMeshShaderInterfaceImpl();
     }
 
+    inline const QueueTimelineInterface& GetQueueTimelineInterfaceImpl() const {
+        return m_Device.GetQueueTimelineInterfaceImpl();
+    }
+
     inline const RayTracingInterface& GetRayTracingInterfaceImpl() const {
         return m_Device.GetRayTracingInterfaceImpl();
     }
 
+    inline const SecondaryCommandBufferInterface& GetSecondaryCommandBufferInterfaceImpl() const {
+        return m_Device.GetSecondaryCommandBufferInterfaceImpl();
+    }
+
+    inline const SplitBarrierInterface& GetSplitBarrierInterfaceImpl() const {
+        return m_Device.GetSplitBarrierInterfaceImpl();
+    }
+
     inline const SwapChainInterface& GetSwapChainInterfaceImpl() const {
         return m_Device.GetSwapChainInterfaceImpl();
     }